@@ -0,0 +1,110 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    allPairs.h:
+        - Header file for the 'allPairsMatrix.c' source file.
+        - Defines the public functions to build, save and query an all-pairs shortest distance matrix,
+            for small and medium networks where every query can be answered with one lookup.
+        - Contains the 'AllPairs' structure.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+#ifndef ALLPAIRS_H_INCLUDED
+#define ALLPAIRS_H_INCLUDED
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        ALLPAIRS LIBRARIES/DEFINITIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// User Created Search Library:
+#include "search.h"
+
+/*
+    ALLPAIRS_METHOD:
+        - Methods understood by allPairsConstructor().
+                ALLPAIRS_FLOYD      -> Blocked Floyd-Warshall, best for dense graphs.
+                ALLPAIRS_DIJKSTRA   -> One Dijkstra search per source node, best for sparse graphs (road networks).
+*/
+#define ALLPAIRS_FLOYD 0
+#define ALLPAIRS_DIJKSTRA 1
+
+/*
+    ALLPAIRS_THREADS:
+        - Default number of threads (including the calling thread) used to build a matrix.
+*/
+#define ALLPAIRS_THREADS 4
+
+/*
+    ALLPAIRS_BLOCK:
+        - Side of the square blocks Floyd-Warshall updates at a time. Three blocks of distances and
+            next hops (6 x 64 x 64 x 4 bytes) fit within a typical level 2 cache.
+*/
+#define ALLPAIRS_BLOCK 64
+
+/*
+    ALLPAIRS_SIMD:
+        - Enables/Disables the AVX2 build of the Floyd-Warshall block update (chosen at runtime).
+                '1' -> Enabled.
+                '0' -> Disabled.
+*/
+#define ALLPAIRS_SIMD 1
+
+/*
+    ALLPAIRS_INFINITY:
+        - Distance stored for unreachable pairs, small enough that two of them add without overflow.
+        - Read through allPairsDistance(), which returns INT_MAX for unreachable pairs instead.
+*/
+#define ALLPAIRS_INFINITY (INT_MAX / 2)
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        PUBLIC ALLPAIRS STRUCTURES
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    AllPairs Structure:
+        - Row 'start' of each matrix holds the results of every query from node id 'start'.
+        - Rows are padded to a whole number of blocks (stride), padding entries are never read.
+
+        numNodes        - Number of nodes within the matrix.
+        stride          - Number of entries between the starts of two rows.
+        distance        - Shortest distance of every pair (ALLPAIRS_INFINITY if unreachable).
+        next            - First node id after the start on a shortest path of every pair ('-1' if unreachable).
+        names           - Graph holding only the node names and name index (no edges).
+*/
+struct AllPairs
+{
+    int numNodes;
+    int stride;
+
+    int* distance;
+    int* next;
+
+    struct Graph* names;
+};
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                    PUBLIC ALLPAIRS FUNCTION DECLARATIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Builds the all-pairs matrix of a given graph with a given method and number of threads.
+struct AllPairs* allPairsConstructor(struct Graph* graph, int method, int numThreads);
+
+// Frees memory associated with a given all-pairs matrix.
+void allPairsDestructor(struct AllPairs* allPairs);
+
+// Returns the shortest distance between two node ids (INT_MAX if unreachable).
+int allPairsDistance(struct AllPairs* allPairs, int startId, int endId);
+
+// Writes the node ids of the shortest path between two node ids, returns the number of nodes.
+int allPairsPath(struct AllPairs* allPairs, int startId, int endId, int* path);
+
+// Writes an all-pairs matrix to a binary file.
+int allPairsSave(struct AllPairs* allPairs, const char* fileName);
+
+// Reads an all-pairs matrix written by allPairsSave().
+struct AllPairs* allPairsLoad(const char* fileName);
+
+#endif // ALLPAIRS_H_INCLUDED
@@ -0,0 +1,635 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    allPairsMatrix.c:
+        - Source file defining the functions to build, save and query all-pairs shortest distance matrices.
+        - Two builders fill the same distance and next hop matrices:
+            - Blocked Floyd-Warshall: the matrix is split into ALLPAIRS_BLOCK square blocks. For each
+                block of intermediate nodes the diagonal block is updated first, then its row and column
+                blocks, then every other block, the blocks of each stage shared between the threads.
+                Each block update is a min-plus loop over contiguous rows (8 pairs at a time with AVX2
+                when the processor supports it).
+            - Dijkstra: every thread runs one-to-all searches from the next unclaimed source node and
+                fills that node's rows.
+        - Once built, any distance is one load and any path is recovered hop by hop from the next matrix.
+
+        - Functions:
+            - allPairsAllocate
+            - allPairsBlockUpdate
+            - allPairsBlockUpdateAvx2
+            - allPairsFloydThread
+            - allPairsFloyd
+            - allPairsDijkstraThread
+            - allPairsDijkstra
+            - allPairsConstructor
+            - allPairsDestructor
+            - allPairsDistance
+            - allPairsPath
+            - allPairsSave
+            - allPairsLoad
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Include respective header file:
+#include "allPairs.h"
+
+// Thread and atomic libraries:
+#include <pthread.h>
+#include <stdatomic.h>
+
+// Vector intrinsics (x86 GCC/Clang only, other platforms use the scalar loop):
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define ALLPAIRS_X86 1
+#include <immintrin.h>
+#else
+#define ALLPAIRS_X86 0
+#endif
+
+// Identifies an all-pairs matrix file.
+#define ALLPAIRS_FILE_TAG 0x50535041
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            ALLPAIRS STRUCTURES
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    AllPairsBuild Structure:
+        - Shared state of the threads building one matrix.
+
+        allPairs        - Matrix being built.
+        graph           - Graph the matrix is built from.
+        numThreads      - Number of threads, including the calling thread.
+        numBlocks       - Number of blocks along each side of the matrix (Floyd-Warshall).
+        blockUpdate     - Block update kernel chosen for the processor (Floyd-Warshall).
+        barrier         - Barrier the threads wait on between stages (Floyd-Warshall).
+        nextSource      - Next unclaimed source node id (Dijkstra).
+*/
+struct AllPairsBuild
+{
+    struct AllPairs* allPairs;
+    struct Graph* graph;
+    int numThreads;
+
+    int numBlocks;
+    void (*blockUpdate)(struct AllPairs* allPairs, int kBlock, int iBlock, int jBlock);
+    pthread_barrier_t barrier;
+
+    atomic_int nextSource;
+};
+
+/*
+    AllPairsWorker Structure:
+        build       - Shared build state.
+        index       - Thread number ('0' is the calling thread).
+        thread      - POSIX thread handle (unused for thread '0').
+*/
+struct AllPairsWorker
+{
+    struct AllPairsBuild* build;
+    int index;
+    pthread_t thread;
+};
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        ALLPAIRS CONSTRUCTORS/DESTRUCTORS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    All Pairs Allocate:
+        - Allocate memory for an all-pairs matrix of a given number of nodes, rows padded to whole blocks.
+        - Every pair starts unreachable.
+        - Returns pointer to new all-pairs matrix.
+*/
+static struct AllPairs* allPairsAllocate(int numNodes)
+{
+    struct AllPairs* allPairs = malloc(sizeof(struct AllPairs));
+    long index;
+
+    allPairs->numNodes = numNodes;
+    allPairs->stride = ((numNodes + ALLPAIRS_BLOCK - 1) / ALLPAIRS_BLOCK) * ALLPAIRS_BLOCK;
+
+    long numEntries = (long) allPairs->stride * (allPairs->stride > 0 ? allPairs->stride : 1);
+
+    allPairs->distance = aligned_alloc(ALLPAIRS_BLOCK * sizeof(int), numEntries * sizeof(int));
+    allPairs->next = aligned_alloc(ALLPAIRS_BLOCK * sizeof(int), numEntries * sizeof(int));
+    allPairs->names = NULL;
+
+    for (index = 0; index < numEntries; index++)
+    {
+        allPairs->distance[index] = ALLPAIRS_INFINITY;
+        allPairs->next[index] = -1;
+    }
+
+    // Return new all-pairs matrix.
+    return allPairs;
+}
+
+/*
+    All Pairs Destructor:
+        - Free memory associated with an all-pairs matrix.
+*/
+void allPairsDestructor(struct AllPairs* allPairs)
+{
+    if (allPairs == NULL)
+        return;
+
+    free(allPairs->distance);
+    free(allPairs->next);
+    graphDestructor(allPairs->names);
+    free(allPairs);
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        ALLPAIRS FLOYD-WARSHALL FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    All Pairs Block Update:
+        - Lowers every pair of block (iBlock, jBlock) through each intermediate node of block kBlock.
+        - A lowered pair takes the first hop of its path to the intermediate node.
+*/
+static void allPairsBlockUpdate(struct AllPairs* allPairs, int kBlock, int iBlock, int jBlock)
+{
+    int stride = allPairs->stride;
+    int k, i, j;
+
+    for (k = kBlock * ALLPAIRS_BLOCK; k < (kBlock + 1) * ALLPAIRS_BLOCK; k++)
+    {
+        int* rowK = &allPairs->distance[(long) k * stride + jBlock * ALLPAIRS_BLOCK];
+
+        for (i = iBlock * ALLPAIRS_BLOCK; i < (iBlock + 1) * ALLPAIRS_BLOCK; i++)
+        {
+            int distanceIK = allPairs->distance[(long) i * stride + k];
+            int nextIK = allPairs->next[(long) i * stride + k];
+
+            // Nothing can be lowered through an unreachable intermediate node.
+            if (distanceIK == ALLPAIRS_INFINITY || i == k)
+                continue;
+
+            int* rowI = &allPairs->distance[(long) i * stride + jBlock * ALLPAIRS_BLOCK];
+            int* nextI = &allPairs->next[(long) i * stride + jBlock * ALLPAIRS_BLOCK];
+
+            for (j = 0; j < ALLPAIRS_BLOCK; j++)
+            {
+                if (distanceIK + rowK[j] < rowI[j])
+                {
+                    rowI[j] = distanceIK + rowK[j];
+                    nextI[j] = nextIK;
+                }
+            }
+        }
+    }
+}
+
+#if ALLPAIRS_X86
+
+/*
+    All Pairs Block Update AVX2:
+        - The same block update, 8 pairs at a time: the lowered distances are the lane minimums and
+            the next hops are blended in where the distance was lowered.
+        - Rows and blocks start on 64 byte boundaries, so every load and store is aligned.
+*/
+__attribute__((target("avx2")))
+static void allPairsBlockUpdateAvx2(struct AllPairs* allPairs, int kBlock, int iBlock, int jBlock)
+{
+    int stride = allPairs->stride;
+    int k, i, j;
+
+    for (k = kBlock * ALLPAIRS_BLOCK; k < (kBlock + 1) * ALLPAIRS_BLOCK; k++)
+    {
+        int* rowK = &allPairs->distance[(long) k * stride + jBlock * ALLPAIRS_BLOCK];
+
+        for (i = iBlock * ALLPAIRS_BLOCK; i < (iBlock + 1) * ALLPAIRS_BLOCK; i++)
+        {
+            int distanceIK = allPairs->distance[(long) i * stride + k];
+
+            if (distanceIK == ALLPAIRS_INFINITY || i == k)
+                continue;
+
+            int* rowI = &allPairs->distance[(long) i * stride + jBlock * ALLPAIRS_BLOCK];
+            int* nextI = &allPairs->next[(long) i * stride + jBlock * ALLPAIRS_BLOCK];
+
+            __m256i base = _mm256_set1_epi32(distanceIK);
+            __m256i hop = _mm256_set1_epi32(allPairs->next[(long) i * stride + k]);
+
+            for (j = 0; j < ALLPAIRS_BLOCK; j += 8)
+            {
+                __m256i through = _mm256_add_epi32(base, _mm256_load_si256((const __m256i*) &rowK[j]));
+                __m256i current = _mm256_load_si256((const __m256i*) &rowI[j]);
+                __m256i better = _mm256_cmpgt_epi32(current, through);
+
+                _mm256_store_si256((__m256i*) &rowI[j], _mm256_min_epi32(current, through));
+                _mm256_store_si256((__m256i*) &nextI[j],
+                                   _mm256_blendv_epi8(_mm256_load_si256((const __m256i*) &nextI[j]), hop, better));
+            }
+        }
+    }
+}
+
+#endif // ALLPAIRS_X86
+
+/*
+    All Pairs Floyd Thread:
+        - Runs the three stages of every block of intermediate nodes, taking every 'numThreads'th
+            block of each stage and waiting for the other threads between stages.
+        - The block updates within one stage never write a block another update of the stage reads.
+*/
+static void* allPairsFloydThread(void* argument)
+{
+    struct AllPairsWorker* worker = argument;
+    struct AllPairsBuild* build = worker->build;
+    struct AllPairs* allPairs = build->allPairs;
+    int numBlocks = build->numBlocks;
+    int kBlock, task;
+
+    for (kBlock = 0; kBlock < numBlocks; kBlock++)
+    {
+        // Stage 1: the diagonal block, through its own nodes.
+        if (worker->index == 0)
+            build->blockUpdate(allPairs, kBlock, kBlock, kBlock);
+
+        pthread_barrier_wait(&build->barrier);
+
+        // Stage 2: the rest of the diagonal block's row and column.
+        for (task = worker->index; task < 2 * numBlocks; task += build->numThreads)
+        {
+            int block = task / 2;
+
+            if (block == kBlock)
+                continue;
+
+            if (task % 2 == 0)
+                build->blockUpdate(allPairs, kBlock, kBlock, block);
+
+            else build->blockUpdate(allPairs, kBlock, block, kBlock);
+        }
+
+        pthread_barrier_wait(&build->barrier);
+
+        // Stage 3: every other block, through the row and column blocks.
+        for (task = worker->index; task < numBlocks * numBlocks; task += build->numThreads)
+        {
+            int iBlock = task / numBlocks;
+            int jBlock = task % numBlocks;
+
+            if (iBlock != kBlock && jBlock != kBlock)
+                build->blockUpdate(allPairs, kBlock, iBlock, jBlock);
+        }
+
+        pthread_barrier_wait(&build->barrier);
+    }
+
+    return NULL;
+}
+
+/*
+    All Pairs Floyd:
+        - Fills the matrix with every edge (the shortest of any parallel paths), then runs the
+            blocked Floyd-Warshall stages across the threads.
+*/
+static void allPairsFloyd(struct AllPairsBuild* build, struct AllPairsWorker* workers)
+{
+    struct AllPairs* allPairs = build->allPairs;
+    struct Graph* graph = build->graph;
+    int stride = allPairs->stride;
+    int id, edge;
+
+    for (id = 0; id < stride; id++)
+    {
+        allPairs->distance[(long) id * stride + id] = 0;
+        allPairs->next[(long) id * stride + id] = id;
+    }
+
+    for (id = 0; id < graph->numNodes; id++)
+    {
+        for (edge = graph->rowStart[id]; edge < graph->rowStart[id + 1]; edge++)
+        {
+            long pair = (long) id * stride + graph->targets[edge];
+
+            if (graph->weights[edge] < allPairs->distance[pair])
+            {
+                allPairs->distance[pair] = graph->weights[edge];
+                allPairs->next[pair] = graph->targets[edge];
+            }
+        }
+    }
+
+    // Choose the block update kernel.
+    build->numBlocks = stride / ALLPAIRS_BLOCK;
+    build->blockUpdate = allPairsBlockUpdate;
+
+#if ALLPAIRS_X86
+    __builtin_cpu_init();
+
+    if (ALLPAIRS_SIMD == 1 && __builtin_cpu_supports("avx2"))
+        build->blockUpdate = allPairsBlockUpdateAvx2;
+#endif
+
+    pthread_barrier_init(&build->barrier, NULL, build->numThreads);
+
+    int index;
+    for (index = 1; index < build->numThreads; index++)
+        pthread_create(&workers[index].thread, NULL, allPairsFloydThread, &workers[index]);
+
+    allPairsFloydThread(&workers[0]);
+
+    for (index = 1; index < build->numThreads; index++)
+        pthread_join(workers[index].thread, NULL);
+
+    pthread_barrier_destroy(&build->barrier);
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        ALLPAIRS DIJKSTRA FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    All Pairs Dijkstra Thread:
+        - Claims source nodes one at a time, runs a one-to-all search from each and fills its rows.
+        - The first hop towards each node is found by walking its back nodes until a node whose
+            first hop is already known (or whose back node is the source), then copied down the walk.
+*/
+static void* allPairsDijkstraThread(void* argument)
+{
+    struct AllPairsWorker* worker = argument;
+    struct AllPairsBuild* build = worker->build;
+    struct AllPairs* allPairs = build->allPairs;
+    struct Graph* graph = build->graph;
+
+    struct Search* search = searchConstructor(graph);
+    int* walk = malloc((graph->numNodes > 0 ? graph->numNodes : 1) * sizeof(int));
+    int source;
+
+    while ((source = atomic_fetch_add(&build->nextSource, 1)) < graph->numNodes)
+    {
+        int* distanceRow = &allPairs->distance[(long) source * allPairs->stride];
+        int* nextRow = &allPairs->next[(long) source * allPairs->stride];
+        int id;
+
+        searchShortestPath(search, source, -1);
+
+        for (id = 0; id < graph->numNodes; id++)
+        {
+            int distance = searchDistance(search, id);
+
+            distanceRow[id] = (distance == INT_MAX) ? ALLPAIRS_INFINITY : distance;
+            nextRow[id] = (distance == INT_MAX) ? -1 : -2;
+        }
+
+        nextRow[source] = source;
+
+        for (id = 0; id < graph->numNodes; id++)
+        {
+            int walkLength = 0;
+            int current = id;
+
+            while (nextRow[current] == -2 && search->back[current] != source)
+            {
+                walk[walkLength++] = current;
+                current = search->back[current];
+            }
+
+            if (nextRow[current] == -2)
+                nextRow[current] = current;
+
+            while (walkLength > 0)
+                nextRow[walk[--walkLength]] = nextRow[current];
+        }
+    }
+
+    free(walk);
+    searchDestructor(search);
+
+    return NULL;
+}
+
+/*
+    All Pairs Dijkstra:
+        - Runs one search per source node across the threads.
+*/
+static void allPairsDijkstra(struct AllPairsBuild* build, struct AllPairsWorker* workers)
+{
+    int index;
+
+    atomic_init(&build->nextSource, 0);
+
+    for (index = 1; index < build->numThreads; index++)
+        pthread_create(&workers[index].thread, NULL, allPairsDijkstraThread, &workers[index]);
+
+    allPairsDijkstraThread(&workers[0]);
+
+    for (index = 1; index < build->numThreads; index++)
+        pthread_join(workers[index].thread, NULL);
+}
+
+/*
+    All Pairs Constructor:
+        - Builds the all-pairs matrix of a given graph with a given method (see ALLPAIRS_METHOD) across
+            a given number of threads (including the calling thread).
+        - The matrix keeps its own names, so the graph may be freed afterwards.
+        - Returns pointer to new all-pairs matrix, or 'NULL' if the method is unknown.
+*/
+struct AllPairs* allPairsConstructor(struct Graph* graph, int method, int numThreads)
+{
+    if (method != ALLPAIRS_FLOYD && method != ALLPAIRS_DIJKSTRA)
+    {
+        printf("Failure: Unknown all-pairs method %d! - (allPairsConstructor - allPairsMatrix.c)\n", method);
+        return NULL;
+    }
+
+    if (numThreads < 1)
+        numThreads = 1;
+
+    struct AllPairsBuild build;
+    struct AllPairsWorker* workers = malloc(numThreads * sizeof(struct AllPairsWorker));
+    int index;
+
+    build.allPairs = allPairsAllocate(graph->numNodes);
+    build.graph = graph;
+    build.numThreads = numThreads;
+
+    for (index = 0; index < numThreads; index++)
+    {
+        workers[index].build = &build;
+        workers[index].index = index;
+    }
+
+    if (graph->numNodes > 0)
+    {
+        if (method == ALLPAIRS_FLOYD)
+            allPairsFloyd(&build, workers);
+
+        else allPairsDijkstra(&build, workers);
+    }
+
+    free(workers);
+
+    build.allPairs->names = graphCopyNames(graph);
+
+    // Return new all-pairs matrix.
+    return build.allPairs;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            ALLPAIRS QUERY FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    All Pairs Distance:
+        - Returns the shortest distance between two node ids, or INT_MAX if unreachable (or an id is invalid).
+*/
+int allPairsDistance(struct AllPairs* allPairs, int startId, int endId)
+{
+    if (startId < 0 || endId < 0 || startId >= allPairs->numNodes || endId >= allPairs->numNodes)
+        return INT_MAX;
+
+    int distance = allPairs->distance[(long) startId * allPairs->stride + endId];
+
+    return (distance == ALLPAIRS_INFINITY) ? INT_MAX : distance;
+}
+
+/*
+    All Pairs Path:
+        - Writes the node ids of a shortest path from start to end into 'path' (room for numNodes ids).
+        - Returns the number of nodes on the path, '0' if unreachable.
+*/
+int allPairsPath(struct AllPairs* allPairs, int startId, int endId, int* path)
+{
+    if (allPairsDistance(allPairs, startId, endId) == INT_MAX)
+        return 0;
+
+    int numNodes = 0;
+    int current = startId;
+
+    path[numNodes++] = current;
+
+    while (current != endId && numNodes < allPairs->numNodes)
+    {
+        current = allPairs->next[(long) current * allPairs->stride + endId];
+        path[numNodes++] = current;
+    }
+
+    return numNodes;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            ALLPAIRS FILE FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    All Pairs Save:
+        - Writes an all-pairs matrix to a binary file (native byte order):
+            tag, numNodes, name pool size, name pool, then numNodes rows of distances and of next hops.
+        - Returns indication if function was successful.
+            '1' -> File written.
+            '0' -> File could not be written.
+*/
+int allPairsSave(struct AllPairs* allPairs, const char* fileName)
+{
+    FILE* file = fopen(fileName, "wb");
+
+    if (file == NULL)
+    {
+        printf("Failure: Unable to open '%s'! - (allPairsSave - allPairsMatrix.c)\n", fileName);
+        return 0;
+    }
+
+    int header[3] = { ALLPAIRS_FILE_TAG, allPairs->numNodes, allPairs->names->nameOffset[allPairs->numNodes] };
+    int written = (fwrite(header, sizeof(int), 3, file) == 3);
+
+    written &= (fwrite(allPairs->names->namePool, 1, header[2], file) == (size_t) header[2]);
+
+    int id;
+    for (id = 0; id < allPairs->numNodes; id++)
+        written &= (fwrite(&allPairs->distance[(long) id * allPairs->stride], sizeof(int), allPairs->numNodes, file)
+                    == (size_t) allPairs->numNodes);
+
+    for (id = 0; id < allPairs->numNodes; id++)
+        written &= (fwrite(&allPairs->next[(long) id * allPairs->stride], sizeof(int), allPairs->numNodes, file)
+                    == (size_t) allPairs->numNodes);
+
+    if (fclose(file) != 0 || written == 0)
+    {
+        printf("Failure: Unable to write '%s'! - (allPairsSave - allPairsMatrix.c)\n", fileName);
+        return 0;
+    }
+
+    return 1;
+}
+
+/*
+    All Pairs Load:
+        - Reads an all-pairs matrix written by allPairsSave().
+        - Returns pointer to new all-pairs matrix, or 'NULL' if the file is missing or invalid.
+*/
+struct AllPairs* allPairsLoad(const char* fileName)
+{
+    FILE* file = fopen(fileName, "rb");
+
+    if (file == NULL)
+    {
+        printf("Failure: Unable to open '%s'! - (allPairsLoad - allPairsMatrix.c)\n", fileName);
+        return NULL;
+    }
+
+    int header[3];
+
+    if (fread(header, sizeof(int), 3, file) != 3 || header[0] != ALLPAIRS_FILE_TAG || header[1] < 0 || header[2] < 0)
+    {
+        printf("Failure: '%s' is not an all-pairs matrix file! - (allPairsLoad - allPairsMatrix.c)\n", fileName);
+        fclose(file);
+        return NULL;
+    }
+
+    struct AllPairs* allPairs = allPairsAllocate(header[1]);
+    char* namePool = malloc(header[2] > 0 ? header[2] : 1);
+    int valid = (fread(namePool, 1, header[2], file) == (size_t) header[2]);
+    int id;
+
+    for (id = 0; id < allPairs->numNodes; id++)
+        valid &= (fread(&allPairs->distance[(long) id * allPairs->stride], sizeof(int), allPairs->numNodes, file)
+                  == (size_t) allPairs->numNodes);
+
+    for (id = 0; id < allPairs->numNodes; id++)
+        valid &= (fread(&allPairs->next[(long) id * allPairs->stride], sizeof(int), allPairs->numNodes, file)
+                  == (size_t) allPairs->numNodes);
+
+    fclose(file);
+
+    // Rebuild the names, one per node.
+    allPairs->names = graphConstructor(allPairs->numNodes, 0, header[2]);
+
+    int offset = 0;
+    for (id = 0; id < allPairs->numNodes && valid == 1; id++)
+    {
+        char* name = &namePool[offset];
+        int length = strnlen(name, header[2] - offset);
+
+        if (offset + length >= header[2])
+            valid = 0;
+
+        else graphSetName(allPairs->names, id, name);
+
+        offset += length + 1;
+    }
+
+    free(namePool);
+
+    if (valid == 0)
+    {
+        printf("Failure: '%s' is incomplete! - (allPairsLoad - allPairsMatrix.c)\n", fileName);
+        allPairsDestructor(allPairs);
+        return NULL;
+    }
+
+    graphBuildIndex(allPairs->names);
+
+    // Return new all-pairs matrix.
+    return allPairs;
+}
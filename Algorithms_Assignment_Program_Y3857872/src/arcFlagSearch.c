@@ -0,0 +1,687 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    arcFlagSearch.c:
+        - Source file defining the functions to build, update and search with arc flags.
+        - Regions are grown around seed nodes chosen furthest from every seed so far, each node joining
+            the region of its nearest seed. Cities unreachable from every seed join the last region.
+        - A boundary node has a path to another region. Any shortest path into region 'r' enters it
+            for the last time through one of its boundary nodes 'b', so flagging every edge (u -> v) with
+            d(u, b) = weight + d(v, b) on a shortest path tree from each 'b', plus every edge inside 'r',
+            keeps at least one shortest path to each city of 'r' intact. Paths are undirected, so the
+            tree grown from 'b' gives the distances towards 'b'.
+        - The trees run across the threads, each into its own flag array, merged once every tree is done.
+        - Changing a path weight only changes the trees of the boundary nodes it lay on a shortest path
+            towards before or after the change, found with one search from each end of the path. Only
+            those trees are grown again and their flags added to the existing ones. Flags left over from
+            the old trees still give exact distances, they just prune a little less until the next build.
+
+        - Functions:
+            - arcFlagsAllocate
+            - arcFlagsPartition
+            - arcFlagsTree
+            - arcFlagsWorkerThread
+            - arcFlagsGrow
+            - arcFlagsRefresh
+            - arcFlagsConstructor
+            - arcFlagsDestructor
+            - arcFlagsUpdate
+            - searchSetArcFlags
+            - searchShortestPathArcFlags
+            - dijkstraArcFlags
+            - arcFlagsReport
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Include respective header file:
+#include "arcFlags.h"
+
+// Graph checksum shared with the landmark tables:
+#include "landmarks.h"
+
+// Thread and atomic libraries:
+#include <pthread.h>
+#include <stdatomic.h>
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            ARC FLAGS STRUCTURES
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    ArcFlagsBuild Structure:
+        - Shared state while flagging edges.
+
+        arcFlags    - Flags being built.
+        graph       - Graph flagged.
+        tasks       - Boundary nodes whose trees are grown.
+        numTasks    - Number of boundary nodes.
+        nextTask    - Next unclaimed boundary node.
+*/
+struct ArcFlagsBuild
+{
+    struct ArcFlags* arcFlags;
+    struct Graph* graph;
+
+    int* tasks;
+    int numTasks;
+    atomic_int nextTask;
+};
+
+/*
+    ArcFlagsWorker Structure:
+        build       - Shared state.
+        index       - Thread number ('0' is the calling thread).
+        thread      - POSIX thread handle (unused for thread '0').
+        search      - Workspace growing this thread's trees.
+        flags       - Region bits set by this thread's trees.
+*/
+struct ArcFlagsWorker
+{
+    struct ArcFlagsBuild* build;
+    int index;
+    pthread_t thread;
+
+    struct Search* search;
+    unsigned long long* flags;
+};
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        ARC FLAGS PREPROCESSING FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Arc Flags Allocate:
+        - Allocate memory for the flags of a graph (every edge starts unflagged).
+        - Returns pointer to new arc flags.
+*/
+static struct ArcFlags* arcFlagsAllocate(struct Graph* graph, int numRegions)
+{
+    struct ArcFlags* arcFlags = malloc(sizeof(struct ArcFlags));
+
+    arcFlags->numNodes = graph->numNodes;
+    arcFlags->numEdges = graph->numEdges;
+    arcFlags->numRegions = numRegions;
+    arcFlags->numBoundary = 0;
+    arcFlags->checksum = 0;
+
+    arcFlags->region = calloc(graph->numNodes > 0 ? graph->numNodes : 1, sizeof(int));
+    arcFlags->flags = calloc(graph->numEdges > 0 ? graph->numEdges : 1, sizeof(unsigned long long));
+    arcFlags->buildTime = 0;
+
+    arcFlags->checkedGraph = NULL;
+    arcFlags->checkedVersion = -1;
+
+    // Return new arc flags.
+    return arcFlags;
+}
+
+/*
+    Arc Flags Partition:
+        - Grows the regions around seeds chosen furthest from the seeds so far (see top of file).
+        - Lowers the number of regions if the graph has fewer nodes.
+*/
+static void arcFlagsPartition(struct ArcFlags* arcFlags, struct Graph* graph)
+{
+    struct Search* search = searchConstructor(graph);
+    int numNodes = graph->numNodes;
+    int* nearest = malloc(numNodes * sizeof(int));
+    int seed = 0;
+    int region, node;
+
+    for (node = 0; node < numNodes; node++)
+    {
+        nearest[node] = INT_MAX;
+        arcFlags->region[node] = -1;
+    }
+
+    for (region = 0; region < arcFlags->numRegions; region++)
+    {
+        // Every node is already a seed.
+        if (nearest[seed] == 0)
+            break;
+
+        searchShortestPath(search, seed, -1);
+
+        for (node = 0; node < numNodes; node++)
+        {
+            int distance = searchDistance(search, node);
+
+            if (distance < nearest[node])
+            {
+                nearest[node] = distance;
+                arcFlags->region[node] = region;
+            }
+        }
+
+        // Next seed, furthest from every seed so far (unreached cities first).
+        for (node = 0; node < numNodes; node++)
+            if (nearest[node] > nearest[seed])
+                seed = node;
+    }
+
+    arcFlags->numRegions = region;
+
+    for (node = 0; node < numNodes; node++)
+        if (arcFlags->region[node] < 0)
+            arcFlags->region[node] = arcFlags->numRegions - 1;
+
+    free(nearest);
+    searchDestructor(search);
+}
+
+/*
+    Arc Flags Tree:
+        - Grows the shortest path tree of a boundary node and flags every edge leading along a shortest
+            path towards it with the boundary node's region.
+*/
+static void arcFlagsTree(struct ArcFlags* arcFlags, struct Search* search, unsigned long long* flags, int boundary)
+{
+    struct Graph* graph = search->graph;
+    unsigned long long bit = 1ULL << arcFlags->region[boundary];
+    int node, edge;
+
+    searchShortestPath(search, boundary, -1);
+
+    for (node = 0; node < graph->numNodes; node++)
+    {
+        int distance = searchDistance(search, node);
+
+        if (distance == INT_MAX)
+            continue;
+
+        for (edge = graph->rowStart[node]; edge < graph->rowStart[node + 1]; edge++)
+        {
+            if (searchDistance(search, graph->targets[edge]) == distance - graph->weights[edge])
+                flags[edge] |= bit;
+        }
+    }
+}
+
+/*
+    Arc Flags Worker Thread:
+        - Claims and grows boundary node trees until none are left.
+*/
+static void* arcFlagsWorkerThread(void* argument)
+{
+    struct ArcFlagsWorker* worker = argument;
+    struct ArcFlagsBuild* build = worker->build;
+    int task;
+
+    while ((task = atomic_fetch_add(&build->nextTask, 1)) < build->numTasks)
+        arcFlagsTree(build->arcFlags, worker->search, worker->flags, build->tasks[task]);
+
+    return NULL;
+}
+
+/*
+    Arc Flags Grow:
+        - Grows the trees of the given boundary nodes across a given number of threads, adding their
+            flags to the existing ones.
+*/
+static void arcFlagsGrow(struct ArcFlags* arcFlags, struct Graph* graph, int* boundary, int numBoundary, int numThreads)
+{
+    int numEdges = graph->numEdges;
+    int index, edge;
+
+    struct ArcFlagsBuild build;
+    build.arcFlags = arcFlags;
+    build.graph = graph;
+    build.tasks = boundary;
+    build.numTasks = numBoundary;
+    atomic_store(&build.nextTask, 0);
+
+    if (numThreads > numBoundary)
+        numThreads = (numBoundary > 0 ? numBoundary : 1);
+
+    struct ArcFlagsWorker* workers = malloc(numThreads * sizeof(struct ArcFlagsWorker));
+
+    for (index = 0; index < numThreads; index++)
+    {
+        workers[index].build = &build;
+        workers[index].index = index;
+        workers[index].search = searchConstructor(graph);
+        workers[index].flags = calloc(numEdges > 0 ? numEdges : 1, sizeof(unsigned long long));
+    }
+
+    for (index = 1; index < numThreads; index++)
+        pthread_create(&workers[index].thread, NULL, arcFlagsWorkerThread, &workers[index]);
+
+    arcFlagsWorkerThread(&workers[0]);
+
+    for (index = 1; index < numThreads; index++)
+        pthread_join(workers[index].thread, NULL);
+
+    // Merge the threads' flags.
+    for (index = 0; index < numThreads; index++)
+    {
+        for (edge = 0; edge < numEdges; edge++)
+            arcFlags->flags[edge] |= workers[index].flags[edge];
+
+        searchDestructor(workers[index].search);
+        free(workers[index].flags);
+    }
+
+    free(workers);
+}
+
+/*
+    Arc Flags Refresh:
+        - Clears and rebuilds the flags of every region across a given number of threads.
+        - Returns the number of boundary nodes.
+*/
+static int arcFlagsRefresh(struct ArcFlags* arcFlags, struct Graph* graph, int numThreads)
+{
+    int* region = arcFlags->region;
+    int* boundary = malloc((graph->numNodes > 0 ? graph->numNodes : 1) * sizeof(int));
+    int numBoundary = 0;
+    int node, edge;
+
+    // Flag every edge inside a region and collect the boundary nodes.
+    for (node = 0; node < graph->numNodes; node++)
+    {
+        int isBoundary = 0;
+
+        for (edge = graph->rowStart[node]; edge < graph->rowStart[node + 1]; edge++)
+        {
+            if (region[graph->targets[edge]] == region[node])
+                arcFlags->flags[edge] = 1ULL << region[node];
+
+            else
+            {
+                arcFlags->flags[edge] = 0;
+                isBoundary = 1;
+            }
+        }
+
+        if (isBoundary == 1)
+            boundary[numBoundary++] = node;
+    }
+
+    arcFlagsGrow(arcFlags, graph, boundary, numBoundary, numThreads);
+    free(boundary);
+
+    return numBoundary;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        ARC FLAGS CONSTRUCTORS/DESTRUCTORS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Arc Flags Constructor:
+        - Splits a graph into a given number of regions and flags its edges across a given number of
+            threads (including the calling thread).
+        - Returns pointer to new arc flags, or 'NULL' for an invalid number of regions or an empty graph.
+*/
+struct ArcFlags* arcFlagsConstructor(struct Graph* graph, int numRegions, int numThreads)
+{
+    double timeStart = timerNow();
+
+    // Error flagging system:
+
+    if (numRegions <= 0 || numRegions > ARCFLAGS_MAX_REGIONS)
+    {
+        printf("Failure: %d = Invalid number of regions! - (arcFlagsConstructor - arcFlagSearch.c)\n", numRegions);
+        return NULL;
+    }
+    else if (graph->numNodes == 0)
+    {
+        printf("Failure: Graph must contain at least 1 city! - (arcFlagsConstructor - arcFlagSearch.c)\n");
+        return NULL;
+    }
+
+    if (numThreads < 1)
+        numThreads = 1;
+
+    struct ArcFlags* arcFlags = arcFlagsAllocate(graph, numRegions);
+
+    arcFlagsPartition(arcFlags, graph);
+    arcFlags->numBoundary = arcFlagsRefresh(arcFlags, graph, numThreads);
+    arcFlags->checksum = landmarksChecksum(graph);
+
+    arcFlags->buildTime = timerNow() - timeStart;
+
+    // Return new arc flags.
+    return arcFlags;
+}
+
+/*
+    Arc Flags Destructor:
+        - Free memory associated with arc flags.
+*/
+void arcFlagsDestructor(struct ArcFlags* arcFlags)
+{
+    if (arcFlags == NULL)
+        return;
+
+    free(arcFlags->region);
+    free(arcFlags->flags);
+    free(arcFlags);
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            ARC FLAGS UPDATE FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Arc Flags Update:
+        - Adds the flags needed after the weight of the path between two node ids of a graph changed from
+            a given old weight. The graph must otherwise match the one the flags were built for (same nodes
+            and edges in the same order), adding or removing a path needs new flags.
+        - A boundary node's tree changes only if the path lies on a shortest path towards it at the lower
+            of its old and new weights, distances of the other nodes towards it are the same either way.
+        - Returns the number of boundary node trees grown again, or '-1' if the graph does not match the
+            flags or the nodes are not connected.
+*/
+int arcFlagsUpdate(struct ArcFlags* arcFlags, struct Graph* graph, int node1, int node2, int oldWeight)
+{
+    int weight = INT_MAX;
+    int node, edge;
+
+    if (graph->numNodes != arcFlags->numNodes || graph->numEdges != arcFlags->numEdges)
+    {
+        printf("Failure: Graph does not match the arc flags! - (arcFlagsUpdate - arcFlagSearch.c)\n");
+        return -1;
+    }
+    else if (node1 < 0 || node1 >= graph->numNodes || node2 < 0 || node2 >= graph->numNodes)
+    {
+        printf("Failure: Invalid node id! - (arcFlagsUpdate - arcFlagSearch.c)\n");
+        return -1;
+    }
+
+    // Current weight of the path (the shortest of any parallel paths).
+    for (edge = graph->rowStart[node1]; edge < graph->rowStart[node1 + 1]; edge++)
+        if (graph->targets[edge] == node2 && graph->weights[edge] < weight)
+            weight = graph->weights[edge];
+
+    if (weight == INT_MAX)
+    {
+        printf("Failure: Cities are not connected! - (arcFlagsUpdate - arcFlagSearch.c)\n");
+        return -1;
+    }
+
+    if (oldWeight < weight)
+        weight = oldWeight;
+
+    // Boundary nodes the path leads towards along a shortest path, at the lower weight.
+    struct Search* search1 = searchConstructor(graph);
+    struct Search* search2 = searchConstructor(graph);
+    int* boundary = malloc((graph->numNodes > 0 ? graph->numNodes : 1) * sizeof(int));
+    int numBoundary = 0;
+
+    searchShortestPath(search1, node1, -1);
+    searchShortestPath(search2, node2, -1);
+
+    for (node = 0; node < graph->numNodes; node++)
+    {
+        int distance1 = searchDistance(search1, node);
+        int distance2 = searchDistance(search2, node);
+        int isBoundary = 0;
+
+        if (distance1 == INT_MAX || distance2 == INT_MAX)
+            continue;
+
+        if ((long long) distance2 + weight > distance1 && (long long) distance1 + weight > distance2)
+            continue;
+
+        for (edge = graph->rowStart[node]; edge < graph->rowStart[node + 1] && isBoundary == 0; edge++)
+            if (arcFlags->region[graph->targets[edge]] != arcFlags->region[node])
+                isBoundary = 1;
+
+        if (isBoundary == 1)
+            boundary[numBoundary++] = node;
+    }
+
+    searchDestructor(search1);
+    searchDestructor(search2);
+
+    arcFlagsGrow(arcFlags, graph, boundary, numBoundary, ARCFLAGS_THREADS);
+    free(boundary);
+
+    arcFlags->checksum = landmarksChecksum(graph);
+    arcFlags->checkedGraph = NULL;
+
+    return numBoundary;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            ARC FLAGS SEARCH FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Search Set Arc Flags:
+        - Prunes every later search with an end node within a workspace by given arc flags, after
+            checking they were built for the workspace's graph ('NULL' returns to plain Dijkstra).
+        - Landmarks take precedence if the workspace has both.
+        - Returns indication if function was successful.
+            '1' -> Arc flags set.
+            '0' -> Arc flags belong to a different graph (workspace left unchanged).
+*/
+int searchSetArcFlags(struct Search* search, struct ArcFlags* arcFlags)
+{
+    if (arcFlags == NULL)
+    {
+        search->arcFlags = NULL;
+        return 1;
+    }
+
+    if (arcFlags->numNodes != search->graph->numNodes || arcFlags->numEdges != search->graph->numEdges
+        || arcFlags->checksum != landmarksChecksum(search->graph))
+    {
+        printf("Failure: Arc flags were built for a different graph! - (searchSetArcFlags - arcFlagSearch.c)\n");
+        return 0;
+    }
+
+    search->arcFlags = arcFlags;
+    return 1;
+}
+
+/*
+    Search Shortest Path Arc Flags:
+        - Performs Dijkstra's algorithm between two node ids, skipping blocked edges and nodes and every
+            edge not flagged for the end node's region.
+        - Stops as soon as the end node is settled, and gives up once the closest unsettled node is
+            further than 'maxDistance'. The end node's distance and route are exact, other settled
+            nodes only hold the shortest distance over flagged edges.
+        - Called by searchShortestPathWithin() for workspaces with arc flags.
+        - Returns indication if the end node was reached.
+            '1' -> End node settled.
+            '0' -> Cities are unreachable, further apart than 'maxDistance' or a limit expired.
+*/
+int searchShortestPathArcFlags(struct Search* search, int startId, int endId, int maxDistance)
+{
+    struct Graph* graph = search->graph;
+    const unsigned long long* flags = search->arcFlags->flags;
+    unsigned long long bit = 1ULL << search->arcFlags->region[endId];
+    int currentDistance;
+
+    searchReset(search, startId);
+
+    while (heapIsEmpty(search->heap) == 0)
+    {
+        // Stop once every remaining node is out of range.
+        if (heapTopKey(search->heap) > maxDistance)
+            break;
+
+        // Stop once the query has used up its time or budget.
+        if (search->hasLimits == 1 && searchLimitsExpired(search) == 1)
+            return 0;
+
+        int currentCity = heapPop(search->heap, &currentDistance);
+
+        // Current city is now fully explored.
+        search->settledStamp[currentCity] = search->epoch;
+        search->settledCount++;
+
+        if (currentCity == endId)
+            return 1;
+
+        int edge;
+        for (edge = graph->rowStart[currentCity]; edge < graph->rowStart[currentCity + 1]; edge++)
+        {
+            int connectedCity = graph->targets[edge];
+            int newDistance = currentDistance + graph->weights[edge];
+
+            // Skip edges leading away from the end node's region.
+            if ((flags[edge] & bit) == 0)
+                continue;
+
+            // Skip cities whose shortest distance is already final.
+            if (search->settledStamp[connectedCity] == search->epoch)
+                continue;
+
+            // Skip edges and cities that are temporarily removed.
+            if (search->hasBlocks == 1 && (search->edgeBlocked[edge] == search->blockEpoch
+                                           || search->nodeBlocked[connectedCity] == search->blockEpoch))
+                continue;
+
+            if (search->stamp[connectedCity] == search->epoch && newDistance >= search->distance[connectedCity])
+                continue;
+
+            search->stamp[connectedCity] = search->epoch;
+            search->distance[connectedCity] = newDistance;
+            search->back[connectedCity] = currentCity;
+            heapPush(search->heap, connectedCity, newDistance);
+        }
+    }
+
+    return 0;
+}
+
+/*
+    Dijkstra Arc Flags:
+        - Performs dijkstra() between two given city names over the edges flagged for the end city's
+            region, printing and writing exactly the same results.
+        - The flags are checked against the network's frozen graph once per network version.
+        - Returns indication if function was successful.
+            '1' -> Network scanned - Path found or cities are unreachable.
+            '0' -> City names invalid / Network is too small / Arc flags built for a different network.
+*/
+int dijkstraArcFlags(FILE* dijkstraresults_file, double* algorithmTime, struct Network* cityNetwork,
+                     struct ArcFlags* arcFlags, const char* cityStartName, const char* cityEndName)
+{
+    struct Search* search = networkSearch(cityNetwork);
+    int version = networkVersion(cityNetwork);
+
+    *algorithmTime = 0;
+
+    // Check the flags only when the network has changed since they were last found to match.
+    if (arcFlags->checkedGraph != search->graph || arcFlags->checkedVersion != version)
+    {
+        if (searchSetArcFlags(search, arcFlags) == 0)
+            return 0;
+
+        arcFlags->checkedGraph = search->graph;
+        arcFlags->checkedVersion = version;
+    }
+
+    else search->arcFlags = arcFlags;
+
+    // Run the search and format its results, the network's workspace returns to plain Dijkstra after.
+    char* text = NULL;
+    int textCapacity = 0;
+    int isSuccessful = searchQuery(search, cityStartName, cityEndName, &text, &textCapacity, algorithmTime);
+
+    search->arcFlags = NULL;
+
+    // Failures are only printed to the terminal.
+    printf("%s", text);
+
+    if (isSuccessful == 1)
+        fprintf(dijkstraresults_file, "%s", text);
+
+    free(text);
+
+    return isSuccessful;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            ARC FLAGS DISPLAY FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Arc Flags Report:
+        - Runs every pair of a 'dijkstrapairs.txt' file through plain Dijkstra and through the arc flags
+            on the same workspace, then prints the mean settled nodes and time per query of each and
+            how many distances differ (always '0').
+        - Pairs with unknown city names are skipped, the file is rewound afterwards.
+*/
+void arcFlagsReport(struct Search* search, struct ArcFlags* arcFlags, FILE* dijkstrapairs_file)
+{
+    struct ArcFlags* previous = search->arcFlags;
+    char cityStartName[127], cityEndName[127];
+    long long dijkstraSettled = 0, flagSettled = 0, numFlags = 0;
+    double dijkstraTime = 0, flagTime = 0;
+    int numPairs = 0, numMismatches = 0;
+    int edge, region;
+
+    if (searchSetArcFlags(search, arcFlags) == 0)
+        return;
+
+    rewind(dijkstrapairs_file);
+
+    while (2 == fscanf(dijkstrapairs_file, " %126s %126s", cityStartName, cityEndName))
+    {
+        int startId = graphCityIndex(search->graph, cityStartName);
+        int endId = graphCityIndex(search->graph, cityEndName);
+
+        if (startId < 0 || endId < 0)
+            continue;
+
+        // Plain Dijkstra.
+        search->arcFlags = NULL;
+
+        double timeStart = timerNow();
+        searchShortestPath(search, startId, endId);
+        dijkstraTime += timerNow() - timeStart;
+
+        int distance = searchDistance(search, endId);
+        dijkstraSettled += search->settledCount;
+
+        // Pruned by the arc flags.
+        search->arcFlags = arcFlags;
+
+        timeStart = timerNow();
+        searchShortestPath(search, startId, endId);
+        flagTime += timerNow() - timeStart;
+
+        flagSettled += search->settledCount;
+
+        if (searchIsSettled(search, endId) == 1 ? searchDistance(search, endId) != distance : distance != INT_MAX)
+            numMismatches++;
+
+        numPairs++;
+    }
+
+    rewind(dijkstrapairs_file);
+    search->arcFlags = previous;
+
+    if (numPairs == 0)
+    {
+        printf("Failure: No known city pairs to compare! - (arcFlagsReport - arcFlagSearch.c)\n");
+        return;
+    }
+
+    // Mean share of the edges flagged for a region.
+    for (edge = 0; edge < arcFlags->numEdges; edge++)
+        for (region = 0; region < arcFlags->numRegions; region++)
+            numFlags += (arcFlags->flags[edge] >> region) & 1ULL;
+
+    printf("\nARC FLAGS - (%d regions, %d boundary nodes, %.1f%% of edges flagged per region, %.3fs preprocessing, %d pairs)\n",
+           arcFlags->numRegions, arcFlags->numBoundary,
+           arcFlags->numEdges > 0 ? 100.0 * numFlags / ((double) arcFlags->numEdges * arcFlags->numRegions) : 0.0,
+           arcFlags->buildTime, numPairs);
+    printf("\tDijkstra : %10.1f settled nodes, %8.2fus per query\n",
+           (double) dijkstraSettled / numPairs, dijkstraTime / numPairs * 1e6);
+    printf("\tArc flags: %10.1f settled nodes, %8.2fus per query\n",
+           (double) flagSettled / numPairs, flagTime / numPairs * 1e6);
+    printf("\tReduction: %10.2fx fewer nodes, %8.2fx faster, %d distances differ.\n",
+           flagSettled > 0 ? (double) dijkstraSettled / flagSettled : 0.0,
+           flagTime > 0 ? dijkstraTime / flagTime : 0.0, numMismatches);
+}
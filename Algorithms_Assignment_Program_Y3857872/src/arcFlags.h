@@ -0,0 +1,113 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    arcFlags.h:
+        - Header file for the 'arcFlagSearch.c' source file.
+        - Defines the public functions to split a frozen graph into regions, flag every edge with the
+            regions it leads towards on a shortest path, and prune Dijkstra's algorithm to the edges
+            flagged for the end city's region. Flags cost one word per edge and a changed path weight
+            only regrows the few shortest path trees it affects.
+        - Contains the 'ArcFlags' structure.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+#ifndef ARCFLAGS_H_INCLUDED
+#define ARCFLAGS_H_INCLUDED
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        ARC FLAGS LIBRARIES/DEFINITIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// User Created Search Library:
+#include "search.h"
+
+/*
+    ARCFLAGS_REGIONS:
+        - Default number of regions. More regions prune more edges, at the cost of one shortest path
+            tree per region boundary node to preprocess.
+*/
+#define ARCFLAGS_REGIONS 32
+
+/*
+    ARCFLAGS_MAX_REGIONS:
+        - Largest number of regions, one bit of each edge's flag word per region.
+*/
+#define ARCFLAGS_MAX_REGIONS 64
+
+/*
+    ARCFLAGS_THREADS:
+        - Default number of threads (including the calling thread) used to flag the edges.
+*/
+#define ARCFLAGS_THREADS 4
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        PUBLIC ARC FLAGS STRUCTURES
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    ArcFlags Structure:
+        - Bit 'r' of an edge's flags is set if the edge starts a shortest path from its node into
+            region 'r', or lies within region 'r'. A search towards a city of region 'r' only needs
+            the edges with bit 'r' set, and still finds the same distances as Dijkstra's algorithm.
+
+        numNodes        - Number of nodes of the graph the flags were built for.
+        numEdges        - Number of edges of that graph.
+        numRegions      - Number of regions.
+        numBoundary     - Number of boundary nodes (nodes with a path to another region).
+        checksum        - Checksum of the graph's rows (see landmarksChecksum()), flags are only used on
+                            a graph with the same checksum.
+        region          - Region of each node.
+        flags           - Region bits of each edge (indexed as the graph's 'targets').
+        buildTime       - Preprocessing time in seconds.
+
+        (Cache used by dijkstraArcFlags())
+        checkedGraph    - Frozen graph last found to match the flags.
+        checkedVersion  - Network version of that frozen graph.
+*/
+struct ArcFlags
+{
+    int numNodes;
+    int numEdges;
+    int numRegions;
+    int numBoundary;
+    unsigned int checksum;
+
+    int* region;
+    unsigned long long* flags;
+    double buildTime;
+
+    // Cache used by dijkstraArcFlags().
+    struct Graph* checkedGraph;
+    int checkedVersion;
+};
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                    PUBLIC ARC FLAGS FUNCTION DECLARATIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Splits a graph into a given number of regions and flags its edges across a given number of threads.
+struct ArcFlags* arcFlagsConstructor(struct Graph* graph, int numRegions, int numThreads);
+
+// Frees memory associated with given arc flags.
+void arcFlagsDestructor(struct ArcFlags* arcFlags);
+
+// Adds the flags needed after the path weight between two node ids of a graph changed from a given old weight.
+int arcFlagsUpdate(struct ArcFlags* arcFlags, struct Graph* graph, int node1, int node2, int oldWeight);
+
+// Prunes the searches of a workspace with given arc flags ('NULL' returns to plain Dijkstra).
+int searchSetArcFlags(struct Search* search, struct ArcFlags* arcFlags);
+
+// Runs Dijkstra's algorithm between two node ids over the edges flagged for the end node's region.
+int searchShortestPathArcFlags(struct Search* search, int startId, int endId, int maxDistance);
+
+// Performs dijkstra() between two city names over the edges flagged for the end city's region.
+int dijkstraArcFlags(FILE* dijkstraresults_file, double* algorithmTime, struct Network* cityNetwork,
+                     struct ArcFlags* arcFlags, const char* cityStartName, const char* cityEndName);
+
+// Prints the settled nodes and time per query of Dijkstra's algorithm with and without arc flags over a file of city pairs.
+void arcFlagsReport(struct Search* search, struct ArcFlags* arcFlags, FILE* dijkstrapairs_file);
+
+#endif // ARCFLAGS_H_INCLUDED
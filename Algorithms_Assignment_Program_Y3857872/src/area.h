@@ -0,0 +1,90 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    area.h:
+        - Header file for the 'radiusSearch.c' source file.
+        - Defines the public functions to find every city within a given distance of a start city
+            (service areas, isochrones), for one start city or many at once across threads.
+        - Contains the 'Area' structure.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+#ifndef AREA_H_INCLUDED
+#define AREA_H_INCLUDED
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            AREA LIBRARIES/DEFINITIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// User Created Network Library:
+#include "network.h"
+
+/*
+    AREA_ORDER:
+        - Order of the cities within an area.
+            AREA_ORDER_DISTANCE -> Closest first, the order the search settles them in (no sorting needed).
+            AREA_ORDER_NAME     -> Alphabetical by city name.
+*/
+#define AREA_ORDER_DISTANCE 0
+#define AREA_ORDER_NAME 1
+
+/*
+    AREA_THREADS:
+        - Default number of threads (including the calling thread) used by citiesWithinBatch().
+*/
+#define AREA_THREADS 4
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            PUBLIC AREA STRUCTURES
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Area Structure:
+        - An area refers to the node ids of the graph it was found on, so it must be displayed before
+            the network it came from is changed.
+
+        graph           - Graph the area was found on (used to print city names).
+        start           - Node id of the start city.
+        maxDistance     - Largest distance from the start city within the area.
+        count           - Number of cities within the area, including the start city.
+        nodes           - Node ids of the cities within the area.
+        distances       - Shortest distance from the start city to each city.
+*/
+struct Area
+{
+    struct Graph* graph;
+    int start;
+    int maxDistance;
+
+    int count;
+    int* nodes;
+    int* distances;
+};
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        PUBLIC AREA FUNCTION DECLARATIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Finds every city within a given distance of a city present within a network.
+struct Area* citiesWithin(struct Network* cityNetwork, const char* cityStartName, int maxDistance, int order);
+
+// Finds every node within a given distance of a node id using a given search workspace.
+struct Area* searchCitiesWithin(struct Search* search, int startId, int maxDistance, int order);
+
+// Finds the area of each of many cities present within a network across a given number of threads.
+struct Area** citiesWithinBatch(struct Network* cityNetwork, char cityStartNames[][127], int numStarts, int maxDistance,
+                                int order, int numThreads);
+
+// Frees memory associated with a given area.
+void areaDestructor(struct Area* area);
+
+// Frees memory associated with the areas returned by citiesWithinBatch().
+void areasDestructor(struct Area** areas, int numStarts);
+
+// Displays the cities within a given area and their distances.
+void displayArea(struct Area* area);
+
+#endif // AREA_H_INCLUDED
@@ -4,15 +4,26 @@
 arrayList.c:
         - Source file defining the functions to create and and control array lists.
         - Implemented within 'graphNetwork.c' for storing connections between nodes.
+        - Each path is stored twice (once in each city's list), every entry records the index of its
+            twin entry so a path can be removed from both lists in constant time.
+        - Entities are stored as a structure of arrays (cities, distances and twins in separate
+            contiguous arrays), each padded to a multiple of LIST_SIMD_WIDTH entries so whole rows of
+            distances can be loaded into vector registers.
         - (Code referenced and adapted from Andrew Turner - Reference [6])
 
         - Functions:
+            - listArrayAllocate
             - listConstructor
             - listDestructor
-            - listAdd
-            - listRemove
+            - listAppend
+            - listAddPath
+            - listUnlink
+            - listRemovePath
             - listSearch
+            - listFind
             - getListEntity
+            - listCities
+            - listDistances
             - listDisplay
             - listResize
             - listSize
@@ -28,31 +39,24 @@ arrayList.c:
                                             LIST STRUCTURES
 * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
 
-/*
-    cityConnection Structure:
-        - Internal custom entity structure.
-        - Used to store the relative city connection information as individual entities within a list.
-
-        city        - Pointer to a node in a given network.
-        distance    - Integer distance between given node and the node within cityConnection structure.
-*/
-struct cityConnection
-{
-    struct Node* city;
-    int distance;
-};
-
 /*
     List Structure:
-        capacity        - Maximum length of the list.
+        - Each path entry is spread across the three arrays at the same index (structure of arrays).
+        - Slots from 'numEntities' up to 'capacity' are padding, their distance is LIST_PAD_DISTANCE.
+
+        capacity        - Maximum length of the list (always a multiple of LIST_SIMD_WIDTH).
         numEntities     - Current number of entities within a give list.
-        entities        - Array of individual pointer entities, each of the cityConnection structure.
+        cities          - Pointer to each connected node in the network.
+        distances       - Integer distance between the list's node and each connected node.
+        twins           - Index of the reverse entry (same path) within each connected node's list.
 */
 struct List
 {
     int capacity;
     int numEntities;
-    struct cityConnection* entities;
+    struct Node** cities;
+    int* distances;
+    int* twins;
 };
 
 
@@ -60,6 +64,17 @@ struct List
                                         LIST CONSTRUCTORS/DESTRUCTORS
 * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
 
+/*
+    List Array Allocate:
+        - Allocates one entity array of a given capacity aligned to a full SIMD register.
+        - Returns pointer to new array.
+*/
+static void* listArrayAllocate(int capacity, size_t entitySize)
+{
+    // Capacity is a multiple of LIST_SIMD_WIDTH, so the size is a multiple of the alignment for 4 and 8 byte entities.
+    return aligned_alloc(LIST_SIMD_WIDTH * sizeof(int), capacity * entitySize);
+}
+
 /*
     List Constructor:
         - Allocate memory and create a new list.
@@ -68,15 +83,24 @@ struct List
 struct List* listConstructor()
 {
     struct List* arrayList;
+    int index;
+
+    // Round the initial capacity up to a whole number of SIMD registers.
+    int capacity = ((LIST_CAPACITY + LIST_SIMD_WIDTH - 1) / LIST_SIMD_WIDTH) * LIST_SIMD_WIDTH;
 
     // Reserve memory for the list and for the elements we want to store.
     arrayList = malloc(sizeof(struct List));
-    arrayList->entities = malloc(LIST_CAPACITY * sizeof(struct cityConnection));
+    arrayList->cities = listArrayAllocate(capacity, sizeof(struct Node*));
+    arrayList->distances = listArrayAllocate(capacity, sizeof(int));
+    arrayList->twins = listArrayAllocate(capacity, sizeof(int));
 
-    // Initialise list values.
-    arrayList->capacity = LIST_CAPACITY;
+    // Initialise list values, every slot starts as padding.
+    arrayList->capacity = capacity;
     arrayList->numEntities = 0;
 
+    for (index = 0; index < capacity; index++)
+        arrayList->distances[index] = LIST_PAD_DISTANCE;
+
     // Return new list.
     return arrayList;
 }
@@ -87,7 +111,9 @@ struct List* listConstructor()
 */
 void listDestructor(struct List* list)
 {
-    free(list->entities);
+    free(list->cities);
+    free(list->distances);
+    free(list->twins);
     free(list);
 }
 
@@ -125,8 +151,8 @@ int listIsEmpty(struct List* list)
     List Resize:
         - Function to increase the maximum capacity of a given list once the maximum has been reached.
         - Capacity is stack ever increased by a factor of two.
-        - Used within listAdd() if DYNAMIC_RESIZE from 'network.h' is enabled.
-        - Memory is reallocated.
+        - Used within listAppend() if DYNAMIC_RESIZE from 'network.h' is enabled.
+        - Memory is reallocated, keeping every array aligned and padded to LIST_SIMD_WIDTH.
 */
 void listResize(struct List* list, int newSize)
 {
@@ -134,8 +160,29 @@ void listResize(struct List* list, int newSize)
     if (newSize <= list->capacity)
         return;
 
-    // Reallocate the entities array.
-    list->entities = realloc(list->entities, newSize * sizeof(struct cityConnection));
+    // Keep the capacity a whole number of SIMD registers.
+    newSize = ((newSize + LIST_SIMD_WIDTH - 1) / LIST_SIMD_WIDTH) * LIST_SIMD_WIDTH;
+
+    // Reallocate each array (realloc() does not keep the alignment, so copy into new aligned arrays).
+    struct Node** cities = listArrayAllocate(newSize, sizeof(struct Node*));
+    int* distances = listArrayAllocate(newSize, sizeof(int));
+    int* twins = listArrayAllocate(newSize, sizeof(int));
+
+    memcpy(cities, list->cities, list->numEntities * sizeof(struct Node*));
+    memcpy(distances, list->distances, list->numEntities * sizeof(int));
+    memcpy(twins, list->twins, list->numEntities * sizeof(int));
+
+    int index;
+    for (index = list->numEntities; index < newSize; index++)
+        distances[index] = LIST_PAD_DISTANCE;
+
+    free(list->cities);
+    free(list->distances);
+    free(list->twins);
+
+    list->cities = cities;
+    list->distances = distances;
+    list->twins = twins;
 
     // Update list capacity.
     list->capacity = newSize;
@@ -153,14 +200,14 @@ void listResize(struct List* list, int newSize)
             'index' -> City name found, index within list returned.
             '-1'    -> Node not present in list.
 */
-int listSearch(struct List* list, char cityName[127])
+int listSearch(struct List* list, const char* cityName)
 {
     int index;
 
     // Check each occupied element in the list in turn.
     for (index = 0; index < list->numEntities; index++)
     {
-        struct Node* currentCity = list->entities[index].city;
+        struct Node* currentCity = list->cities[index];
 
         // If the current element matches the requested one return its index.
         if (strcmp(getNodeName(currentCity), cityName) == 0)
@@ -171,6 +218,26 @@ int listSearch(struct List* list, char cityName[127])
     return -1;
 }
 
+/*
+    List Find:
+        - Searches for a node within a list using its node pointer (no string compares).
+        - Returns integer value.
+            'index' -> Node found, index within list returned.
+            '-1'    -> Node not present in list.
+*/
+int listFind(struct List* list, struct Node* city)
+{
+    int index;
+
+    for (index = 0; index < list->numEntities; index++)
+    {
+        if (list->cities[index] == city)
+            return index;
+    }
+
+    return -1;
+}
+
 /*
     Get List Entity:
         - Returns pointer to a node and its path distance a given list and index.
@@ -185,10 +252,30 @@ struct Node* getListEntity(struct List* list, int index, int* pathDistance)
         return NULL;
 
     // Set distance to the requested argument address.
-    *pathDistance = list->entities[index].distance;
+    *pathDistance = list->distances[index];
 
     // Return node at given index.
-    return list->entities[index].city;
+    return list->cities[index];
+}
+
+/*
+    List Cities:
+        - Returns the contiguous array of connected nodes of a given list (listSize() entries are valid).
+*/
+struct Node** listCities(struct List* list)
+{
+    return list->cities;
+}
+
+/*
+    List Distances:
+        - Returns the contiguous array of distances of a given list.
+        - The array is padded with LIST_PAD_DISTANCE up to a multiple of LIST_SIMD_WIDTH entries, so it
+            can be read in whole SIMD registers.
+*/
+int* listDistances(struct List* list)
+{
+    return list->distances;
 }
 
 
@@ -197,61 +284,126 @@ struct Node* getListEntity(struct List* list, int index, int* pathDistance)
 * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
 
 /*
-    List Add:
-        - Adds a new entity to a list using a given node and distance.
+    List Append:
+        - Writes a new entity into the next available slot of a list using a given node, distance and twin index.
         - If DYNAMIC_RESIZE from 'network.h' is enabled, list capacity will double once limit has been reached.
-        - Returns indication if function was successful.
-            '1' -> Entity added to list.
-            '0' -> List is at capacity and DYNAMIC_RESIZE is disabled.
+        - Returns integer value.
+            'index' -> Index of the new entity within the list.
+            '-1'    -> List is at capacity and DYNAMIC_RESIZE is disabled.
 */
-int listAdd(struct List* list, struct Node* city, int distance)
+static int listAppend(struct List* list, struct Node* city, int distance, int twin)
 {
-    // Return '0' if list is full.
+    // Return '-1' if list is full.
     if (list->numEntities >= list->capacity)
     {
         if (DYNAMIC_RESIZE == 0)
         {
-            // List at capacity, return '0' and print failure.
-            printf("Failure: '%s' connection list at capacity! - (listAdd - arrayList.c)\n", getNodeName(city));
+            // List at capacity, return '-1' and print failure.
+            printf("Failure: '%s' connection list at capacity! - (listAddPath - arrayList.c)\n", getNodeName(city));
             printf("\t^ (Enable DYNAMIC_RESIZE or increase ARRAY_LIST_CAPACITY in 'list.h')");
-            return 0;
+            return -1;
         }
 
             // Call list resize function to increase memory for more elements.
         else listResize(list, list->capacity * 2);
     }
 
-    // Write in connected city name and distance in to next available slot in list.
-    list->entities[list->numEntities].city = city;
-    list->entities[list->numEntities].distance = distance;
+    // Write in connected city, distance and twin in to next available slot in list.
+    int index = list->numEntities;
+    list->cities[index] = city;
+    list->distances[index] = distance;
+    list->twins[index] = twin;
 
     // Update entity count.
     list->numEntities++;
 
+    return index;
+}
+
+/*
+    List Add Path:
+        - Adds a path between two given nodes with a given distance to both of their connection lists.
+        - The two entries record each other's index (twins), which listRemovePath() relies on.
+        - Returns indication if function was successful.
+            '1' -> Path added to both lists.
+            '0' -> A list is at capacity and DYNAMIC_RESIZE is disabled.
+*/
+int listAddPath(struct Node* city1, struct Node* city2, int distance)
+{
+    struct List* list1 = getNodeConnections(city1);
+    struct List* list2 = getNodeConnections(city2);
+
+    // Check both lists have room before writing either entry.
+    if (DYNAMIC_RESIZE == 0)
+    {
+        int needed1 = (list1 == list2) ? 2 : 1;
+
+        if (list1->numEntities + needed1 > list1->capacity || list2->numEntities + 1 > list2->capacity)
+        {
+            printf("Failure: '%s' or '%s' connection list at capacity! - (listAddPath - arrayList.c)\n",
+                   getNodeName(city1), getNodeName(city2));
+            printf("\t^ (Enable DYNAMIC_RESIZE or increase ARRAY_LIST_CAPACITY in 'list.h')");
+            return 0;
+        }
+    }
+
+    // Each entry's twin is the next free slot of the other list (one further on for a path to itself).
+    int index1 = list1->numEntities;
+    int index2 = (list1 == list2) ? index1 + 1 : list2->numEntities;
+
+    listAppend(list1, city2, distance, index2);
+    listAppend(list2, city1, distance, index1);
+
     // Indicate success.
     return 1;
 }
 
 /*
-    List Remove:
-        - Unties city node at a given index from the network.
-        - Frees node from memory.
+    List Unlink:
+        - Removes the entity at a given index by moving the last entity into its slot (swap-with-last).
+        - The moved entity's twin is told its new index, keeping every twin index consistent.
+*/
+static void listUnlink(struct List* list, int index)
+{
+    int lastIndex = list->numEntities - 1;
+
+    if (index != lastIndex)
+    {
+        list->cities[index] = list->cities[lastIndex];
+        list->distances[index] = list->distances[lastIndex];
+        list->twins[index] = list->twins[lastIndex];
+
+        getNodeConnections(list->cities[index])->twins[list->twins[index]] = index;
+    }
+
+    // Return the vacated slot to padding and update number of elements in list.
+    list->distances[lastIndex] = LIST_PAD_DISTANCE;
+    list->numEntities--;
+}
+
+/*
+    List Remove Path:
+        - Removes the path at a given index of a list from both connection lists it is stored in.
+        - Constant time, only the two entries and the entries moved into their slots are touched.
         - Returns indication if function was successful.
-            '1' -> City found and removed from network.
-            '0' -> City not present in network.
+            '1' -> Path found and removed from both lists.
+            '0' -> Invalid index within list.
 */
-int listRemove(struct List* list, int index)
+int listRemovePath(struct List* list, int index)
 {
     // If the index is invalid then do nothing.
     if (index < 0 || index >= list->numEntities)
         return 0;
 
-    // Remove entity at given index and shift all entities in front backwards to keep array structure.
-    int elementCount = list->numEntities - index;
-    memmove(&list->entities[index], &list->entities[index+1], elementCount * sizeof(struct cityConnection));
+    struct List* twinList = getNodeConnections(list->cities[index]);
+    int twinIndex = list->twins[index];
 
-    // Update number of elements in list.
-    list->numEntities--;
+    // Removing the entry may move its own twin (a path to itself stored last in the same list).
+    if (twinList == list && twinIndex == list->numEntities - 1)
+        twinIndex = index;
+
+    listUnlink(list, index);
+    listUnlink(twinList, twinIndex);
 
     // Indicate success.
     return 1;
@@ -286,10 +438,10 @@ void listDisplay(struct List* list)
         if (index > 0)
             printf(",");
 
-        struct Node* city = list->entities[index].city;
+        struct Node* city = list->cities[index];
 
         // Print the current city.
-        printf(" %s (%dkm)", getNodeName(city), list->entities[index].distance);
+        printf(" %s (%dkm)", getNodeName(city), list->distances[index]);
     }
 
     // Close array.
@@ -0,0 +1,738 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    batchPipeline.c:
+        - Source file defining the staged pipeline used by 'main.c' to run a whole Dijkstra pairs file.
+        - Three stages run at the same time on their own threads:
+            - Reader    -> Scans city pairs from the pairs file.
+            - Workers   -> Pool of threads, each running searchQuery() with its own search workspace
+                            on the network's frozen graph and formatting the result text.
+            - Writer    -> Writes the results to the results file in the original pair order.
+        - Stages are connected by bounded lock-free queues of item slot numbers, so reading, searching
+            and writing overlap and the pipeline runs at the speed of its slowest stage.
+        - Every stage records its busy and stall (waiting on a neighbouring stage) time, printed
+            as a report at the end so the bottleneck is visible.
+
+        - Functions:
+            - queueConstructor
+            - queueDestructor
+            - queueTryPush
+            - queueTryPop
+            - stageWait
+            - stagePush
+            - stagePop
+            - pipelineScanId
+            - readerStage
+            - workerStage
+            - writerStage
+            - pipelineReport
+            - pipelineRun
+            - dijkstraPipeline
+            - dijkstraPipelineIds
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Include respective header file:
+#include "pipeline.h"
+
+// Edge relaxation kernels (to report the chosen kernel):
+#include "relax.h"
+
+// Thread and atomic libraries:
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdint.h>
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                                PIPELINE STRUCTURES
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    QueueCell Structure:
+        sequence    - Turn counter telling producers and consumers whether the cell is free or full.
+        value       - Item slot number stored within the cell.
+*/
+struct QueueCell
+{
+    atomic_size_t sequence;
+    int value;
+};
+
+/*
+    Queue Structure:
+        - Bounded multi-producer multi-consumer lock-free queue (Dmitry Vyukov's design).
+        - The two positions are kept on separate cache lines so producers and consumers do not contend.
+
+        mask                - Capacity - 1 (capacity is a power of two).
+        cells               - Ring buffer of cells.
+        enqueuePosition     - Next cell to push into.
+        dequeuePosition     - Next cell to pop from.
+*/
+struct Queue
+{
+    size_t mask;
+    struct QueueCell* cells;
+
+    char padding1[64];
+    atomic_size_t enqueuePosition;
+    char padding2[64];
+    atomic_size_t dequeuePosition;
+    char padding3[64];
+};
+
+/*
+    PipelineItem Structure:
+        sequence        - Position of the pair within the pairs file.
+        cityStartName   - Scanned start city name.
+        cityEndName     - Scanned end city name.
+        cityStartId     - Scanned start node id (pairs files of node ids only).
+        cityEndId       - Scanned end node id (pairs files of node ids only).
+        isResolved      - Indication if both cities of a node id pair were scanned as node ids.
+        isSuccessful    - Value returned by searchQuery() or searchQueryIds().
+        text            - Growable buffer holding the formatted result or failure text.
+        textCapacity    - Capacity of the text buffer.
+        algorithmTime   - Search computation time.
+*/
+struct PipelineItem
+{
+    long sequence;
+    char cityStartName[127];
+    char cityEndName[127];
+    int cityStartId;
+    int cityEndId;
+    int isResolved;
+
+    int isSuccessful;
+    char* text;
+    int textCapacity;
+    double algorithmTime;
+};
+
+/*
+    StageStats Structure:
+        items       - Number of pairs passed through the stage.
+        busyTime    - Time spent doing the stage's own work.
+        stallTime   - Time spent waiting on a full or empty neighbouring queue.
+*/
+struct StageStats
+{
+    long items;
+    double busyTime;
+    double stallTime;
+};
+
+/*
+    Pipeline Structure:
+        - State shared between all stages.
+
+        graph           - Frozen graph searched by the workers.
+        pairsFile       - Dijkstra pairs file scanned by the reader.
+        usesIds         - Indication if the pairs file holds node ids instead of city names.
+        resultsFile     - Results file written by the writer.
+        items           - Item slots, each holding one pair while it is in flight.
+        numItems        - Number of item slots.
+        freeQueue       - Slots returned by the writer, ready for the reader.
+        inputQueue      - Slots scanned by the reader, ready for the workers.
+        outputQueue     - Slots searched by the workers, ready for the writer.
+        readerDone      - Set once the reader has scanned the whole file.
+        totalPairs      - Number of pairs scanned, valid once 'readerDone' is set.
+        readerStats     - Reader stage statistics.
+*/
+struct Pipeline
+{
+    struct Graph* graph;
+    FILE* pairsFile;
+    int usesIds;
+    FILE* resultsFile;
+
+    struct PipelineItem* items;
+    int numItems;
+
+    struct Queue* freeQueue;
+    struct Queue* inputQueue;
+    struct Queue* outputQueue;
+
+    atomic_int readerDone;
+    atomic_long totalPairs;
+
+    struct StageStats readerStats;
+};
+
+/*
+    Worker Structure:
+        pipeline    - Shared pipeline state.
+        search      - Worker's own search workspace on the frozen graph.
+        stats       - Worker stage statistics.
+        settled     - Number of cities settled by the worker's searches.
+        thread      - Worker thread handle.
+*/
+struct Worker
+{
+    struct Pipeline* pipeline;
+    struct Search* search;
+    struct StageStats stats;
+    long settled;
+    pthread_t thread;
+};
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                                LOCK-FREE QUEUE FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Queue Constructor:
+        - Allocate memory for a new bounded queue with a given power of two capacity.
+        - Returns pointer to new queue.
+*/
+static struct Queue* queueConstructor(int capacity)
+{
+    struct Queue* queue = malloc(sizeof(struct Queue));
+    size_t index;
+
+    queue->mask = capacity - 1;
+    queue->cells = malloc(capacity * sizeof(struct QueueCell));
+
+    // Each cell starts free for the push of the same turn.
+    for (index = 0; index < (size_t) capacity; index++)
+        atomic_init(&queue->cells[index].sequence, index);
+
+    atomic_init(&queue->enqueuePosition, 0);
+    atomic_init(&queue->dequeuePosition, 0);
+
+    return queue;
+}
+
+/*
+    Queue Destructor:
+        - Free memory associated with a queue.
+*/
+static void queueDestructor(struct Queue* queue)
+{
+    free(queue->cells);
+    free(queue);
+}
+
+/*
+    Queue Try Push:
+        - Attempts to push a value into a queue without blocking.
+            '1' -> Value pushed.
+            '0' -> Queue is full.
+*/
+static int queueTryPush(struct Queue* queue, int value)
+{
+    struct QueueCell* cell;
+    size_t position = atomic_load_explicit(&queue->enqueuePosition, memory_order_relaxed);
+
+    while (1)
+    {
+        cell = &queue->cells[position & queue->mask];
+        size_t sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+        intptr_t difference = (intptr_t) sequence - (intptr_t) position;
+
+        // Cell is free for this turn, try to claim it.
+        if (difference == 0)
+        {
+            if (atomic_compare_exchange_weak_explicit(&queue->enqueuePosition, &position, position + 1,
+                                                      memory_order_relaxed, memory_order_relaxed))
+                break;
+        }
+
+        // Cell still holds last turn's value, queue is full.
+        else if (difference < 0)
+            return 0;
+
+        // Another producer claimed the cell, reload the position.
+        else position = atomic_load_explicit(&queue->enqueuePosition, memory_order_relaxed);
+    }
+
+    cell->value = value;
+    atomic_store_explicit(&cell->sequence, position + 1, memory_order_release);
+
+    return 1;
+}
+
+/*
+    Queue Try Pop:
+        - Attempts to pop a value from a queue without blocking.
+        - Function returns the value to the given address argument.
+            '1' -> Value popped.
+            '0' -> Queue is empty.
+*/
+static int queueTryPop(struct Queue* queue, int* value)
+{
+    struct QueueCell* cell;
+    size_t position = atomic_load_explicit(&queue->dequeuePosition, memory_order_relaxed);
+
+    while (1)
+    {
+        cell = &queue->cells[position & queue->mask];
+        size_t sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+        intptr_t difference = (intptr_t) sequence - (intptr_t) (position + 1);
+
+        // Cell is full for this turn, try to claim it.
+        if (difference == 0)
+        {
+            if (atomic_compare_exchange_weak_explicit(&queue->dequeuePosition, &position, position + 1,
+                                                      memory_order_relaxed, memory_order_relaxed))
+                break;
+        }
+
+        // Cell has not been pushed yet, queue is empty.
+        else if (difference < 0)
+            return 0;
+
+        // Another consumer claimed the cell, reload the position.
+        else position = atomic_load_explicit(&queue->dequeuePosition, memory_order_relaxed);
+    }
+
+    *value = cell->value;
+    atomic_store_explicit(&cell->sequence, position + queue->mask + 1, memory_order_release);
+
+    return 1;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                                STAGE HELPER FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Stage Wait:
+        - Called each time a stage finds its neighbouring queue full or empty.
+        - Spins briefly before yielding the processor, starting the stall clock on the first call.
+*/
+static void stageWait(int* spins, double* stallStart)
+{
+    if (*spins == 0)
+        *stallStart = timerNow();
+
+    (*spins)++;
+
+    if (*spins > 64)
+        sched_yield();
+}
+
+/*
+    Stage Push:
+        - Pushes an item slot into a queue, waiting while the queue is full.
+        - Waiting time is added to the given stage's stall time.
+*/
+static void stagePush(struct Queue* queue, int slot, struct StageStats* stats)
+{
+    int spins = 0;
+    double stallStart = 0;
+
+    while (queueTryPush(queue, slot) == 0)
+        stageWait(&spins, &stallStart);
+
+    if (spins > 0)
+        stats->stallTime += timerNow() - stallStart;
+}
+
+/*
+    Stage Pop:
+        - Pops an item slot from a queue, waiting while the queue is empty.
+        - Gives up once the queue is empty and the given 'isDone' flag is set.
+        - Waiting time is added to the given stage's stall time.
+            '1' -> Slot popped.
+            '0' -> Upstream stage finished and queue drained.
+*/
+static int stagePop(struct Queue* queue, int* slot, struct StageStats* stats, atomic_int* isDone)
+{
+    int spins = 0;
+    double stallStart = 0;
+    int isPopped = 0;
+
+    while (isPopped == 0)
+    {
+        if (queueTryPop(queue, slot) == 1)
+            isPopped = 1;
+
+        // Upstream finished, check once more as its last push may have landed before the flag.
+        else if (atomic_load(isDone) == 1)
+        {
+            if (queueTryPop(queue, slot) == 1)
+                isPopped = 1;
+            else
+                break;
+        }
+
+        else stageWait(&spins, &stallStart);
+    }
+
+    if (spins > 0)
+        stats->stallTime += timerNow() - stallStart;
+
+    return isPopped;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                                PIPELINE STAGES
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Pipeline Scan Id:
+        - Reads a scanned word of a node id pairs file as a node id. Cities that could not be resolved
+            are written as their name instead (see handlesWritePairs()).
+        - Returns indication if the word is a node id.
+            '1' -> Node id read.
+            '0' -> Word is a city name ('id' set to '-1').
+*/
+static int pipelineScanId(const char* word, int* id)
+{
+    char* end;
+    long value = strtol(word, &end, 10);
+
+    if (end == word || *end != '\0')
+    {
+        *id = -1;
+        return 0;
+    }
+
+    *id = (int) value;
+    return 1;
+}
+
+/*
+    Reader Stage:
+        - Scans each pair of the pairs file (city names, or node ids) into a free item slot and passes
+            it to the workers.
+        - Waits for the writer to return a slot when every slot is in flight.
+*/
+static void* readerStage(void* argument)
+{
+    struct Pipeline* pipeline = argument;
+    struct StageStats* stats = &pipeline->readerStats;
+    atomic_int neverDone = 0;
+    long sequence = 0;
+    int slot;
+
+    double timeStart = timerNow();
+
+    while (stagePop(pipeline->freeQueue, &slot, stats, &neverDone) == 1)
+    {
+        struct PipelineItem* item = &pipeline->items[slot];
+
+        // Scan next line of the pairs file, stop at the end of the file.
+        if (pipeline->usesIds == 1)
+        {
+            if (2 != fscanf(pipeline->pairsFile, " %126s %126s", item->cityStartName, item->cityEndName))
+                break;
+
+            item->isResolved = pipelineScanId(item->cityStartName, &item->cityStartId);
+            item->isResolved = pipelineScanId(item->cityEndName, &item->cityEndId) && item->isResolved;
+        }
+
+        else if (2 != fscanf(pipeline->pairsFile, " %126s %126s", item->cityStartName, item->cityEndName))
+            break;
+
+        item->sequence = sequence++;
+        stagePush(pipeline->inputQueue, slot, stats);
+    }
+
+    stats->items = sequence;
+    stats->busyTime = timerNow() - timeStart - stats->stallTime;
+
+    // Tell the workers and the writer how many pairs to expect.
+    atomic_store(&pipeline->totalPairs, sequence);
+    atomic_store(&pipeline->readerDone, 1);
+
+    return NULL;
+}
+
+/*
+    Worker Stage:
+        - Takes scanned pairs, runs Dijkstra's algorithm with the worker's own search workspace
+            and formats the result into the item's text buffer.
+        - Pairs of node ids go straight to searchQueryIds(), no city name is looked up. A pair holding
+            a city that was never resolved goes to searchQuery() by name instead, so it fails by name.
+*/
+static void* workerStage(void* argument)
+{
+    struct Worker* worker = argument;
+    struct Pipeline* pipeline = worker->pipeline;
+    int slot;
+
+    double timeStart = timerNow();
+
+    while (stagePop(pipeline->inputQueue, &slot, &worker->stats, &pipeline->readerDone) == 1)
+    {
+        struct PipelineItem* item = &pipeline->items[slot];
+
+        if (pipeline->usesIds == 1 && item->isResolved == 1)
+            item->isSuccessful = searchQueryIds(worker->search, item->cityStartId, item->cityEndId,
+                                                &item->text, &item->textCapacity, &item->algorithmTime);
+
+        else
+        {
+            // Name the resolved city of a partly resolved pair.
+            if (pipeline->usesIds == 1 && item->cityStartId >= 0 && item->cityStartId < pipeline->graph->numNodes)
+                snprintf(item->cityStartName, sizeof(item->cityStartName), "%s", graphCityName(pipeline->graph, item->cityStartId));
+
+            if (pipeline->usesIds == 1 && item->cityEndId >= 0 && item->cityEndId < pipeline->graph->numNodes)
+                snprintf(item->cityEndName, sizeof(item->cityEndName), "%s", graphCityName(pipeline->graph, item->cityEndId));
+
+            item->isSuccessful = searchQuery(worker->search, item->cityStartName, item->cityEndName,
+                                             &item->text, &item->textCapacity, &item->algorithmTime);
+        }
+
+        worker->settled += worker->search->settledCount;
+        worker->stats.items++;
+        stagePush(pipeline->outputQueue, slot, &worker->stats);
+    }
+
+    worker->stats.busyTime = timerNow() - timeStart - worker->stats.stallTime;
+
+    return NULL;
+}
+
+/*
+    Writer Stage:
+        - Writes finished results to the results file (and terminal) in the order of the pairs file.
+        - Results finishing early wait in a reorder window until every earlier result has been written.
+        - Runs on the calling thread.
+*/
+static void writerStage(struct Pipeline* pipeline, struct StageStats* stats, double* dijkstraTotalTime)
+{
+    long nextSequence = 0;
+    int slot;
+    int spins = 0;
+    double stallStart = 0;
+
+    // Slot waiting to be written for each sequence within the reorder window ('-1' if not finished yet).
+    int* pending = malloc(pipeline->numItems * sizeof(int));
+    memset(pending, -1, pipeline->numItems * sizeof(int));
+
+    double timeStart = timerNow();
+
+    while (atomic_load(&pipeline->readerDone) == 0 || nextSequence < atomic_load(&pipeline->totalPairs))
+    {
+        if (queueTryPop(pipeline->outputQueue, &slot) == 0)
+        {
+            stageWait(&spins, &stallStart);
+            continue;
+        }
+
+        if (spins > 0)
+            stats->stallTime += timerNow() - stallStart;
+        spins = 0;
+
+        // Place the finished slot in the reorder window.
+        pending[pipeline->items[slot].sequence % pipeline->numItems] = slot;
+
+        // Write every result that is now next in order.
+        while (pending[nextSequence % pipeline->numItems] != -1)
+        {
+            int readySlot = pending[nextSequence % pipeline->numItems];
+            struct PipelineItem* item = &pipeline->items[readySlot];
+
+            pending[nextSequence % pipeline->numItems] = -1;
+
+            // Failures are only printed to the terminal, as in dijkstra().
+            if (item->isSuccessful == 1)
+            {
+                fputs(item->text, pipeline->resultsFile);
+                *dijkstraTotalTime += item->algorithmTime;
+
+                if (PIPELINE_ECHO == 1)
+                    fputs(item->text, stdout);
+            }
+            else fputs(item->text, stdout);
+
+            // Hand the slot back to the reader.
+            stagePush(pipeline->freeQueue, readySlot, stats);
+
+            stats->items++;
+            nextSequence++;
+        }
+    }
+
+    if (spins > 0)
+        stats->stallTime += timerNow() - stallStart;
+
+    stats->busyTime = timerNow() - timeStart - stats->stallTime;
+
+    free(pending);
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                                PIPELINE FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Pipeline Report:
+        - Prints each stage's throughput (pairs per busy second) and stall time to the terminal, and
+            the number of cities settled by the workers.
+        - The worker stage's throughput is the sum of its workers', the stage with the lowest
+            throughput is the bottleneck of the pipeline.
+*/
+static void pipelineReport(struct Pipeline* pipeline, struct Worker* workers, int numWorkers,
+                           struct StageStats* writerStats, double wallTime)
+{
+    int index;
+    double workerRate = 0;
+    double workerStall = 0;
+    long workerSettled = 0;
+
+    printf("\nPIPELINE STAGE REPORT - (%ld pairs in %fs, %.0f pairs/s, %s relax kernel)\n",
+           writerStats->items, wallTime, wallTime > 0 ? writerStats->items / wallTime : 0, relaxKernelName());
+
+    double readerRate = pipeline->readerStats.busyTime > 0 ? pipeline->readerStats.items / pipeline->readerStats.busyTime : 0;
+    printf("\tReader    : %ld pairs, busy %fs, stalled %fs, %.0f pairs/s\n", pipeline->readerStats.items,
+           pipeline->readerStats.busyTime, pipeline->readerStats.stallTime, readerRate);
+
+    for (index = 0; index < numWorkers; index++)
+    {
+        struct StageStats* stats = &workers[index].stats;
+        double rate = stats->busyTime > 0 ? stats->items / stats->busyTime : 0;
+
+        printf("\tWorker %-2d : %ld pairs, busy %fs, stalled %fs, %.0f pairs/s\n",
+               index + 1, stats->items, stats->busyTime, stats->stallTime, rate);
+
+        workerRate += rate;
+        workerStall += stats->stallTime;
+        workerSettled += workers[index].settled;
+    }
+
+    double writerRate = writerStats->busyTime > 0 ? writerStats->items / writerStats->busyTime : 0;
+    printf("\tWriter    : %ld pairs, busy %fs, stalled %fs, %.0f pairs/s\n", writerStats->items,
+           writerStats->busyTime, writerStats->stallTime, writerRate);
+
+    // Name the slowest stage.
+    char* slowestStage = "Reader";
+    double slowestRate = readerRate;
+
+    if (workerRate < slowestRate)
+    {
+        slowestStage = "Workers";
+        slowestRate = workerRate;
+    }
+
+    if (writerRate < slowestRate)
+    {
+        slowestStage = "Writer";
+        slowestRate = writerRate;
+    }
+
+    printf("\tWorkers combined: %.0f pairs/s, stalled %fs, %ld cities settled\n", workerRate, workerStall, workerSettled);
+    printf("\tSlowest stage: %s (%.0f pairs/s)\n", slowestStage, slowestRate);
+}
+
+/*
+    Pipeline Run:
+        - Runs every pair of a pairs file of city names or node ids through the reader, worker and
+            writer stages.
+        - Returns the number of pairs scanned from the pairs file.
+*/
+static int pipelineRun(FILE* dijkstrapairs_file, int usesIds, FILE* dijkstraresults_file, struct Network* cityNetwork,
+                       int numWorkers, double* dijkstraTotalTime)
+{
+    int index;
+    struct Pipeline pipeline;
+    struct StageStats writerStats = {0, 0, 0};
+    pthread_t readerThread;
+
+    if (numWorkers < 1)
+        numWorkers = 1;
+
+    // Freeze the network once on this thread, every worker then searches the same graph.
+    pipeline.graph = networkFreeze(cityNetwork);
+
+    // Component labels of the frozen graph, shared by every workspace (the network is not changed meanwhile).
+    int* labels = networkSearch(cityNetwork)->component;
+    pipeline.pairsFile = dijkstrapairs_file;
+    pipeline.usesIds = usesIds;
+    pipeline.resultsFile = dijkstraresults_file;
+
+    // Create item slots and the queues between stages, every slot starts free.
+    pipeline.numItems = 2 * PIPELINE_QUEUE_CAPACITY;
+    pipeline.items = calloc(pipeline.numItems, sizeof(struct PipelineItem));
+    pipeline.freeQueue = queueConstructor(pipeline.numItems);
+    pipeline.inputQueue = queueConstructor(PIPELINE_QUEUE_CAPACITY);
+    pipeline.outputQueue = queueConstructor(PIPELINE_QUEUE_CAPACITY);
+
+    for (index = 0; index < pipeline.numItems; index++)
+        queueTryPush(pipeline.freeQueue, index);
+
+    atomic_init(&pipeline.readerDone, 0);
+    atomic_init(&pipeline.totalPairs, 0);
+    memset(&pipeline.readerStats, 0, sizeof(struct StageStats));
+
+    // Create the workers, each with its own search workspace, the same component labels and per-query limits.
+    struct Worker* workers = calloc(numWorkers, sizeof(struct Worker));
+    struct SearchLimits limits = { PIPELINE_TIME_LIMIT, PIPELINE_MAX_SETTLED, NULL };
+
+    for (index = 0; index < numWorkers; index++)
+    {
+        workers[index].pipeline = &pipeline;
+        workers[index].search = searchConstructor(pipeline.graph);
+        workers[index].search->component = labels;
+        searchSetLimits(workers[index].search, &limits);
+    }
+
+    double timeStart = timerNow();
+
+    // Start the reader and worker stages, the writer runs on this thread.
+    pthread_create(&readerThread, NULL, readerStage, &pipeline);
+
+    for (index = 0; index < numWorkers; index++)
+        pthread_create(&workers[index].thread, NULL, workerStage, &workers[index]);
+
+    writerStage(&pipeline, &writerStats, dijkstraTotalTime);
+
+    pthread_join(readerThread, NULL);
+
+    for (index = 0; index < numWorkers; index++)
+        pthread_join(workers[index].thread, NULL);
+
+    double wallTime = timerNow() - timeStart;
+
+    pipelineReport(&pipeline, workers, numWorkers, &writerStats, wallTime);
+
+    // Free memory associated with the pipeline.
+    for (index = 0; index < numWorkers; index++)
+        searchDestructor(workers[index].search);
+
+    for (index = 0; index < pipeline.numItems; index++)
+        free(pipeline.items[index].text);
+
+    free(workers);
+    free(pipeline.items);
+    queueDestructor(pipeline.freeQueue);
+    queueDestructor(pipeline.inputQueue);
+    queueDestructor(pipeline.outputQueue);
+
+    return (int) atomic_load(&pipeline.totalPairs);
+}
+
+/*
+    Dijkstra Pipeline:
+        - Runs every pair of a Dijkstra pairs file through the reader, worker and writer stages.
+        - Results are written to the results file in the same order and format as repeated dijkstra() calls.
+        - Adds the computation time of every search to the 'dijkstraTotalTime' pointer argument.
+        - Returns the number of pairs scanned from the pairs file.
+*/
+int dijkstraPipeline(FILE* dijkstrapairs_file, FILE* dijkstraresults_file, struct Network* cityNetwork,
+                     int numWorkers, double* dijkstraTotalTime)
+{
+    return pipelineRun(dijkstrapairs_file, 0, dijkstraresults_file, cityNetwork, numWorkers, dijkstraTotalTime);
+}
+
+/*
+    Dijkstra Pipeline Ids:
+        - Runs dijkstraPipeline() on a pairs file whose lines hold two node ids ('startId endId') of the
+            network's frozen graph, as written by handlesWritePairs() (see 'handle.h').
+        - A city written by name (not found when the file was written) fails by name in place.
+        - Node ids are only valid for the network version they were resolved on.
+        - Returns the number of pairs scanned from the pairs file.
+*/
+int dijkstraPipelineIds(FILE* dijkstrapairs_file, FILE* dijkstraresults_file, struct Network* cityNetwork,
+                        int numWorkers, double* dijkstraTotalTime)
+{
+    return pipelineRun(dijkstrapairs_file, 1, dijkstraresults_file, cityNetwork, numWorkers, dijkstraTotalTime);
+}
@@ -0,0 +1,121 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    cache.h:
+        - Header file for the 'sourceCache.c' source file.
+        - Defines the public functions to keep the complete shortest path trees of the most frequently
+            queried cities in a memory bounded cache, answering their queries without a search.
+        - Contains the 'SourceCache' structure.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+#ifndef CACHE_H_INCLUDED
+#define CACHE_H_INCLUDED
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        CACHE LIBRARIES/DEFINITIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// User Created Search Library:
+#include "search.h"
+
+/*
+    CACHE_ADMIT_FREQUENCY:
+        - Number of times a city has to be queried before its tree is worth building, so cities
+            queried only once never push a hot city out.
+*/
+#define CACHE_ADMIT_FREQUENCY 2
+
+/*
+    CACHE_EVICT_MARGIN:
+        - Percentage more often a city has to be queried than the least queried cached city to take
+            its place, so cities queried about as often do not keep evicting each other's trees.
+*/
+#define CACHE_EVICT_MARGIN 50
+
+/*
+    CACHE_AGING_QUERIES:
+        - Every city's query count is halved after this many queries, so cities that were hot once
+            make way for the cities hot now.
+*/
+#define CACHE_AGING_QUERIES 4096
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        PUBLIC CACHE STRUCTURES
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    SourceCache Structure:
+        - Holds the distance and back arrays of a complete search from each cached city (its shortest
+            path tree). Paths are undirected, so a tree answers every query starting or ending at its city.
+        - Every query counts towards both of its cities (LFU). A query missing the cache builds the tree of
+            its most queried city once that city is queried often enough and clearly more than the least
+            queried cached city, which is evicted to make room. Otherwise the query is searched as usual.
+        - Built for one frozen graph and not thread safe, a new cache is needed once the network changes.
+
+        graph           - Graph the trees were searched on.
+        search          - Search workspace used for misses and for building trees.
+        capacity        - Number of trees that fit within the memory limit.
+        numTrees        - Number of trees cached.
+        treeSource      - City (node id) of each cached tree.
+        treeDistance    - Distance from the tree's city to each node id ('INT_MAX' if unreachable).
+        treeBack        - Previous node id via the shortest path from the tree's city ('-1' for itself or unreachable).
+        slot            - Cache slot of each node id's tree ('-1' if not cached).
+        frequency       - Aged query count of each node id.
+
+        (For the cache report)
+        maxBytes        - Memory limit of the trees.
+        numQueries      - Number of queries answered.
+        sourceHits      - Queries answered from the tree of their start city.
+        targetHits      - Queries answered from the tree of their end city.
+        numAdmitted     - Trees built.
+        numEvicted      - Trees evicted to make room.
+        searchTime      - Time spent searching (misses and tree builds) in seconds.
+*/
+struct SourceCache
+{
+    struct Graph* graph;
+    struct Search* search;
+
+    int capacity;
+    int numTrees;
+    int* treeSource;
+    int** treeDistance;
+    int** treeBack;
+
+    int* slot;
+    int* frequency;
+
+    // For the cache report.
+    size_t maxBytes;
+    long long numQueries;
+    long long sourceHits;
+    long long targetHits;
+    long long numAdmitted;
+    long long numEvicted;
+    double searchTime;
+};
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                    PUBLIC CACHE FUNCTION DECLARATIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Creates an empty cache of shortest path trees on a graph within a given memory limit in bytes.
+struct SourceCache* sourceCacheConstructor(struct Graph* graph, size_t maxBytes);
+
+// Frees memory associated with a given cache.
+void sourceCacheDestructor(struct SourceCache* cache);
+
+// Returns the shortest distance between two node ids, from a cached tree when possible.
+int sourceCacheDistance(struct SourceCache* cache, int startId, int endId);
+
+// Writes the node ids of the path between two node ids from a cached tree, returns the number of nodes.
+int sourceCachePath(struct SourceCache* cache, int startId, int endId, int* path);
+
+// Prints the cache's hit rates, trees and memory use.
+void sourceCacheReport(struct SourceCache* cache);
+
+#endif // CACHE_H_INCLUDED
@@ -0,0 +1,188 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    cityHandles.c:
+        - Source file defining the functions to resolve city names into handles once and to query by handle.
+        - Every name based query hashes and compares both city names before searching. Callers repeating
+            the same cities resolve them once, then only the (version checked) node ids are passed on.
+        - Pairs files can be rewritten as node ids, so dijkstraPipelineIds() runs them without any
+            name lookup (see 'pipeline.h').
+
+        - Functions:
+            - cityHandle
+            - cityHandles
+            - handleIsValid
+            - dijkstraHandles
+            - handleDistance
+            - handlesWritePairs
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Include respective header file:
+#include "handle.h"
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            HANDLE RESOLVING FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    City Handle:
+        - Resolves a given city name into its node id within the network's frozen graph.
+        - Flags an error if the city isn't present within the network.
+        - Returns the handle, its id being '-1' on failure.
+*/
+struct CityHandle cityHandle(struct Network* cityNetwork, const char* cityName)
+{
+    struct CityHandle handle;
+
+    handle.id = graphCityIndex(networkFreeze(cityNetwork), cityName);
+    handle.version = networkVersion(cityNetwork);
+
+    // Error flagging system:
+
+    if (handle.id < 0)
+        printf("Failure: City '%s' not found in network! - (cityHandle - cityHandles.c)\n", cityName);
+
+    return handle;
+}
+
+/*
+    City Handles:
+        - Resolves every given city name into the handle of the same index.
+        - Flags an error for each city that isn't present within the network (its id is '-1').
+        - Returns the number of cities found.
+*/
+int cityHandles(struct Network* cityNetwork, char cityNames[][127], int numCities, struct CityHandle* handles)
+{
+    struct Graph* graph = networkFreeze(cityNetwork);
+    int version = networkVersion(cityNetwork);
+    int numFound = 0;
+    int index;
+
+    for (index = 0; index < numCities; index++)
+    {
+        handles[index].id = graphCityIndex(graph, cityNames[index]);
+        handles[index].version = version;
+
+        if (handles[index].id < 0)
+            printf("Failure: City '%s' not found in network! - (cityHandles - cityHandles.c)\n", cityNames[index]);
+
+        else numFound++;
+    }
+
+    return numFound;
+}
+
+/*
+    Handle Is Valid:
+        - Checks a handle against the network's current version.
+            '1' -> Handle found and resolved on the current version.
+            '0' -> City not found, or the network has changed since it was resolved.
+*/
+int handleIsValid(struct Network* cityNetwork, struct CityHandle handle)
+{
+    if (handle.id < 0 || handle.version != networkVersion(cityNetwork))
+        return 0;
+
+    return 1;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            HANDLE QUERY FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Dijkstra Handles:
+        - Performs dijkstra() between two city handles, printing and writing exactly the same results.
+        - Flags an error if either handle is invalid or was resolved on an older network version.
+        - Returns indication if function was successful.
+            '1' -> Network scanned - Path found or cities are unreachable.
+            '0' -> Handles invalid or out of date / Network is too small.
+*/
+int dijkstraHandles(FILE* dijkstraresults_file, double* algorithmTime, struct Network* cityNetwork,
+                    struct CityHandle cityStart, struct CityHandle cityEnd)
+{
+    *algorithmTime = 0;
+
+    // Error flagging system:
+
+    if (handleIsValid(cityNetwork, cityStart) == 0 || handleIsValid(cityNetwork, cityEnd) == 0)
+    {
+        printf("Failure: City handles not found or resolved on an older network version! - (dijkstraHandles - cityHandles.c)\n");
+        return 0;
+    }
+
+    // Run the search and format its results.
+    struct Search* search = networkSearch(cityNetwork);
+    char* text = NULL;
+    int textCapacity = 0;
+    int isSuccessful = searchQueryIds(search, cityStart.id, cityEnd.id, &text, &textCapacity, algorithmTime);
+
+    // Failures are only printed to the terminal.
+    printf("%s", text);
+
+    if (isSuccessful == 1)
+        fprintf(dijkstraresults_file, "%s", text);
+
+    free(text);
+
+    return isSuccessful;
+}
+
+/*
+    Handle Distance:
+        - Finds the shortest distance between two city handles with the network's search workspace,
+            the path can be read back with searchPath() until the workspace is next used.
+        - Returns the distance ('INT_MAX' if unreachable or the search expired, see searchSetLimits()),
+            or '-1' if either handle is invalid or out of date.
+*/
+int handleDistance(struct Network* cityNetwork, struct CityHandle cityStart, struct CityHandle cityEnd)
+{
+    if (handleIsValid(cityNetwork, cityStart) == 0 || handleIsValid(cityNetwork, cityEnd) == 0)
+        return -1;
+
+    struct Search* search = networkSearch(cityNetwork);
+
+    if (searchShortestPath(search, cityStart.id, cityEnd.id) == 0)
+        return INT_MAX;
+
+    return searchDistance(search, cityEnd.id);
+}
+
+/*
+    Handles Write Pairs:
+        - Scans every pair of a Dijkstra pairs file of city names and writes the same pairs as node ids
+            ('startId endId' per line) for dijkstraPipelineIds().
+        - A city that isn't present within the network is written by name instead, so the pair still
+            fails in place (by name) within dijkstraPipelineIds().
+        - The ids are only valid until the network next changes.
+        - Returns the number of pairs written.
+*/
+int handlesWritePairs(FILE* namePairs_file, FILE* idPairs_file, struct Network* cityNetwork)
+{
+    struct Graph* graph = networkFreeze(cityNetwork);
+    char cityStartName[127], cityEndName[127];
+    int numPairs = 0;
+
+    while (2 == fscanf(namePairs_file, " %126s %126s", cityStartName, cityEndName))
+    {
+        int cityStartId = graphCityIndex(graph, cityStartName);
+        int cityEndId = graphCityIndex(graph, cityEndName);
+
+        if (cityStartId >= 0)
+            fprintf(idPairs_file, "%d\t", cityStartId);
+
+        else fprintf(idPairs_file, "%s\t", cityStartName);
+
+        if (cityEndId >= 0)
+            fprintf(idPairs_file, "%d\n", cityEndId);
+
+        else fprintf(idPairs_file, "%s\n", cityEndName);
+
+        numPairs++;
+    }
+
+    return numPairs;
+}
@@ -0,0 +1,553 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    compactGraph.c:
+        - Source file defining the functions to create and read compact read-only graphs.
+        - A graph is a frozen copy of a network in compressed sparse row form: every node's edges are
+            stored contiguously, so the search engines read whole adjacency rows without pointer chasing.
+        - Graphs are never modified once built, so any number of threads can query one graph at the same time.
+        - Built from a network by networkFreeze() in 'graphNetwork.c', or generated synthetically
+            by graphGenerate() to test the search engines on graphs far larger than the data files.
+
+        - Functions:
+            - graphConstructor
+            - graphDestructor
+            - graphSetName
+            - graphHashName
+            - graphBuildIndex
+            - graphCityIndex
+            - graphCityName
+            - graphCopyNames
+            - graphDegree
+            - graphEdgeWeight
+            - graphRandom
+            - graphGenerate
+            - graphCompareKeys
+            - graphOrder
+            - graphPermute
+            - graphReorder
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Include respective header file:
+#include "graph.h"
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            GRAPH CONSTRUCTORS/DESTRUCTORS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Graph Constructor:
+        - Allocate memory for a new graph with a given number of nodes, directed edges and name characters.
+        - Row and name arrays are left for the caller to fill in.
+        - Returns pointer to new graph.
+*/
+struct Graph* graphConstructor(int numNodes, int numEdges, int namePoolSize)
+{
+    struct Graph* graph = malloc(sizeof(struct Graph));
+
+    graph->numNodes = numNodes;
+    graph->numEdges = numEdges;
+
+    // Reserve memory for the adjacency rows, aligned and padded to whole SIMD registers.
+    int paddedEdges = ((numEdges + GRAPH_SIMD_WIDTH - 1) / GRAPH_SIMD_WIDTH + 1) * GRAPH_SIMD_WIDTH;
+    int index;
+
+    graph->rowStart = calloc(numNodes + 1, sizeof(int));
+    graph->targets = aligned_alloc(GRAPH_SIMD_WIDTH * sizeof(int), paddedEdges * sizeof(int));
+    graph->weights = aligned_alloc(GRAPH_SIMD_WIDTH * sizeof(int), paddedEdges * sizeof(int));
+
+    for (index = numEdges; index < paddedEdges; index++)
+    {
+        graph->targets[index] = 0;
+        graph->weights[index] = LIST_PAD_DISTANCE;
+    }
+
+    // Reserve memory for the names, 'nameOffset[numNodes]' tracks the used length of the pool.
+    graph->nameOffset = calloc(numNodes + 1, sizeof(int));
+    graph->namePool = malloc((namePoolSize > 0 ? namePoolSize : 1) * sizeof(char));
+
+    // Name index is built once all names are known.
+    graph->hashSize = 0;
+    graph->hashTable = NULL;
+
+    // Return new graph.
+    return graph;
+}
+
+/*
+    Graph Destructor:
+        - Free memory associated with a graph.
+*/
+void graphDestructor(struct Graph* graph)
+{
+    if (graph == NULL)
+        return;
+
+    free(graph->rowStart);
+    free(graph->targets);
+    free(graph->weights);
+    free(graph->nameOffset);
+    free(graph->namePool);
+    free(graph->hashTable);
+    free(graph);
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                                GRAPH NAME FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Graph Set Name:
+        - Appends the name of a given node id to the graph's name pool.
+        - Nodes must be named in increasing id order, starting at '0'.
+*/
+void graphSetName(struct Graph* graph, int id, const char* cityName)
+{
+    int length = strlen(cityName) + 1;
+
+    graph->nameOffset[id] = graph->nameOffset[graph->numNodes];
+    memcpy(&graph->namePool[graph->nameOffset[id]], cityName, length);
+    graph->nameOffset[graph->numNodes] += length;
+}
+
+/*
+    Graph Hash Name:
+        - Returns the FNV-1a hash of a given city name.
+*/
+static unsigned int graphHashName(const char* cityName)
+{
+    unsigned int hash = 2166136261u;
+
+    while (*cityName != '\0')
+    {
+        hash ^= (unsigned char) *cityName++;
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+/*
+    Graph Build Index:
+        - Builds the open addressing name table used by graphCityIndex().
+        - Table size is the first power of two at least twice the number of nodes.
+*/
+void graphBuildIndex(struct Graph* graph)
+{
+    int id;
+
+    free(graph->hashTable);
+
+    graph->hashSize = 16;
+    while (graph->hashSize < 2 * graph->numNodes)
+        graph->hashSize *= 2;
+
+    graph->hashTable = malloc(graph->hashSize * sizeof(int));
+    memset(graph->hashTable, -1, graph->hashSize * sizeof(int));
+
+    for (id = 0; id < graph->numNodes; id++)
+    {
+        unsigned int slot = graphHashName(graphCityName(graph, id)) & (graph->hashSize - 1);
+
+        // Linear probing to the next free slot.
+        while (graph->hashTable[slot] != -1)
+            slot = (slot + 1) & (graph->hashSize - 1);
+
+        graph->hashTable[slot] = id;
+    }
+}
+
+/*
+    Graph City Index:
+        - Searches for a node within a graph using a given city name.
+        - Uses the name hash table, so the cost does not grow with the size of the graph.
+        - Returns integer value.
+            'id' -> City name found, node id returned.
+            '-1' -> City not present in graph.
+*/
+int graphCityIndex(struct Graph* graph, const char* cityName)
+{
+    if (graph->hashTable == NULL)
+        return -1;
+
+    unsigned int slot = graphHashName(cityName) & (graph->hashSize - 1);
+
+    while (graph->hashTable[slot] != -1)
+    {
+        int id = graph->hashTable[slot];
+
+        if (strcmp(graphCityName(graph, id), cityName) == 0)
+            return id;
+
+        slot = (slot + 1) & (graph->hashSize - 1);
+    }
+
+    return -1;
+}
+
+/*
+    Graph City Name:
+        - Returns pointer to the name of a given node id.
+*/
+char* graphCityName(struct Graph* graph, int id)
+{
+    return &graph->namePool[graph->nameOffset[id]];
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                                GRAPH EDGE FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Graph Copy Names:
+        - Creates a graph holding only the node names and name index of a given graph (no edges),
+            for structures that keep their own edges but still resolve city names.
+        - Returns pointer to new graph.
+*/
+struct Graph* graphCopyNames(struct Graph* graph)
+{
+    struct Graph* names = graphConstructor(graph->numNodes, 0, graph->nameOffset[graph->numNodes]);
+    int id;
+
+    for (id = 0; id < graph->numNodes; id++)
+        graphSetName(names, id, graphCityName(graph, id));
+
+    graphBuildIndex(names);
+
+    return names;
+}
+
+/*
+    Graph Degree:
+        - Returns the number of edges leaving a given node id.
+*/
+int graphDegree(struct Graph* graph, int id)
+{
+    return graph->rowStart[id + 1] - graph->rowStart[id];
+}
+
+/*
+    Graph Edge Weight:
+        - Returns the weight of the shortest edge between two given node ids.
+        - Returns integer value.
+            'weight' -> Nodes are connected.
+            '-1'     -> Nodes are not connected.
+*/
+int graphEdgeWeight(struct Graph* graph, int fromId, int toId)
+{
+    int edge;
+    int weight = -1;
+
+    for (edge = graph->rowStart[fromId]; edge < graph->rowStart[fromId + 1]; edge++)
+    {
+        if (graph->targets[edge] == toId && (weight == -1 || graph->weights[edge] < weight))
+            weight = graph->weights[edge];
+    }
+
+    return weight;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            GRAPH GENERATOR FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Graph Random:
+        - Returns the next value of a given xorshift random number sequence (repeatable for a given seed).
+*/
+static unsigned int graphRandom(unsigned int* seed)
+{
+    unsigned int value = *seed;
+
+    value ^= value << 13;
+    value ^= value >> 17;
+    value ^= value << 5;
+
+    *seed = value;
+    return value;
+}
+
+/*
+    Graph Generate:
+        - Creates a connected synthetic graph with a given number of nodes, average degree and
+            maximum path distance, named 'N0', 'N1', ...
+        - Every node is joined to the next node (so the graph is connected), most other paths join
+            nearby node ids and the rest join random node ids, roughly like a road network.
+        - The same seed always creates the same graph.
+        - Returns pointer to new graph.
+*/
+struct Graph* graphGenerate(int numNodes, int averageDegree, int maxWeight, unsigned int seed)
+{
+    int pathsPerNode = averageDegree / 2 > 1 ? averageDegree / 2 : 1;
+    int numPaths = numNodes > 1 ? numNodes * pathsPerNode : 0;
+    int index, path;
+
+    if (seed == 0)
+        seed = 1;
+
+    if (maxWeight < 1)
+        maxWeight = 1;
+
+    // Choose the paths (undirected) first.
+    int* from = malloc((numPaths > 0 ? numPaths : 1) * sizeof(int));
+    int* to = malloc((numPaths > 0 ? numPaths : 1) * sizeof(int));
+    int* weight = malloc((numPaths > 0 ? numPaths : 1) * sizeof(int));
+    int* degree = calloc(numNodes + 1, sizeof(int));
+
+    for (path = 0; path < numPaths; path++)
+    {
+        int city1 = path / pathsPerNode;
+        int city2;
+
+        if (path % pathsPerNode == 0)
+            city2 = (city1 + 1) % numNodes;
+
+        else if (graphRandom(&seed) % 5 != 0)
+            city2 = (city1 + 1 + graphRandom(&seed) % GRAPH_GENERATE_LOCALITY) % numNodes;
+
+        else city2 = graphRandom(&seed) % numNodes;
+
+        // Replace paths to itself with a path to the next node.
+        if (city2 == city1)
+            city2 = (city1 + 1) % numNodes;
+
+        from[path] = city1;
+        to[path] = city2;
+        weight[path] = 1 + graphRandom(&seed) % maxWeight;
+
+        degree[city1]++;
+        degree[city2]++;
+    }
+
+    // Names are 'N' followed by the node id.
+    char cityName[127];
+    int namePoolSize = 0;
+
+    for (index = 0; index < numNodes; index++)
+        namePoolSize += snprintf(cityName, sizeof(cityName), "N%d", index) + 1;
+
+    struct Graph* graph = graphConstructor(numNodes, 2 * numPaths, namePoolSize);
+
+    // Rows start where the previous row ends.
+    int edge = 0;
+    for (index = 0; index < numNodes; index++)
+    {
+        graph->rowStart[index] = edge;
+        edge += degree[index];
+        degree[index] = graph->rowStart[index];
+
+        snprintf(cityName, sizeof(cityName), "N%d", index);
+        graphSetName(graph, index, cityName);
+    }
+    graph->rowStart[numNodes] = edge;
+
+    // Store every path once in each direction ('degree' now holds the next free edge of each row).
+    for (path = 0; path < numPaths; path++)
+    {
+        graph->targets[degree[from[path]]] = to[path];
+        graph->weights[degree[from[path]]++] = weight[path];
+
+        graph->targets[degree[to[path]]] = from[path];
+        graph->weights[degree[to[path]]++] = weight[path];
+    }
+
+    graphBuildIndex(graph);
+
+    free(from);
+    free(to);
+    free(weight);
+    free(degree);
+
+    // Return new graph.
+    return graph;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            GRAPH REORDER FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Graph Compare Keys:
+        - qsort() comparison of two 64-bit (degree << 32 | id) keys, lowest first.
+*/
+static int graphCompareKeys(const void* key1, const void* key2)
+{
+    long long value1 = *(const long long*) key1;
+    long long value2 = *(const long long*) key2;
+
+    return (value1 > value2) - (value1 < value2);
+}
+
+/*
+    Graph Order:
+        - Chooses a new id for every node of a graph so that nodes used together sit close in memory.
+            GRAPH_ORDER_BFS     -> Breadth first order, neighbours get neighbouring ids.
+            GRAPH_ORDER_RCM     -> Reverse Cuthill-McKee, breadth first taking low degree neighbours first,
+                                    then reversed (keeps every row's targets within a narrow band).
+            GRAPH_ORDER_DEGREE  -> Highest degree first, the most relaxed rows share the same cache lines.
+            GRAPH_ORDER_NONE    -> Ids are kept.
+        - Every component is started from its lowest degree node (a node near its edge).
+        - Returns an array (to be freed by the caller) of the new id of each old id.
+*/
+int* graphOrder(struct Graph* graph, int order)
+{
+    int numNodes = graph->numNodes;
+    int* newId = malloc((numNodes > 0 ? numNodes : 1) * sizeof(int));
+    long long* keys = malloc((numNodes > 0 ? numNodes : 1) * sizeof(long long));
+    int index;
+
+    // Old ids sorted by degree, lowest first.
+    for (index = 0; index < numNodes; index++)
+        keys[index] = ((long long) graphDegree(graph, index) << 32) | index;
+
+    qsort(keys, numNodes, sizeof(long long), graphCompareKeys);
+
+    if (order == GRAPH_ORDER_DEGREE)
+    {
+        for (index = 0; index < numNodes; index++)
+            newId[(int) (keys[numNodes - 1 - index] & 0xFFFFFFFF)] = index;
+    }
+    else if (order == GRAPH_ORDER_BFS || order == GRAPH_ORDER_RCM)
+    {
+        // 'visitOrder' doubles as the breadth first queue.
+        int* visitOrder = malloc((numNodes > 0 ? numNodes : 1) * sizeof(int));
+        long long* neighbours = malloc((graph->numEdges > 0 ? graph->numEdges : 1) * sizeof(long long));
+        int numVisited = 0;
+        int head = 0;
+        int startIndex;
+
+        for (index = 0; index < numNodes; index++)
+            newId[index] = -1;
+
+        for (startIndex = 0; startIndex < numNodes; startIndex++)
+        {
+            int startId = (int) (keys[startIndex] & 0xFFFFFFFF);
+
+            // Already numbered within an earlier component.
+            if (newId[startId] >= 0)
+                continue;
+
+            newId[startId] = numVisited;
+            visitOrder[numVisited++] = startId;
+
+            while (head < numVisited)
+            {
+                int currentCity = visitOrder[head++];
+                int numNeighbours = 0;
+                int edge;
+
+                for (edge = graph->rowStart[currentCity]; edge < graph->rowStart[currentCity + 1]; edge++)
+                {
+                    int connectedCity = graph->targets[edge];
+
+                    if (newId[connectedCity] >= 0)
+                        continue;
+
+                    // Mark now so parallel edges are only queued once.
+                    newId[connectedCity] = numNeighbours;
+                    neighbours[numNeighbours++] = ((long long) graphDegree(graph, connectedCity) << 32) | connectedCity;
+                }
+
+                // Cuthill-McKee takes the lowest degree neighbours first.
+                if (order == GRAPH_ORDER_RCM)
+                    qsort(neighbours, numNeighbours, sizeof(long long), graphCompareKeys);
+
+                for (index = 0; index < numNeighbours; index++)
+                {
+                    int connectedCity = (int) (neighbours[index] & 0xFFFFFFFF);
+
+                    newId[connectedCity] = numVisited;
+                    visitOrder[numVisited++] = connectedCity;
+                }
+            }
+        }
+
+        // Reverse the Cuthill-McKee order.
+        if (order == GRAPH_ORDER_RCM)
+        {
+            for (index = 0; index < numNodes; index++)
+                newId[index] = numNodes - 1 - newId[index];
+        }
+
+        free(visitOrder);
+        free(neighbours);
+    }
+    else
+    {
+        for (index = 0; index < numNodes; index++)
+            newId[index] = index;
+    }
+
+    free(keys);
+
+    return newId;
+}
+
+/*
+    Graph Permute:
+        - Creates a copy of a graph with every node renumbered to a given new id (newId[oldId]).
+        - Names move with their nodes, so city names still resolve to the right (renumbered) node.
+        - Returns pointer to new graph.
+*/
+struct Graph* graphPermute(struct Graph* graph, int* newId)
+{
+    int numNodes = graph->numNodes;
+    int* oldId = malloc((numNodes > 0 ? numNodes : 1) * sizeof(int));
+    int index;
+
+    for (index = 0; index < numNodes; index++)
+        oldId[newId[index]] = index;
+
+    struct Graph* permuted = graphConstructor(numNodes, graph->numEdges, graph->nameOffset[numNodes]);
+
+    // Copy each row in new id order, renumbering its targets.
+    int edge = 0;
+    for (index = 0; index < numNodes; index++)
+    {
+        int oldCity = oldId[index];
+        int oldEdge;
+
+        permuted->rowStart[index] = edge;
+        graphSetName(permuted, index, graphCityName(graph, oldCity));
+
+        for (oldEdge = graph->rowStart[oldCity]; oldEdge < graph->rowStart[oldCity + 1]; oldEdge++)
+        {
+            permuted->targets[edge] = newId[graph->targets[oldEdge]];
+            permuted->weights[edge] = graph->weights[oldEdge];
+            edge++;
+        }
+    }
+    permuted->rowStart[numNodes] = edge;
+
+    graphBuildIndex(permuted);
+    free(oldId);
+
+    // Return new graph.
+    return permuted;
+}
+
+/*
+    Graph Reorder:
+        - Creates a copy of a graph renumbered in a given order (see graphOrder()).
+        - If 'newId' is not NULL it receives the new id array (to be freed by the caller), used to
+            map old ids held elsewhere onto the new graph.
+        - Returns pointer to new graph.
+*/
+struct Graph* graphReorder(struct Graph* graph, int order, int** newId)
+{
+    int* orderIds = graphOrder(graph, order);
+    struct Graph* reordered = graphPermute(graph, orderIds);
+
+    if (newId != NULL)
+        *newId = orderIds;
+
+    else free(orderIds);
+
+    return reordered;
+}
@@ -0,0 +1,92 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    compressed.h:
+        - Header file for the 'compressedGraph.c' source file.
+        - Defines the public functions to build and search a compressed copy of a frozen graph,
+            for networks too large to hold (or cache) in the plain compressed sparse row form.
+        - Contains the 'CompressedGraph' structure.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+#ifndef COMPRESSED_H_INCLUDED
+#define COMPRESSED_H_INCLUDED
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        COMPRESSED LIBRARIES/DEFINITIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// User Created Search Library:
+#include "search.h"
+
+// Fixed width integer types:
+#include <stdint.h>
+
+/*
+    COMPRESSED_NARROW_WEIGHT:
+        - Largest edge weight stored in 16 bits. Graphs with any larger weight keep 32-bit weights.
+*/
+#define COMPRESSED_NARROW_WEIGHT 65535
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        PUBLIC COMPRESSED STRUCTURES
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    CompressedGraph Structure:
+        - Each row's targets are sorted and stored as variable length integers (7 bits per byte):
+            the first as the (zigzag signed) difference from the row's own node id, the rest as the
+            difference from the previous target. With a locality order (see FREEZE_ORDER) most
+            differences fit in one byte.
+        - Weights stay in edge order in a 16-bit array (or 32-bit if any weight is too large).
+
+        numNodes        - Number of nodes within the graph.
+        numEdges        - Number of directed edge entries within the graph.
+        rowStart        - Index of the first edge (weight) of each node (numNodes + 1 entries).
+        byteStart       - Offset of each node's first encoded target within 'targetBytes' (numNodes + 1 entries).
+        targetBytes     - Encoded targets of every row, back to back.
+        narrowWeights   - 16-bit weights (NULL if 32-bit weights are used).
+        wideWeights     - 32-bit weights (NULL if 16-bit weights are used).
+        names           - Graph holding only the node names and name index (no edges).
+*/
+struct CompressedGraph
+{
+    int numNodes;
+    int numEdges;
+
+    int* rowStart;
+    uint32_t* byteStart;
+    uint8_t* targetBytes;
+
+    uint16_t* narrowWeights;
+    int* wideWeights;
+
+    struct Graph* names;
+};
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                    PUBLIC COMPRESSED FUNCTION DECLARATIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Creates a compressed copy of a given graph (the graph may be freed afterwards).
+struct CompressedGraph* compressedConstructor(struct Graph* graph);
+
+// Frees memory associated with a given compressed graph.
+void compressedDestructor(struct CompressedGraph* compressed);
+
+// Returns the number of bytes used by a compressed graph's edges (targets and weights).
+long compressedEdgeBytes(struct CompressedGraph* compressed);
+
+// Creates a search workspace for a given compressed graph.
+struct Search* compressedSearchConstructor(struct CompressedGraph* compressed);
+
+// Runs Dijkstra's algorithm on a compressed graph, decoding each row as it is relaxed.
+int compressedShortestPath(struct Search* search, struct CompressedGraph* compressed, int startId, int endId);
+
+// Prints the bytes per edge of the network's list, frozen and compressed forms.
+void compressedReport(struct Graph* graph, struct CompressedGraph* compressed);
+
+#endif // COMPRESSED_H_INCLUDED
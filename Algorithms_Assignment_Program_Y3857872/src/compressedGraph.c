@@ -0,0 +1,316 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    compressedGraph.c:
+        - Source file defining the functions to build and search compressed graphs.
+        - A compressed graph holds the same rows as a frozen graph, with each row's targets sorted,
+            delta encoded and written as variable length integers, and weights narrowed to 16 bits
+            whenever the largest weight allows (true of every data file supplied).
+        - Rows are decoded one target at a time inside the relaxation loop, the plain rows are never rebuilt.
+
+        - Functions:
+            - compressedCompareKeys
+            - compressedWriteVarint
+            - compressedReadVarint
+            - compressedConstructor
+            - compressedDestructor
+            - compressedEdgeBytes
+            - compressedSearchConstructor
+            - compressedShortestPath
+            - compressedReport
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Include respective header file:
+#include "compressed.h"
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            COMPRESSED ENCODING FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Compressed Compare Keys:
+        - qsort() comparison of two 64-bit (target << 32 | edge) keys, lowest first.
+*/
+static int compressedCompareKeys(const void* key1, const void* key2)
+{
+    long long value1 = *(const long long*) key1;
+    long long value2 = *(const long long*) key2;
+
+    return (value1 > value2) - (value1 < value2);
+}
+
+/*
+    Compressed Write Varint:
+        - Writes an unsigned value 7 bits per byte, lowest bits first, the top bit marking that more bytes follow.
+        - Returns pointer to the byte after the value.
+*/
+static uint8_t* compressedWriteVarint(uint8_t* bytes, uint32_t value)
+{
+    while (value >= 0x80)
+    {
+        *bytes++ = (uint8_t) (value | 0x80);
+        value >>= 7;
+    }
+
+    *bytes++ = (uint8_t) value;
+
+    return bytes;
+}
+
+/*
+    Compressed Read Varint:
+        - Reads a value written by compressedWriteVarint(), advancing the given byte pointer past it.
+*/
+static inline uint32_t compressedReadVarint(const uint8_t** bytes)
+{
+    const uint8_t* byte = *bytes;
+    uint32_t value = *byte & 0x7F;
+    int shift = 7;
+
+    while (*byte++ & 0x80)
+    {
+        value |= (uint32_t) (*byte & 0x7F) << shift;
+        shift += 7;
+    }
+
+    *bytes = byte;
+    return value;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        COMPRESSED CONSTRUCTORS/DESTRUCTORS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Compressed Constructor:
+        - Allocate memory for and encode a compressed copy of a given graph.
+        - The copy keeps its own names, so the source graph may be freed afterwards.
+        - Returns pointer to new compressed graph.
+*/
+struct CompressedGraph* compressedConstructor(struct Graph* graph)
+{
+    struct CompressedGraph* compressed = malloc(sizeof(struct CompressedGraph));
+    int numNodes = graph->numNodes;
+    int numEdges = graph->numEdges;
+    int index, edge;
+
+    compressed->numNodes = numNodes;
+    compressed->numEdges = numEdges;
+
+    // Narrow weights only if every weight fits.
+    int maxWeight = 0;
+    for (edge = 0; edge < numEdges; edge++)
+    {
+        if (graph->weights[edge] > maxWeight)
+            maxWeight = graph->weights[edge];
+    }
+
+    compressed->narrowWeights = NULL;
+    compressed->wideWeights = NULL;
+
+    if (maxWeight <= COMPRESSED_NARROW_WEIGHT)
+        compressed->narrowWeights = malloc((numEdges > 0 ? numEdges : 1) * sizeof(uint16_t));
+
+    else compressed->wideWeights = malloc((numEdges > 0 ? numEdges : 1) * sizeof(int));
+
+    // Reserve the worst case (5 bytes per target), shrunk once the real size is known.
+    compressed->rowStart = malloc((numNodes + 1) * sizeof(int));
+    compressed->byteStart = malloc((numNodes + 1) * sizeof(uint32_t));
+    compressed->targetBytes = malloc((numEdges > 0 ? numEdges : 1) * 5);
+
+    long long* keys = malloc((numEdges > 0 ? numEdges : 1) * sizeof(long long));
+    uint8_t* bytes = compressed->targetBytes;
+
+    for (index = 0; index < numNodes; index++)
+    {
+        int rowStart = graph->rowStart[index];
+        int degree = graph->rowStart[index + 1] - rowStart;
+
+        compressed->rowStart[index] = rowStart;
+        compressed->byteStart[index] = (uint32_t) (bytes - compressed->targetBytes);
+
+        // Sort the row by target, remembering which edge (weight) each came from.
+        for (edge = 0; edge < degree; edge++)
+            keys[edge] = ((long long) graph->targets[rowStart + edge] << 32) | (rowStart + edge);
+
+        qsort(keys, degree, sizeof(long long), compressedCompareKeys);
+
+        int previous = index;
+
+        for (edge = 0; edge < degree; edge++)
+        {
+            int target = (int) (keys[edge] >> 32);
+            int weight = graph->weights[(int) (keys[edge] & 0xFFFFFFFF)];
+
+            // First target relative to the row's own id (zigzag, may be negative), the rest to the previous target.
+            if (edge == 0)
+            {
+                int difference = target - index;
+                bytes = compressedWriteVarint(bytes, ((uint32_t) difference << 1) ^ (uint32_t) (difference >> 31));
+            }
+            else bytes = compressedWriteVarint(bytes, (uint32_t) (target - previous));
+
+            previous = target;
+
+            if (compressed->narrowWeights != NULL)
+                compressed->narrowWeights[rowStart + edge] = (uint16_t) weight;
+
+            else compressed->wideWeights[rowStart + edge] = weight;
+        }
+    }
+
+    compressed->rowStart[numNodes] = numEdges;
+    compressed->byteStart[numNodes] = (uint32_t) (bytes - compressed->targetBytes);
+
+    // Shrink the target bytes to their real size (plus one register so reads may run ahead safely).
+    compressed->targetBytes = realloc(compressed->targetBytes, compressed->byteStart[numNodes] + 8);
+    free(keys);
+
+    // Keep only the names and name index of the source graph.
+    compressed->names = graphCopyNames(graph);
+
+    // Return new compressed graph.
+    return compressed;
+}
+
+/*
+    Compressed Destructor:
+        - Free memory associated with a compressed graph.
+*/
+void compressedDestructor(struct CompressedGraph* compressed)
+{
+    if (compressed == NULL)
+        return;
+
+    free(compressed->rowStart);
+    free(compressed->byteStart);
+    free(compressed->targetBytes);
+    free(compressed->narrowWeights);
+    free(compressed->wideWeights);
+    graphDestructor(compressed->names);
+    free(compressed);
+}
+
+/*
+    Compressed Edge Bytes:
+        - Returns the number of bytes used by a compressed graph's edges: the encoded targets, the
+            weights and both row offset arrays.
+*/
+long compressedEdgeBytes(struct CompressedGraph* compressed)
+{
+    long weightBytes = compressed->narrowWeights != NULL ? sizeof(uint16_t) : sizeof(int);
+
+    return (long) compressed->byteStart[compressed->numNodes]
+           + compressed->numEdges * weightBytes
+           + (compressed->numNodes + 1) * (long) (sizeof(int) + sizeof(uint32_t));
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            COMPRESSED SEARCH FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Compressed Search Constructor:
+        - Creates a search workspace for a compressed graph (sized by its names-only graph).
+        - searchDistance() and searchPath() read the results, edge blocks are not supported.
+        - Returns pointer to new search workspace.
+*/
+struct Search* compressedSearchConstructor(struct CompressedGraph* compressed)
+{
+    return searchConstructor(compressed->names);
+}
+
+/*
+    Compressed Shortest Path:
+        - Runs Dijkstra's algorithm between two node ids of a compressed graph ('-1' as end id
+            settles every reachable node), decoding each row's targets as its edges are relaxed.
+        - Returns indication if function was successful.
+            '1' -> End node reached (or one-to-all search complete).
+            '0' -> End node is unreachable.
+*/
+int compressedShortestPath(struct Search* search, struct CompressedGraph* compressed, int startId, int endId)
+{
+    int currentDistance;
+
+    searchReset(search, startId);
+
+    while (heapIsEmpty(search->heap) == 0)
+    {
+        int currentCity = heapPop(search->heap, &currentDistance);
+
+        // Current city is now fully explored.
+        search->settledStamp[currentCity] = search->epoch;
+        search->settledCount++;
+
+        if (currentCity == endId)
+            return 1;
+
+        // Stream the row: decode each target and relax it straight away.
+        const uint8_t* bytes = compressed->targetBytes + compressed->byteStart[currentCity];
+        int connectedCity = currentCity;
+        int edge;
+
+        for (edge = compressed->rowStart[currentCity]; edge < compressed->rowStart[currentCity + 1]; edge++)
+        {
+            uint32_t value = compressedReadVarint(&bytes);
+
+            if (edge == compressed->rowStart[currentCity])
+                connectedCity = currentCity + (int) ((value >> 1) ^ (0 - (value & 1)));
+
+            else connectedCity += (int) value;
+
+            // Skip cities whose shortest distance is already final.
+            if (search->settledStamp[connectedCity] == search->epoch)
+                continue;
+
+            int weight = compressed->narrowWeights != NULL ? compressed->narrowWeights[edge] : compressed->wideWeights[edge];
+            int newDistance = currentDistance + weight;
+
+            // Update the connected city's distance and route if it is shorter via the current city.
+            if (search->stamp[connectedCity] != search->epoch || newDistance < search->distance[connectedCity])
+            {
+                search->stamp[connectedCity] = search->epoch;
+                search->distance[connectedCity] = newDistance;
+                search->back[connectedCity] = currentCity;
+                heapPush(search->heap, connectedCity, newDistance);
+            }
+        }
+    }
+
+    // Heap exhausted, only a one-to-all search counts as complete.
+    if (endId < 0)
+        return 1;
+
+    return 0;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            COMPRESSED DISPLAY FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Compressed Report:
+        - Prints the bytes used per directed edge by each form of the same network:
+            - Network lists   -> node pointer, distance and twin index per entry.
+            - Frozen graph    -> target and weight per edge, plus one row offset per node.
+            - Compressed      -> encoded target and narrow weight per edge, plus two row offsets per node.
+*/
+void compressedReport(struct Graph* graph, struct CompressedGraph* compressed)
+{
+    double numEdges = graph->numEdges > 0 ? graph->numEdges : 1;
+
+    double listBytes = sizeof(struct Node*) + 2 * sizeof(int);
+    double graphBytes = (graph->numEdges * 2.0 * sizeof(int) + (graph->numNodes + 1.0) * sizeof(int)) / numEdges;
+    double compressedBytes = compressedEdgeBytes(compressed) / numEdges;
+
+    printf("\nBYTES PER EDGE - (%d nodes, %d directed edges)\n", graph->numNodes, graph->numEdges);
+    printf("\tNetwork lists  : %.2f\n", listBytes);
+    printf("\tFrozen graph   : %.2f\n", graphBytes);
+    printf("\tCompressed     : %.2f (%.2f target bytes, %d-bit weights)\n", compressedBytes,
+           (double) compressed->byteStart[compressed->numNodes] / numEdges, compressed->narrowWeights != NULL ? 16 : 32);
+}
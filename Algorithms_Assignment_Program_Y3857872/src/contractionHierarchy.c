@@ -0,0 +1,1284 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    contractionHierarchy.c:
+        - Source file defining the functions to build and query contraction hierarchies.
+        - Preprocessing contracts (removes) every node in turn, least important first. Removing a node
+            adds a shortcut between each pair of its neighbours whose shortest path ran through it,
+            unless a local witness search finds another path no longer than the one through it.
+        - Node importance (priority) is twice the edge difference (shortcuts added minus edges removed)
+            plus the number of neighbours already contracted and the node's level (how many nodes were
+            contracted below it in turn), which spreads contraction evenly across the graph.
+        - Priorities are kept up to date lazily: only the neighbours of contracted nodes are re-evaluated.
+        - Nodes are only contracted while they add at most HIERARCHY_CORE_GROWTH more shortcuts than
+            the edges they remove (graphs with many long random paths have no useful hierarchy at the
+            top). The nodes left form a core that keeps its edges in both directions, queries search it
+            with bidirectional Dijkstra's algorithm from wherever the upward searches reached it.
+        - Contraction runs in rounds across the threads: every node whose priority is lower than all of
+            its remaining neighbours (other than those past the core limit) is contracted in the same
+            round (no two of them are neighbours). Contraction stops once no node is within the limit.
+            Witness searches skip every node of the round, so each node's shortcuts stay correct when
+            its neighbours' neighbours are removed at the same time.
+        - A query runs Dijkstra's algorithm upwards (towards higher ranks) from both ends at once and
+            stops once neither side can improve the best meeting point. Nodes reached more cheaply from
+            above are not expanded (stall on demand). Shortcuts are then unpacked recursively back into
+            the original cities.
+
+        - Functions:
+            - hierarchyRowAdd
+            - hierarchyRowRemove
+            - hierarchyAddShortcut
+            - hierarchyWitnessSearch
+            - hierarchyContractNode
+            - hierarchyWorkerThread
+            - hierarchyRunPhase
+            - hierarchyIsLocalMinimum
+            - hierarchyAllocate
+            - hierarchyConstructor
+            - hierarchyDestructor
+            - hierarchySave
+            - hierarchyLoad
+            - hierarchySearchConstructor
+            - hierarchySearchDestructor
+            - hierarchyCoreSearch
+            - hierarchyShortestPath
+            - hierarchyFindEdge
+            - hierarchyUnpack
+            - hierarchyUnpackPath
+            - hierarchyPath
+            - hierarchySettledCount
+            - hierarchyDisplayPath
+            - hierarchyReport
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Include respective header file:
+#include "hierarchy.h"
+
+// Thread and atomic libraries:
+#include <pthread.h>
+#include <stdatomic.h>
+
+// Phase types run by the preprocessing threads.
+#define HIERARCHY_PHASE_PRIORITY 0
+#define HIERARCHY_PHASE_CONTRACT 1
+
+// Minimum number of nodes per thread within a phase (smaller phases use fewer threads).
+#define HIERARCHY_TASKS_PER_THREAD 64
+
+// Identifies a hierarchy file.
+#define HIERARCHY_FILE_TAG 0x48434843
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            HIERARCHY STRUCTURES
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    HierarchyEdge Structure:
+        target      - Node id at the far end of the edge.
+        weight      - Distance of the edge.
+        middle      - Middle node id of a shortcut ('-1' for an original edge).
+*/
+struct HierarchyEdge
+{
+    int target;
+    int weight;
+    int middle;
+};
+
+/*
+    HierarchyRow Structure:
+        - Growable edge list of one node during preprocessing (at most one edge per neighbour).
+
+        count       - Number of edges.
+        capacity    - Capacity of the edge array.
+        edges       - Edges to the node's remaining neighbours (all higher ranked once contracted).
+*/
+struct HierarchyRow
+{
+    int count;
+    int capacity;
+    struct HierarchyEdge* edges;
+};
+
+/*
+    HierarchyShortcut Structure:
+        from, to    - Node ids joined by the shortcut.
+        weight      - Distance of the shortcut.
+        middle      - Node id the shortcut passes through.
+*/
+struct HierarchyShortcut
+{
+    int from;
+    int to;
+    int weight;
+    int middle;
+};
+
+/*
+    HierarchyWitness Structure:
+        - Per-thread witness search workspace and the shortcuts the thread found in the current round.
+
+        epoch           - Current search number, distances are only valid when stamped with it.
+        stamp           - Search number each node was last reached in.
+        distance        - Tentative distance of each node.
+        goal            - Search number each node was last a target neighbour in.
+        heap            - Indexed priority queue of reached nodes.
+        shortcuts       - Shortcuts needed by the nodes this thread contracted.
+        numShortcuts    - Number of shortcuts.
+        capacity        - Capacity of the shortcut array.
+*/
+struct HierarchyWitness
+{
+    int epoch;
+    int* stamp;
+    int* distance;
+    int* goal;
+    struct Heap* heap;
+
+    struct HierarchyShortcut* shortcuts;
+    int numShortcuts;
+    int capacity;
+};
+
+/*
+    HierarchyBuild Structure:
+        - Shared preprocessing state.
+
+        numNodes        - Number of nodes.
+        rows            - Current edge list of every node.
+        priority        - Current priority of every node (lower is contracted sooner).
+        growth          - Shortcuts minus edges removed if every node were contracted now.
+        deleted         - Number of contracted neighbours of every node.
+        level           - Upper bound on the number of hierarchy levels below every node.
+        rank            - Contraction order of every node ('-1' until contracted).
+        roundStamp      - Round each node was contracted in (skipped by witness searches of that round).
+        round           - Current round.
+        numThreads      - Number of threads, including the calling thread.
+        witnesses       - Per-thread witness workspaces.
+        phase           - Type of the current phase.
+        tasks           - Node ids the current phase works on.
+        numTasks        - Number of node ids.
+        nextTask        - Next unclaimed position within the phase.
+*/
+struct HierarchyBuild
+{
+    int numNodes;
+    struct HierarchyRow* rows;
+    int* priority;
+    int* growth;
+    int* deleted;
+    int* level;
+    int* rank;
+    int* roundStamp;
+    int round;
+
+    int numThreads;
+    struct HierarchyWitness* witnesses;
+
+    int phase;
+    int* tasks;
+    int numTasks;
+    atomic_int nextTask;
+};
+
+/*
+    HierarchyWorker Structure:
+        build       - Shared preprocessing state.
+        index       - Thread number ('0' is the calling thread).
+        thread      - POSIX thread handle (unused for thread '0').
+*/
+struct HierarchyWorker
+{
+    struct HierarchyBuild* build;
+    int index;
+    pthread_t thread;
+};
+
+/*
+    HierarchySearch Structure:
+        - Query workspace, index '0' of each pair of arrays is the forward search (from the start)
+            and index '1' the backward search (from the end).
+
+        hierarchy       - Hierarchy searched.
+        epoch           - Current query number, entries are only valid when stamped with it.
+        stamp           - Query number each node was last reached in, per direction.
+        distance        - Tentative distance of each node, per direction.
+        back            - Previous node on the upward path to each node, per direction.
+        heap            - Indexed priority queue of reached nodes, per direction.
+        coreHeap        - Core nodes reached by the upward search, queued for the core search, per direction.
+        chain           - Scratch array used to walk the forward path.
+        startId         - Start node id of the last query.
+        endId           - End node id of the last query.
+        meet            - Node where the two searches met on the shortest path ('-1' if unreachable).
+        best            - Shortest distance found by the last query.
+        settledCount    - Number of nodes settled by the last query (both directions).
+*/
+struct HierarchySearch
+{
+    struct Hierarchy* hierarchy;
+
+    int epoch;
+    int* stamp[2];
+    int* distance[2];
+    int* back[2];
+    struct Heap* heap[2];
+    struct Heap* coreHeap[2];
+    int* chain;
+
+    int startId;
+    int endId;
+    int meet;
+    int best;
+    int settledCount;
+};
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        HIERARCHY PREPROCESSING FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Hierarchy Row Add:
+        - Adds an edge to a row, or lowers the row's existing edge to the same node.
+        - Returns indication if the row changed.
+            '1' -> Edge added or lowered.
+            '0' -> Existing edge already as short.
+*/
+static int hierarchyRowAdd(struct HierarchyRow* row, int target, int weight, int middle)
+{
+    int index;
+
+    for (index = 0; index < row->count; index++)
+    {
+        if (row->edges[index].target == target)
+        {
+            if (weight >= row->edges[index].weight)
+                return 0;
+
+            row->edges[index].weight = weight;
+            row->edges[index].middle = middle;
+            return 1;
+        }
+    }
+
+    if (row->count == row->capacity)
+    {
+        row->capacity = (row->capacity > 0) ? row->capacity * 2 : 4;
+        row->edges = realloc(row->edges, row->capacity * sizeof(struct HierarchyEdge));
+    }
+
+    row->edges[row->count].target = target;
+    row->edges[row->count].weight = weight;
+    row->edges[row->count].middle = middle;
+    row->count++;
+
+    return 1;
+}
+
+/*
+    Hierarchy Row Remove:
+        - Removes the edge to a given node from a row (the last edge takes its place).
+*/
+static void hierarchyRowRemove(struct HierarchyRow* row, int target)
+{
+    int index;
+
+    for (index = 0; index < row->count; index++)
+    {
+        if (row->edges[index].target == target)
+        {
+            row->edges[index] = row->edges[--row->count];
+            return;
+        }
+    }
+}
+
+/*
+    Hierarchy Add Shortcut:
+        - Adds a shortcut to both of its end nodes, unless they are already joined by an edge as short.
+*/
+static void hierarchyAddShortcut(struct HierarchyBuild* build, struct HierarchyShortcut* shortcut)
+{
+    if (hierarchyRowAdd(&build->rows[shortcut->from], shortcut->to, shortcut->weight, shortcut->middle) == 1)
+        hierarchyRowAdd(&build->rows[shortcut->to], shortcut->from, shortcut->weight, shortcut->middle);
+}
+
+/*
+    Hierarchy Witness Search:
+        - Runs Dijkstra's algorithm from one neighbour ('first' within the row) of the node being
+            contracted over the remaining graph, skipping that node and every node of the current round.
+        - Stops once every later neighbour in the row is settled, beyond a maximum distance or after
+            HIERARCHY_WITNESS_SETTLED nodes (HIERARCHY_ESTIMATE_SETTLED when only estimating a priority).
+            The distances of the nodes reached are then upper bounds (enough to prove a witness exists).
+*/
+static void hierarchyWitnessSearch(struct HierarchyBuild* build, struct HierarchyWitness* witness, int skipped,
+                                   int first, int maxDistance)
+{
+    struct HierarchyRow* skippedRow = &build->rows[skipped];
+    int source = skippedRow->edges[first].target;
+    int numGoals = skippedRow->count - first - 1;
+    int maxSettled = (build->phase == HIERARCHY_PHASE_PRIORITY) ? HIERARCHY_ESTIMATE_SETTLED : HIERARCHY_WITNESS_SETTLED;
+    int settled = 0;
+    int currentDistance;
+    int index;
+
+    witness->epoch++;
+    heapClear(witness->heap);
+
+    for (index = first + 1; index < skippedRow->count; index++)
+        witness->goal[skippedRow->edges[index].target] = witness->epoch;
+
+    witness->stamp[source] = witness->epoch;
+    witness->distance[source] = 0;
+    heapPush(witness->heap, source, 0);
+
+    while (heapIsEmpty(witness->heap) == 0)
+    {
+        int current = heapPop(witness->heap, &currentDistance);
+
+        if (currentDistance > maxDistance || ++settled > maxSettled)
+            break;
+
+        if (witness->goal[current] == witness->epoch && --numGoals == 0)
+            break;
+
+        struct HierarchyRow* row = &build->rows[current];
+
+        for (index = 0; index < row->count; index++)
+        {
+            int target = row->edges[index].target;
+            int newDistance = currentDistance + row->edges[index].weight;
+
+            if (target == skipped || build->roundStamp[target] == build->round)
+                continue;
+
+            if (witness->stamp[target] != witness->epoch || newDistance < witness->distance[target])
+            {
+                witness->stamp[target] = witness->epoch;
+                witness->distance[target] = newDistance;
+                heapPush(witness->heap, target, newDistance);
+            }
+        }
+    }
+}
+
+/*
+    Hierarchy Contract Node:
+        - Finds the shortcuts needed to remove a node: one witness search from each neighbour, then
+            a shortcut for every later neighbour with no path as short as the one through the node.
+        - Shortcuts are only recorded (in the thread's witness workspace) when asked for.
+        - Returns the number of shortcuts needed.
+*/
+static int hierarchyContractNode(struct HierarchyBuild* build, struct HierarchyWitness* witness, int node, int record)
+{
+    struct HierarchyRow* row = &build->rows[node];
+    int numShortcuts = 0;
+    int maxWeight = 0;
+    int first, second;
+
+    for (first = 0; first < row->count; first++)
+        if (row->edges[first].weight > maxWeight)
+            maxWeight = row->edges[first].weight;
+
+    for (first = 0; first < row->count - 1; first++)
+    {
+        int from = row->edges[first].target;
+        int fromWeight = row->edges[first].weight;
+
+        hierarchyWitnessSearch(build, witness, node, first, fromWeight + maxWeight);
+
+        for (second = first + 1; second < row->count; second++)
+        {
+            int to = row->edges[second].target;
+            int through = fromWeight + row->edges[second].weight;
+
+            // A witness path avoids the node and is no longer.
+            if (witness->stamp[to] == witness->epoch && witness->distance[to] <= through)
+                continue;
+
+            numShortcuts++;
+
+            if (record == 0)
+                continue;
+
+            if (witness->numShortcuts == witness->capacity)
+            {
+                witness->capacity *= 2;
+                witness->shortcuts = realloc(witness->shortcuts, witness->capacity * sizeof(struct HierarchyShortcut));
+            }
+
+            struct HierarchyShortcut* shortcut = &witness->shortcuts[witness->numShortcuts++];
+            shortcut->from = from;
+            shortcut->to = to;
+            shortcut->weight = through;
+            shortcut->middle = node;
+        }
+    }
+
+    return numShortcuts;
+}
+
+/*
+    Hierarchy Worker Thread:
+        - Claims the nodes of the current phase one at a time, either re-evaluating their priority
+            or finding the shortcuts needed to contract them.
+        - The rows are only read during a phase, each thread writes its own workspace and the
+            priority of the nodes it claimed.
+*/
+static void* hierarchyWorkerThread(void* argument)
+{
+    struct HierarchyWorker* worker = argument;
+    struct HierarchyBuild* build = worker->build;
+    struct HierarchyWitness* witness = &build->witnesses[worker->index];
+    int task;
+
+    while ((task = atomic_fetch_add(&build->nextTask, 1)) < build->numTasks)
+    {
+        int node = build->tasks[task];
+
+        if (build->phase == HIERARCHY_PHASE_PRIORITY)
+        {
+            build->growth[node] = hierarchyContractNode(build, witness, node, 0) - build->rows[node].count;
+            build->priority[node] = 2 * build->growth[node] + build->deleted[node] + build->level[node];
+        }
+
+        else hierarchyContractNode(build, witness, node, 1);
+    }
+
+    return NULL;
+}
+
+/*
+    Hierarchy Run Phase:
+        - Runs one phase over the task nodes across the threads (fewer threads for small phases).
+*/
+static void hierarchyRunPhase(struct HierarchyBuild* build, struct HierarchyWorker* workers, int phase)
+{
+    int numThreads = (build->numTasks + HIERARCHY_TASKS_PER_THREAD - 1) / HIERARCHY_TASKS_PER_THREAD;
+    int index;
+
+    if (numThreads > build->numThreads)
+        numThreads = build->numThreads;
+
+    build->phase = phase;
+    atomic_store(&build->nextTask, 0);
+
+    for (index = 1; index < numThreads; index++)
+        pthread_create(&workers[index].thread, NULL, hierarchyWorkerThread, &workers[index]);
+
+    hierarchyWorkerThread(&workers[0]);
+
+    for (index = 1; index < numThreads; index++)
+        pthread_join(workers[index].thread, NULL);
+}
+
+/*
+    Hierarchy Is Local Minimum:
+        - Checks if a node is within the core limit and its priority is lower than that of each
+            remaining neighbour within the limit (ties broken by id).
+            '1' -> Node is contracted this round.
+            '0' -> Node is past the limit or a neighbour goes first.
+*/
+static int hierarchyIsLocalMinimum(struct HierarchyBuild* build, int node)
+{
+    struct HierarchyRow* row = &build->rows[node];
+    int index;
+
+    if (build->growth[node] > HIERARCHY_CORE_GROWTH)
+        return 0;
+
+    for (index = 0; index < row->count; index++)
+    {
+        int neighbour = row->edges[index].target;
+
+        if (build->growth[neighbour] > HIERARCHY_CORE_GROWTH)
+            continue;
+
+        if (build->priority[neighbour] < build->priority[node]
+            || (build->priority[neighbour] == build->priority[node] && neighbour < node))
+            return 0;
+    }
+
+    return 1;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        HIERARCHY CONSTRUCTORS/DESTRUCTORS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Hierarchy Allocate:
+        - Allocate memory for a hierarchy with a given number of nodes and upward edges.
+        - Returns pointer to new hierarchy.
+*/
+static struct Hierarchy* hierarchyAllocate(int numNodes, int numEdges)
+{
+    struct Hierarchy* hierarchy = malloc(sizeof(struct Hierarchy));
+
+    hierarchy->numNodes = numNodes;
+    hierarchy->numEdges = numEdges;
+    hierarchy->numShortcuts = 0;
+    hierarchy->numCore = 0;
+
+    hierarchy->rank = malloc((numNodes > 0 ? numNodes : 1) * sizeof(int));
+    hierarchy->rowStart = calloc(numNodes + 1, sizeof(int));
+    hierarchy->targets = malloc((numEdges > 0 ? numEdges : 1) * sizeof(int));
+    hierarchy->weights = malloc((numEdges > 0 ? numEdges : 1) * sizeof(int));
+    hierarchy->middles = malloc((numEdges > 0 ? numEdges : 1) * sizeof(int));
+
+    hierarchy->names = NULL;
+    hierarchy->buildTime = 0;
+
+    // Return new hierarchy.
+    return hierarchy;
+}
+
+/*
+    Hierarchy Constructor:
+        - Preprocesses a graph into a contraction hierarchy across a given number of threads
+            (including the calling thread).
+        - Parallel paths keep only the shortest, paths from a city to itself are dropped.
+        - The hierarchy keeps its own names, so the graph may be freed afterwards.
+        - Returns pointer to new hierarchy.
+*/
+struct Hierarchy* hierarchyConstructor(struct Graph* graph, int numThreads)
+{
+    double timeStart = timerNow();
+    int numNodes = graph->numNodes;
+    int index, node, edge;
+
+    if (numThreads < 1)
+        numThreads = 1;
+
+    // Copy the graph into growable rows.
+    struct HierarchyBuild build;
+
+    build.numNodes = numNodes;
+    build.rows = calloc(numNodes > 0 ? numNodes : 1, sizeof(struct HierarchyRow));
+    build.priority = calloc(numNodes > 0 ? numNodes : 1, sizeof(int));
+    build.growth = calloc(numNodes > 0 ? numNodes : 1, sizeof(int));
+    build.deleted = calloc(numNodes > 0 ? numNodes : 1, sizeof(int));
+    build.level = calloc(numNodes > 0 ? numNodes : 1, sizeof(int));
+    build.rank = malloc((numNodes > 0 ? numNodes : 1) * sizeof(int));
+    build.roundStamp = calloc(numNodes > 0 ? numNodes : 1, sizeof(int));
+    build.round = 0;
+    build.numThreads = numThreads;
+    build.tasks = malloc((numNodes > 0 ? numNodes : 1) * sizeof(int));
+
+    for (node = 0; node < numNodes; node++)
+    {
+        build.rank[node] = -1;
+
+        for (edge = graph->rowStart[node]; edge < graph->rowStart[node + 1]; edge++)
+            if (graph->targets[edge] != node)
+                hierarchyRowAdd(&build.rows[node], graph->targets[edge], graph->weights[edge], -1);
+    }
+
+    // One witness workspace per thread.
+    build.witnesses = malloc(numThreads * sizeof(struct HierarchyWitness));
+    struct HierarchyWorker* workers = malloc(numThreads * sizeof(struct HierarchyWorker));
+
+    for (index = 0; index < numThreads; index++)
+    {
+        build.witnesses[index].epoch = 0;
+        build.witnesses[index].stamp = calloc(numNodes > 0 ? numNodes : 1, sizeof(int));
+        build.witnesses[index].distance = malloc((numNodes > 0 ? numNodes : 1) * sizeof(int));
+        build.witnesses[index].goal = calloc(numNodes > 0 ? numNodes : 1, sizeof(int));
+        build.witnesses[index].heap = heapConstructor(numNodes);
+        build.witnesses[index].capacity = 64;
+        build.witnesses[index].numShortcuts = 0;
+        build.witnesses[index].shortcuts = malloc(64 * sizeof(struct HierarchyShortcut));
+
+        workers[index].build = &build;
+        workers[index].index = index;
+    }
+
+    // Initial priority of every node.
+    int* remaining = malloc((numNodes > 0 ? numNodes : 1) * sizeof(int));
+    int* touched = malloc((numNodes > 0 ? numNodes : 1) * sizeof(int));
+    int numRemaining = numNodes;
+
+    for (node = 0; node < numNodes; node++)
+    {
+        remaining[node] = node;
+        build.tasks[node] = node;
+    }
+
+    build.numTasks = numNodes;
+    hierarchyRunPhase(&build, workers, HIERARCHY_PHASE_PRIORITY);
+
+    int nextRank = 0;
+
+    while (numRemaining > 0)
+    {
+        build.round++;
+        build.numTasks = 0;
+
+        // Contract every local minimum this round.
+        for (index = 0; index < numRemaining; index++)
+            if (hierarchyIsLocalMinimum(&build, remaining[index]) == 1)
+                build.tasks[build.numTasks++] = remaining[index];
+
+        // Leave the nodes past the limit as the core.
+        if (build.numTasks == 0)
+            break;
+
+        for (index = 0; index < build.numTasks; index++)
+            build.roundStamp[build.tasks[index]] = build.round;
+
+        for (index = 0; index < numThreads; index++)
+            build.witnesses[index].numShortcuts = 0;
+
+        hierarchyRunPhase(&build, workers, HIERARCHY_PHASE_CONTRACT);
+
+        // Remove the contracted nodes from their neighbours' rows, their own rows keep the upward edges.
+        int numTouched = 0;
+
+        for (index = 0; index < build.numTasks; index++)
+        {
+            node = build.tasks[index];
+            build.rank[node] = nextRank++;
+
+            for (edge = 0; edge < build.rows[node].count; edge++)
+            {
+                int neighbour = build.rows[node].edges[edge].target;
+
+                hierarchyRowRemove(&build.rows[neighbour], node);
+                build.deleted[neighbour]++;
+
+                if (build.level[neighbour] <= build.level[node])
+                    build.level[neighbour] = build.level[node] + 1;
+
+                // Collect each neighbour once to re-evaluate (stamped with the negative round).
+                if (build.roundStamp[neighbour] != -build.round)
+                {
+                    build.roundStamp[neighbour] = -build.round;
+                    touched[numTouched++] = neighbour;
+                }
+            }
+        }
+
+        // Add the shortcuts found by every thread.
+        int worker;
+        for (worker = 0; worker < numThreads; worker++)
+            for (index = 0; index < build.witnesses[worker].numShortcuts; index++)
+                hierarchyAddShortcut(&build, &build.witnesses[worker].shortcuts[index]);
+
+        // Re-evaluate the touched neighbours, then drop the contracted nodes from the remaining list.
+        memcpy(build.tasks, touched, numTouched * sizeof(int));
+        build.numTasks = numTouched;
+        hierarchyRunPhase(&build, workers, HIERARCHY_PHASE_PRIORITY);
+
+        int kept = 0;
+        for (index = 0; index < numRemaining; index++)
+            if (build.rank[remaining[index]] < 0)
+                remaining[kept++] = remaining[index];
+
+        numRemaining = kept;
+    }
+
+    // The core is ranked above every contracted node and keeps its edges in both directions.
+    for (index = 0; index < numRemaining; index++)
+        build.rank[remaining[index]] = nextRank++;
+
+    // Copy the upward rows into the hierarchy.
+    int numEdges = 0;
+    for (node = 0; node < numNodes; node++)
+        numEdges += build.rows[node].count;
+
+    struct Hierarchy* hierarchy = hierarchyAllocate(numNodes, numEdges);
+    edge = 0;
+
+    for (node = 0; node < numNodes; node++)
+    {
+        hierarchy->rank[node] = build.rank[node];
+        hierarchy->rowStart[node] = edge;
+
+        for (index = 0; index < build.rows[node].count; index++, edge++)
+        {
+            hierarchy->targets[edge] = build.rows[node].edges[index].target;
+            hierarchy->weights[edge] = build.rows[node].edges[index].weight;
+            hierarchy->middles[edge] = build.rows[node].edges[index].middle;
+
+            if (hierarchy->middles[edge] >= 0)
+                hierarchy->numShortcuts++;
+        }
+
+        free(build.rows[node].edges);
+    }
+
+    hierarchy->rowStart[numNodes] = edge;
+    hierarchy->numCore = numRemaining;
+    hierarchy->names = graphCopyNames(graph);
+
+    // Free the preprocessing state.
+    for (index = 0; index < numThreads; index++)
+    {
+        free(build.witnesses[index].stamp);
+        free(build.witnesses[index].distance);
+        free(build.witnesses[index].goal);
+        free(build.witnesses[index].shortcuts);
+        heapDestructor(build.witnesses[index].heap);
+    }
+
+    free(build.witnesses);
+    free(workers);
+    free(remaining);
+    free(touched);
+    free(build.rows);
+    free(build.priority);
+    free(build.growth);
+    free(build.deleted);
+    free(build.level);
+    free(build.rank);
+    free(build.roundStamp);
+    free(build.tasks);
+
+    hierarchy->buildTime = timerNow() - timeStart;
+
+    // Return new hierarchy.
+    return hierarchy;
+}
+
+/*
+    Hierarchy Destructor:
+        - Free memory associated with a hierarchy.
+*/
+void hierarchyDestructor(struct Hierarchy* hierarchy)
+{
+    if (hierarchy == NULL)
+        return;
+
+    free(hierarchy->rank);
+    free(hierarchy->rowStart);
+    free(hierarchy->targets);
+    free(hierarchy->weights);
+    free(hierarchy->middles);
+    graphDestructor(hierarchy->names);
+    free(hierarchy);
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            HIERARCHY FILE FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Hierarchy Save:
+        - Writes a hierarchy to a binary file (native byte order): tag, numNodes, numEdges, numCore,
+            name pool size, name pool, then the rank, rowStart, targets, weights and middles arrays.
+        - Returns indication if function was successful.
+            '1' -> File written.
+            '0' -> File could not be written.
+*/
+int hierarchySave(struct Hierarchy* hierarchy, const char* fileName)
+{
+    FILE* file = fopen(fileName, "wb");
+
+    if (file == NULL)
+    {
+        printf("Failure: Unable to open '%s'! - (hierarchySave - contractionHierarchy.c)\n", fileName);
+        return 0;
+    }
+
+    int numNodes = hierarchy->numNodes;
+    int numEdges = hierarchy->numEdges;
+    int header[5] = { HIERARCHY_FILE_TAG, numNodes, numEdges, hierarchy->numCore, hierarchy->names->nameOffset[numNodes] };
+
+    int written = (fwrite(header, sizeof(int), 5, file) == 5);
+    written &= (fwrite(hierarchy->names->namePool, 1, header[4], file) == (size_t) header[4]);
+    written &= (fwrite(hierarchy->rank, sizeof(int), numNodes, file) == (size_t) numNodes);
+    written &= (fwrite(hierarchy->rowStart, sizeof(int), numNodes + 1, file) == (size_t) numNodes + 1);
+    written &= (fwrite(hierarchy->targets, sizeof(int), numEdges, file) == (size_t) numEdges);
+    written &= (fwrite(hierarchy->weights, sizeof(int), numEdges, file) == (size_t) numEdges);
+    written &= (fwrite(hierarchy->middles, sizeof(int), numEdges, file) == (size_t) numEdges);
+
+    if (fclose(file) != 0 || written == 0)
+    {
+        printf("Failure: Unable to write '%s'! - (hierarchySave - contractionHierarchy.c)\n", fileName);
+        return 0;
+    }
+
+    return 1;
+}
+
+/*
+    Hierarchy Load:
+        - Reads a hierarchy written by hierarchySave().
+        - Returns pointer to new hierarchy, or 'NULL' if the file is missing or invalid.
+*/
+struct Hierarchy* hierarchyLoad(const char* fileName)
+{
+    FILE* file = fopen(fileName, "rb");
+
+    if (file == NULL)
+    {
+        printf("Failure: Unable to open '%s'! - (hierarchyLoad - contractionHierarchy.c)\n", fileName);
+        return NULL;
+    }
+
+    int header[5];
+
+    if (fread(header, sizeof(int), 5, file) != 5 || header[0] != HIERARCHY_FILE_TAG
+        || header[1] < 0 || header[2] < 0 || header[3] < 0 || header[3] > header[1] || header[4] < 0)
+    {
+        printf("Failure: '%s' is not a hierarchy file! - (hierarchyLoad - contractionHierarchy.c)\n", fileName);
+        fclose(file);
+        return NULL;
+    }
+
+    int numNodes = header[1];
+    int numEdges = header[2];
+    struct Hierarchy* hierarchy = hierarchyAllocate(numNodes, numEdges);
+    char* namePool = malloc(header[4] > 0 ? header[4] : 1);
+
+    hierarchy->numCore = header[3];
+
+    int valid = (fread(namePool, 1, header[4], file) == (size_t) header[4]);
+    valid &= (fread(hierarchy->rank, sizeof(int), numNodes, file) == (size_t) numNodes);
+    valid &= (fread(hierarchy->rowStart, sizeof(int), numNodes + 1, file) == (size_t) numNodes + 1);
+    valid &= (fread(hierarchy->targets, sizeof(int), numEdges, file) == (size_t) numEdges);
+    valid &= (fread(hierarchy->weights, sizeof(int), numEdges, file) == (size_t) numEdges);
+    valid &= (fread(hierarchy->middles, sizeof(int), numEdges, file) == (size_t) numEdges);
+
+    fclose(file);
+
+    // Rebuild the names, one per node.
+    hierarchy->names = graphConstructor(numNodes, 0, header[4]);
+
+    int offset = 0;
+    int node;
+
+    for (node = 0; node < numNodes && valid == 1; node++)
+    {
+        int length = strnlen(&namePool[offset], header[4] - offset);
+
+        if (offset + length >= header[4])
+            valid = 0;
+
+        else graphSetName(hierarchy->names, node, &namePool[offset]);
+
+        offset += length + 1;
+    }
+
+    free(namePool);
+
+    // Check every edge stays within the graph.
+    int edge;
+    for (edge = 0; edge < numEdges && valid == 1; edge++)
+    {
+        if (hierarchy->targets[edge] < 0 || hierarchy->targets[edge] >= numNodes || hierarchy->middles[edge] >= numNodes)
+            valid = 0;
+
+        else if (hierarchy->middles[edge] >= 0)
+            hierarchy->numShortcuts++;
+    }
+
+    if (valid == 0 || hierarchy->rowStart[0] != 0 || hierarchy->rowStart[numNodes] != numEdges)
+    {
+        printf("Failure: '%s' is incomplete! - (hierarchyLoad - contractionHierarchy.c)\n", fileName);
+        hierarchyDestructor(hierarchy);
+        return NULL;
+    }
+
+    graphBuildIndex(hierarchy->names);
+
+    // Return new hierarchy.
+    return hierarchy;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            HIERARCHY QUERY FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Hierarchy Search Constructor:
+        - Allocate memory for a query workspace on a given hierarchy.
+        - Returns pointer to new workspace.
+*/
+struct HierarchySearch* hierarchySearchConstructor(struct Hierarchy* hierarchy)
+{
+    struct HierarchySearch* hierarchySearch = malloc(sizeof(struct HierarchySearch));
+    int numNodes = hierarchy->numNodes > 0 ? hierarchy->numNodes : 1;
+    int direction;
+
+    hierarchySearch->hierarchy = hierarchy;
+    hierarchySearch->epoch = 0;
+
+    for (direction = 0; direction < 2; direction++)
+    {
+        hierarchySearch->stamp[direction] = calloc(numNodes, sizeof(int));
+        hierarchySearch->distance[direction] = malloc(numNodes * sizeof(int));
+        hierarchySearch->back[direction] = malloc(numNodes * sizeof(int));
+        hierarchySearch->heap[direction] = heapConstructor(numNodes);
+        hierarchySearch->coreHeap[direction] = heapConstructor(numNodes);
+    }
+
+    hierarchySearch->chain = malloc(numNodes * sizeof(int));
+    hierarchySearch->startId = -1;
+    hierarchySearch->endId = -1;
+    hierarchySearch->meet = -1;
+    hierarchySearch->best = INT_MAX;
+    hierarchySearch->settledCount = 0;
+
+    // Return new workspace.
+    return hierarchySearch;
+}
+
+/*
+    Hierarchy Search Destructor:
+        - Free memory associated with a query workspace.
+*/
+void hierarchySearchDestructor(struct HierarchySearch* hierarchySearch)
+{
+    if (hierarchySearch == NULL)
+        return;
+
+    int direction;
+    for (direction = 0; direction < 2; direction++)
+    {
+        free(hierarchySearch->stamp[direction]);
+        free(hierarchySearch->distance[direction]);
+        free(hierarchySearch->back[direction]);
+        heapDestructor(hierarchySearch->heap[direction]);
+        heapDestructor(hierarchySearch->coreHeap[direction]);
+    }
+
+    free(hierarchySearch->chain);
+    free(hierarchySearch);
+}
+
+/*
+    Hierarchy Core Search:
+        - Continues a query within the core: bidirectional Dijkstra's algorithm from every core node
+            each upward search reached (at the distance it was reached at).
+        - Core edges run both ways and are not ordered by rank, so unlike the upward searches it stops
+            as soon as the two nearest next nodes add up to no less than the best meeting point.
+            Meeting points are therefore checked whenever either side lowers a node's distance.
+*/
+static void hierarchyCoreSearch(struct HierarchySearch* hierarchySearch)
+{
+    struct Hierarchy* hierarchy = hierarchySearch->hierarchy;
+    int direction;
+
+    while (1)
+    {
+        if (heapIsEmpty(hierarchySearch->coreHeap[0]) || heapIsEmpty(hierarchySearch->coreHeap[1]))
+            break;
+
+        int forwardKey = heapTopKey(hierarchySearch->coreHeap[0]);
+        int backwardKey = heapTopKey(hierarchySearch->coreHeap[1]);
+
+        // No path through the rest of the core can be shorter.
+        if ((long) forwardKey + backwardKey >= hierarchySearch->best)
+            break;
+
+        direction = (forwardKey <= backwardKey) ? 0 : 1;
+
+        int currentDistance;
+        int current = heapPop(hierarchySearch->coreHeap[direction], &currentDistance);
+        int other = 1 - direction;
+
+        hierarchySearch->settledCount++;
+
+        if (hierarchySearch->stamp[other][current] == hierarchySearch->epoch
+            && currentDistance + hierarchySearch->distance[other][current] < hierarchySearch->best)
+        {
+            hierarchySearch->best = currentDistance + hierarchySearch->distance[other][current];
+            hierarchySearch->meet = current;
+        }
+
+        int edge;
+        for (edge = hierarchy->rowStart[current]; edge < hierarchy->rowStart[current + 1]; edge++)
+        {
+            int target = hierarchy->targets[edge];
+            int newDistance = currentDistance + hierarchy->weights[edge];
+
+            if (hierarchySearch->stamp[direction][target] == hierarchySearch->epoch
+                && newDistance >= hierarchySearch->distance[direction][target])
+                continue;
+
+            hierarchySearch->stamp[direction][target] = hierarchySearch->epoch;
+            hierarchySearch->distance[direction][target] = newDistance;
+            hierarchySearch->back[direction][target] = current;
+            heapPush(hierarchySearch->coreHeap[direction], target, newDistance);
+
+            if (hierarchySearch->stamp[other][target] == hierarchySearch->epoch
+                && newDistance + hierarchySearch->distance[other][target] < hierarchySearch->best)
+            {
+                hierarchySearch->best = newDistance + hierarchySearch->distance[other][target];
+                hierarchySearch->meet = target;
+            }
+        }
+    }
+}
+
+/*
+    Hierarchy Shortest Path:
+        - Searches upwards from both node ids at once, always continuing the side with the nearer
+            next node, until neither side's next node is nearer than the best meeting point found.
+        - Core nodes reached are not expanded upwards, they seed hierarchyCoreSearch() instead.
+        - Returns the shortest distance, INT_MAX if unreachable (or an id is invalid).
+*/
+int hierarchyShortestPath(struct HierarchySearch* hierarchySearch, int startId, int endId)
+{
+    struct Hierarchy* hierarchy = hierarchySearch->hierarchy;
+    int direction;
+
+    hierarchySearch->startId = startId;
+    hierarchySearch->endId = endId;
+    hierarchySearch->meet = -1;
+    hierarchySearch->best = INT_MAX;
+    hierarchySearch->settledCount = 0;
+
+    if (startId < 0 || startId >= hierarchy->numNodes)
+    {
+        printf("Failure: %d = Invalid start id! - (hierarchyShortestPath - contractionHierarchy.c)\n", startId);
+        return INT_MAX;
+    }
+
+    if (endId < 0 || endId >= hierarchy->numNodes)
+    {
+        printf("Failure: %d = Invalid end id! - (hierarchyShortestPath - contractionHierarchy.c)\n", endId);
+        return INT_MAX;
+    }
+
+    hierarchySearch->epoch++;
+
+    // Core nodes are ranked above every contracted node.
+    int coreRank = hierarchy->numNodes - hierarchy->numCore;
+
+    for (direction = 0; direction < 2; direction++)
+    {
+        int source = (direction == 0) ? startId : endId;
+
+        heapClear(hierarchySearch->heap[direction]);
+        heapClear(hierarchySearch->coreHeap[direction]);
+        hierarchySearch->stamp[direction][source] = hierarchySearch->epoch;
+        hierarchySearch->distance[direction][source] = 0;
+        hierarchySearch->back[direction][source] = -1;
+        heapPush(hierarchySearch->heap[direction], source, 0);
+    }
+
+    while (1)
+    {
+        int forwardKey = heapIsEmpty(hierarchySearch->heap[0]) ? INT_MAX : heapTopKey(hierarchySearch->heap[0]);
+        int backwardKey = heapIsEmpty(hierarchySearch->heap[1]) ? INT_MAX : heapTopKey(hierarchySearch->heap[1]);
+
+        // Neither side can lead to a shorter meeting point.
+        if ((forwardKey < backwardKey ? forwardKey : backwardKey) >= hierarchySearch->best)
+            break;
+
+        direction = (forwardKey <= backwardKey) ? 0 : 1;
+
+        int currentDistance;
+        int current = heapPop(hierarchySearch->heap[direction], &currentDistance);
+        int other = 1 - direction;
+
+        hierarchySearch->settledCount++;
+
+        // Meeting point reached by the other side as well.
+        if (hierarchySearch->stamp[other][current] == hierarchySearch->epoch
+            && currentDistance + hierarchySearch->distance[other][current] < hierarchySearch->best)
+        {
+            hierarchySearch->best = currentDistance + hierarchySearch->distance[other][current];
+            hierarchySearch->meet = current;
+        }
+
+        int edge;
+        int stalled = 0;
+
+        // Stall on demand: a higher neighbour already reached gives a shorter way down to this node,
+        // so no shortest path continues upwards from it.
+        for (edge = hierarchy->rowStart[current]; edge < hierarchy->rowStart[current + 1] && stalled == 0; edge++)
+        {
+            int target = hierarchy->targets[edge];
+
+            if (hierarchySearch->stamp[direction][target] == hierarchySearch->epoch
+                && hierarchySearch->distance[direction][target] + hierarchy->weights[edge] < currentDistance)
+                stalled = 1;
+        }
+
+        if (stalled == 1)
+            continue;
+
+        // The core is left to the core search.
+        if (hierarchy->rank[current] >= coreRank)
+        {
+            heapPush(hierarchySearch->coreHeap[direction], current, currentDistance);
+            continue;
+        }
+
+        for (edge = hierarchy->rowStart[current]; edge < hierarchy->rowStart[current + 1]; edge++)
+        {
+            int target = hierarchy->targets[edge];
+            int newDistance = currentDistance + hierarchy->weights[edge];
+
+            if (hierarchySearch->stamp[direction][target] != hierarchySearch->epoch
+                || newDistance < hierarchySearch->distance[direction][target])
+            {
+                hierarchySearch->stamp[direction][target] = hierarchySearch->epoch;
+                hierarchySearch->distance[direction][target] = newDistance;
+                hierarchySearch->back[direction][target] = current;
+                heapPush(hierarchySearch->heap[direction], target, newDistance);
+            }
+        }
+    }
+
+    hierarchyCoreSearch(hierarchySearch);
+
+    return hierarchySearch->best;
+}
+
+/*
+    Hierarchy Find Edge:
+        - Returns the index of the edge joining two node ids (held in the row of the lower ranked one),
+            or '-1' if they are not joined.
+*/
+static int hierarchyFindEdge(struct Hierarchy* hierarchy, int node1, int node2)
+{
+    int lower = (hierarchy->rank[node1] < hierarchy->rank[node2]) ? node1 : node2;
+    int upper = (lower == node1) ? node2 : node1;
+    int edge;
+
+    for (edge = hierarchy->rowStart[lower]; edge < hierarchy->rowStart[lower + 1]; edge++)
+        if (hierarchy->targets[edge] == upper)
+            return edge;
+
+    return -1;
+}
+
+/*
+    Hierarchy Unpack:
+        - Appends the original nodes after 'from' on the edge to 'to', replacing each shortcut by the
+            two edges through its middle node, and the original distance of each step if asked for.
+*/
+static void hierarchyUnpack(struct Hierarchy* hierarchy, int from, int to, int* path, int* steps, int* numNodes)
+{
+    int edge = hierarchyFindEdge(hierarchy, from, to);
+    int middle = (edge >= 0) ? hierarchy->middles[edge] : -1;
+
+    if (middle < 0)
+    {
+        if (steps != NULL)
+            steps[*numNodes] = (edge >= 0) ? hierarchy->weights[edge] : 0;
+
+        path[(*numNodes)++] = to;
+        return;
+    }
+
+    hierarchyUnpack(hierarchy, from, middle, path, steps, numNodes);
+    hierarchyUnpack(hierarchy, middle, to, path, steps, numNodes);
+}
+
+/*
+    Hierarchy Unpack Path:
+        - Writes the original node ids (and step distances) of the last path found, start to end.
+        - Returns the number of nodes on the path, '0' if unreachable.
+*/
+static int hierarchyUnpackPath(struct HierarchySearch* hierarchySearch, int* path, int* steps)
+{
+    struct Hierarchy* hierarchy = hierarchySearch->hierarchy;
+    int meet = hierarchySearch->meet;
+
+    if (meet < 0)
+        return 0;
+
+    // Forward half, walked back from the meeting point then unpacked from the start.
+    int chainLength = 0;
+    int current;
+
+    for (current = meet; current != -1; current = hierarchySearch->back[0][current])
+        hierarchySearch->chain[chainLength++] = current;
+
+    int numNodes = 0;
+
+    if (steps != NULL)
+        steps[0] = 0;
+
+    path[numNodes++] = hierarchySearch->chain[chainLength - 1];
+
+    int index;
+    for (index = chainLength - 1; index > 0; index--)
+        hierarchyUnpack(hierarchy, hierarchySearch->chain[index], hierarchySearch->chain[index - 1], path, steps, &numNodes);
+
+    // Backward half, already in order from the meeting point to the end.
+    for (current = meet; hierarchySearch->back[1][current] != -1; current = hierarchySearch->back[1][current])
+        hierarchyUnpack(hierarchy, current, hierarchySearch->back[1][current], path, steps, &numNodes);
+
+    return numNodes;
+}
+
+/*
+    Hierarchy Path:
+        - Writes the original node ids of the last path found into 'path' (room for numNodes ids).
+        - Returns the number of nodes on the path, '0' if unreachable.
+*/
+int hierarchyPath(struct HierarchySearch* hierarchySearch, int* path)
+{
+    return hierarchyUnpackPath(hierarchySearch, path, NULL);
+}
+
+/*
+    Hierarchy Settled Count:
+        - Returns the number of nodes settled by the last query (both directions).
+*/
+int hierarchySettledCount(struct HierarchySearch* hierarchySearch)
+{
+    return hierarchySearch->settledCount;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            HIERARCHY DISPLAY FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Hierarchy Display Path:
+        - Prints the last path found with the distance of every step, as dijkstra() prints its results.
+*/
+void hierarchyDisplayPath(struct HierarchySearch* hierarchySearch)
+{
+    struct Hierarchy* hierarchy = hierarchySearch->hierarchy;
+    int numNodes = hierarchy->numNodes > 0 ? hierarchy->numNodes : 1;
+
+    int* path = malloc(numNodes * sizeof(int));
+    int* steps = malloc(numNodes * sizeof(int));
+    int pathLength = hierarchyUnpackPath(hierarchySearch, path, steps);
+
+    if (pathLength == 0)
+        printf("\tPath not found! - Cities are unreachable.\n");
+
+    else
+    {
+        printf("\tPath: [ ");
+
+        int index;
+        for (index = 0; index < pathLength; index++)
+        {
+            if (index > 0)
+                printf(" -(%dkm)-> ", steps[index]);
+
+            printf("%s", graphCityName(hierarchy->names, path[index]));
+        }
+
+        printf(" ]\n\tThe distance of this path is %dkm.\n", hierarchySearch->best);
+    }
+
+    free(path);
+    free(steps);
+}
+
+/*
+    Hierarchy Report:
+        - Prints the number of nodes, core nodes and upward edges of a hierarchy and its preprocessing time.
+*/
+void hierarchyReport(struct Hierarchy* hierarchy)
+{
+    printf("\nCONTRACTION HIERARCHY - (%d nodes, %d core, %d edges, %d shortcuts, %.3fs preprocessing)\n",
+           hierarchy->numNodes, hierarchy->numCore, hierarchy->numEdges, hierarchy->numShortcuts, hierarchy->buildTime);
+}
@@ -0,0 +1,860 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    customizableRoutes.c:
+        - Source file defining the functions to partition, customize and query an overlay of nested cells
+            (customizable route planning).
+        - Partitioning only reads which cities are connected. Cells of the lowest level are grown breadth
+            first up to OVERLAY_CELL_SIZE cities, then each level grows cells the same way out of whole
+            cells of the level below, OVERLAY_CELL_GROWTH times larger.
+        - Customization reads the path distances. Each cell's clique is found by a search from each of
+            its boundary nodes: within the cell's paths on the lowest level, and across the cliques and
+            joining paths of its cells one level down above that. Cells of a level are customized across
+            the threads, one level after another. A changed distance only changes the cliques of the
+            cells holding both ends of the path and of the cells above them.
+        - A query runs Dijkstra's algorithm from the start, scanning each node on the highest level whose
+            cell holds neither the start nor the end: that cell's clique and the paths leaving it. Nodes
+            within the cells of the start or end are scanned over their paths as usual.
+
+        - Functions:
+            - overlayGrowCells
+            - overlayFindBoundary
+            - overlayCustomizeCell
+            - overlayWorkerThread
+            - overlayCustomizeLevel
+            - overlayConstructor
+            - overlayDestructor
+            - overlayCustomize
+            - overlaySearchConstructor
+            - overlaySearchDestructor
+            - overlayShortestPath
+            - overlaySettledCount
+            - overlayReport
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Include respective header file:
+#include "overlay.h"
+
+// Thread and atomic libraries:
+#include <pthread.h>
+#include <stdatomic.h>
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            OVERLAY STRUCTURES
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    OverlayBuild Structure:
+        - Shared state while customizing one level.
+
+        overlay     - Overlay customized.
+        level       - Level customized.
+        tasks       - Cells to customize.
+        numTasks    - Number of cells.
+        nextTask    - Next unclaimed cell.
+*/
+struct OverlayBuild
+{
+    struct Overlay* overlay;
+    int level;
+
+    int* tasks;
+    int numTasks;
+    atomic_int nextTask;
+};
+
+/*
+    OverlayWorker Structure:
+        - Per-thread customization workspace.
+
+        build       - Shared state.
+        index       - Thread number ('0' is the calling thread).
+        thread      - POSIX thread handle (unused for thread '0').
+        epoch       - Current search number, distances are only valid when stamped with it.
+        stamp       - Search number each node was last reached in.
+        distance    - Tentative distance of each node.
+        heap        - Indexed priority queue of reached nodes.
+*/
+struct OverlayWorker
+{
+    struct OverlayBuild* build;
+    int index;
+    pthread_t thread;
+
+    int epoch;
+    int* stamp;
+    int* distance;
+    struct Heap* heap;
+};
+
+/*
+    OverlaySearch Structure:
+        overlay         - Overlay searched.
+        epoch           - Current query number, distances are only valid when stamped with it.
+        stamp           - Query number each node was last reached in.
+        distance        - Tentative distance of each node.
+        heap            - Indexed priority queue of reached nodes.
+        settledCount    - Number of nodes settled by the last query.
+*/
+struct OverlaySearch
+{
+    struct Overlay* overlay;
+
+    int epoch;
+    int* stamp;
+    int* distance;
+    struct Heap* heap;
+
+    int settledCount;
+};
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        OVERLAY PARTITIONING FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Overlay Grow Cells:
+        - Grows the cells of a level breadth first out of units (cities on the lowest level, cells of the
+            level below above it), adding each reached unit that still fits within the level's size limit.
+*/
+static void overlayGrowCells(struct Overlay* overlay, int level)
+{
+    int numNodes = overlay->numNodes;
+    int numUnits = (level == 0 ? numNodes : overlay->numCells[level - 1]);
+    int* unitOf = (level == 0 ? NULL : overlay->cell[level - 1]);
+    long long limit = OVERLAY_CELL_SIZE;
+    int index, node, edge;
+
+    for (index = 0; index < level; index++)
+        limit *= OVERLAY_CELL_GROWTH;
+
+    // Size of each unit and the units joined by a path either way (repeats allowed).
+    int* unitSize = calloc(numUnits > 0 ? numUnits : 1, sizeof(int));
+    int* unitStart = calloc(numUnits + 1, sizeof(int));
+    int* unitTargets = malloc((overlay->numEdges > 0 ? 2 * overlay->numEdges : 1) * sizeof(int));
+
+    for (node = 0; node < numNodes; node++)
+    {
+        int unit = (level == 0 ? node : unitOf[node]);
+        unitSize[unit]++;
+
+        for (edge = overlay->rowStart[node]; edge < overlay->rowStart[node + 1]; edge++)
+        {
+            int target = (level == 0 ? overlay->targets[edge] : unitOf[overlay->targets[edge]]);
+
+            if (target != unit)
+            {
+                unitStart[unit + 1]++;
+                unitStart[target + 1]++;
+            }
+        }
+    }
+
+    for (index = 0; index < numUnits; index++)
+        unitStart[index + 1] += unitStart[index];
+
+    int* fill = malloc((numUnits > 0 ? numUnits : 1) * sizeof(int));
+    memcpy(fill, unitStart, numUnits * sizeof(int));
+
+    for (node = 0; node < numNodes; node++)
+    {
+        int unit = (level == 0 ? node : unitOf[node]);
+
+        for (edge = overlay->rowStart[node]; edge < overlay->rowStart[node + 1]; edge++)
+        {
+            int target = (level == 0 ? overlay->targets[edge] : unitOf[overlay->targets[edge]]);
+
+            if (target != unit)
+            {
+                unitTargets[fill[unit]++] = target;
+                unitTargets[fill[target]++] = unit;
+            }
+        }
+    }
+
+    // Grow each cell breadth first from the lowest unassigned unit.
+    int* assigned = malloc((numUnits > 0 ? numUnits : 1) * sizeof(int));
+    int* queued = malloc((numUnits > 0 ? numUnits : 1) * sizeof(int));
+    int* queue = malloc((numUnits > 0 ? numUnits : 1) * sizeof(int));
+    int numCells = 0;
+
+    for (index = 0; index < numUnits; index++)
+    {
+        assigned[index] = -1;
+        queued[index] = -1;
+    }
+
+    for (index = 0; index < numUnits; index++)
+    {
+        if (assigned[index] >= 0)
+            continue;
+
+        long long size = 0;
+        int head = 0, tail = 0;
+
+        queue[tail++] = index;
+        queued[index] = numCells;
+
+        while (head < tail)
+        {
+            int unit = queue[head++];
+
+            // Units that no longer fit are left for a later cell.
+            if (size > 0 && size + unitSize[unit] > limit)
+                continue;
+
+            assigned[unit] = numCells;
+            size += unitSize[unit];
+
+            for (edge = unitStart[unit]; edge < unitStart[unit + 1]; edge++)
+            {
+                int target = unitTargets[edge];
+
+                if (assigned[target] < 0 && queued[target] != numCells)
+                {
+                    queued[target] = numCells;
+                    queue[tail++] = target;
+                }
+            }
+        }
+
+        numCells++;
+    }
+
+    overlay->numCells[level] = numCells;
+    overlay->cell[level] = malloc((numNodes > 0 ? numNodes : 1) * sizeof(int));
+
+    for (node = 0; node < numNodes; node++)
+        overlay->cell[level][node] = assigned[level == 0 ? node : unitOf[node]];
+
+    if (level > 0)
+        memcpy(overlay->parent[level - 1], assigned, numUnits * sizeof(int));
+
+    overlay->parent[level] = malloc((numCells > 0 ? numCells : 1) * sizeof(int));
+
+    for (index = 0; index < numCells; index++)
+        overlay->parent[level][index] = -1;
+
+    free(unitSize);
+    free(unitStart);
+    free(unitTargets);
+    free(fill);
+    free(assigned);
+    free(queued);
+    free(queue);
+}
+
+/*
+    Overlay Find Boundary:
+        - Lists the boundary nodes of every cell of a level and reserves their cliques.
+*/
+static void overlayFindBoundary(struct Overlay* overlay, int level)
+{
+    int numNodes = overlay->numNodes;
+    int numCells = overlay->numCells[level];
+    int* cell = overlay->cell[level];
+    int index, node, edge;
+
+    overlay->boundaryIndex[level] = malloc((numNodes > 0 ? numNodes : 1) * sizeof(int));
+    overlay->boundaryStart[level] = calloc(numCells + 1, sizeof(int));
+    overlay->cliqueStart[level] = calloc(numCells + 1, sizeof(long long));
+
+    // Both ends of a path between cells are boundary nodes (paths may be one way), numbered in id order.
+    for (node = 0; node < numNodes; node++)
+        overlay->boundaryIndex[level][node] = -1;
+
+    for (node = 0; node < numNodes; node++)
+        for (edge = overlay->rowStart[node]; edge < overlay->rowStart[node + 1]; edge++)
+            if (cell[overlay->targets[edge]] != cell[node])
+            {
+                overlay->boundaryIndex[level][node] = 0;
+                overlay->boundaryIndex[level][overlay->targets[edge]] = 0;
+            }
+
+    for (node = 0; node < numNodes; node++)
+        if (overlay->boundaryIndex[level][node] == 0)
+            overlay->boundaryIndex[level][node] = overlay->boundaryStart[level][cell[node] + 1]++;
+
+    for (index = 0; index < numCells; index++)
+    {
+        long long numBoundary = overlay->boundaryStart[level][index + 1];
+
+        overlay->boundaryStart[level][index + 1] += overlay->boundaryStart[level][index];
+        overlay->cliqueStart[level][index + 1] = overlay->cliqueStart[level][index] + numBoundary * numBoundary;
+    }
+
+    int numBoundary = overlay->boundaryStart[level][numCells];
+    long long numEntries = overlay->cliqueStart[level][numCells];
+
+    overlay->boundary[level] = malloc((numBoundary > 0 ? numBoundary : 1) * sizeof(int));
+    overlay->clique[level] = malloc((numEntries > 0 ? numEntries : 1) * sizeof(int));
+
+    for (node = 0; node < numNodes; node++)
+        if (overlay->boundaryIndex[level][node] >= 0)
+            overlay->boundary[level][overlay->boundaryStart[level][cell[node]] + overlay->boundaryIndex[level][node]] = node;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        OVERLAY CUSTOMIZATION FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Overlay Customize Cell:
+        - Fills a cell's clique with one search from each of its boundary nodes (see top of file).
+        - Only reads the cliques of the level below, so the cells of one level may be customized at once.
+*/
+static void overlayCustomizeCell(struct Overlay* overlay, struct OverlayWorker* worker, int level, int cellId)
+{
+    const int* boundary = &overlay->boundary[level][overlay->boundaryStart[level][cellId]];
+    int numBoundary = overlay->boundaryStart[level][cellId + 1] - overlay->boundaryStart[level][cellId];
+    int* clique = &overlay->clique[level][overlay->cliqueStart[level][cellId]];
+    const int* cell = overlay->cell[level];
+    const int* lowerCell = (level > 0 ? overlay->cell[level - 1] : NULL);
+    int source, index, edge, distance;
+
+    for (source = 0; source < numBoundary; source++)
+    {
+        worker->epoch++;
+        worker->stamp[boundary[source]] = worker->epoch;
+        worker->distance[boundary[source]] = 0;
+        heapClear(worker->heap);
+        heapPush(worker->heap, boundary[source], 0);
+
+        while (heapIsEmpty(worker->heap) == 0)
+        {
+            int node = heapPop(worker->heap, &distance);
+
+            // Across the clique of the node's cell one level down.
+            if (level > 0)
+            {
+                int lowerId = lowerCell[node];
+                int lowerStart = overlay->boundaryStart[level - 1][lowerId];
+                int lowerCount = overlay->boundaryStart[level - 1][lowerId + 1] - lowerStart;
+                const int* row = &overlay->clique[level - 1][overlay->cliqueStart[level - 1][lowerId]
+                                                             + (long long) overlay->boundaryIndex[level - 1][node] * lowerCount];
+
+                for (index = 0; index < lowerCount; index++)
+                {
+                    int target = overlay->boundary[level - 1][lowerStart + index];
+
+                    if (row[index] == INT_MAX)
+                        continue;
+
+                    if (worker->stamp[target] != worker->epoch || distance + row[index] < worker->distance[target])
+                    {
+                        worker->stamp[target] = worker->epoch;
+                        worker->distance[target] = distance + row[index];
+                        heapPush(worker->heap, target, distance + row[index]);
+                    }
+                }
+            }
+
+            // Along the paths staying within the cell (leaving the node's cell one level down).
+            for (edge = overlay->rowStart[node]; edge < overlay->rowStart[node + 1]; edge++)
+            {
+                int target = overlay->targets[edge];
+                int targetDistance = distance + overlay->weights[edge];
+
+                if (cell[target] != cellId || (level > 0 && lowerCell[target] == lowerCell[node]))
+                    continue;
+
+                if (worker->stamp[target] != worker->epoch || targetDistance < worker->distance[target])
+                {
+                    worker->stamp[target] = worker->epoch;
+                    worker->distance[target] = targetDistance;
+                    heapPush(worker->heap, target, targetDistance);
+                }
+            }
+        }
+
+        for (index = 0; index < numBoundary; index++)
+            clique[(long long) source * numBoundary + index] = (worker->stamp[boundary[index]] == worker->epoch)
+                                                               ? worker->distance[boundary[index]] : INT_MAX;
+    }
+}
+
+/*
+    Overlay Worker Thread:
+        - Claims and customizes cells of the current level until none are left.
+*/
+static void* overlayWorkerThread(void* argument)
+{
+    struct OverlayWorker* worker = argument;
+    struct OverlayBuild* build = worker->build;
+    int task;
+
+    while ((task = atomic_fetch_add(&build->nextTask, 1)) < build->numTasks)
+        overlayCustomizeCell(build->overlay, worker, build->level, build->tasks[task]);
+
+    return NULL;
+}
+
+/*
+    Overlay Customize Level:
+        - Customizes the marked cells of a level across a given number of threads.
+        - Returns the number of cells customized.
+*/
+static int overlayCustomizeLevel(struct Overlay* overlay, int level, char* marked, int numThreads)
+{
+    int numNodes = overlay->numNodes;
+    int index;
+
+    struct OverlayBuild build;
+    build.overlay = overlay;
+    build.level = level;
+    build.tasks = malloc((overlay->numCells[level] > 0 ? overlay->numCells[level] : 1) * sizeof(int));
+    build.numTasks = 0;
+    atomic_store(&build.nextTask, 0);
+
+    for (index = 0; index < overlay->numCells[level]; index++)
+        if (marked[index] == 1)
+            build.tasks[build.numTasks++] = index;
+
+    if (numThreads > build.numTasks)
+        numThreads = build.numTasks;
+
+    struct OverlayWorker* workers = malloc((numThreads > 0 ? numThreads : 1) * sizeof(struct OverlayWorker));
+
+    for (index = 0; index < numThreads; index++)
+    {
+        workers[index].build = &build;
+        workers[index].index = index;
+        workers[index].epoch = 0;
+        workers[index].stamp = calloc(numNodes > 0 ? numNodes : 1, sizeof(int));
+        workers[index].distance = malloc((numNodes > 0 ? numNodes : 1) * sizeof(int));
+        workers[index].heap = heapConstructor(numNodes);
+    }
+
+    for (index = 1; index < numThreads; index++)
+        pthread_create(&workers[index].thread, NULL, overlayWorkerThread, &workers[index]);
+
+    if (numThreads > 0)
+        overlayWorkerThread(&workers[0]);
+
+    for (index = 1; index < numThreads; index++)
+        pthread_join(workers[index].thread, NULL);
+
+    for (index = 0; index < numThreads; index++)
+    {
+        free(workers[index].stamp);
+        free(workers[index].distance);
+        heapDestructor(workers[index].heap);
+    }
+
+    free(workers);
+    free(build.tasks);
+
+    return build.numTasks;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        OVERLAY CONSTRUCTORS/DESTRUCTORS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Overlay Constructor:
+        - Copies which cities of a graph are connected (parallel paths and paths from a city to itself
+            dropped) and partitions them into nested cells.
+        - The overlay keeps its own names, so the graph may be freed afterwards.
+        - Queries need distances, set by a first call to overlayCustomize().
+        - Returns pointer to new overlay, or 'NULL' for an empty graph.
+*/
+struct Overlay* overlayConstructor(struct Graph* graph)
+{
+    double timeStart = timerNow();
+    int numNodes = graph->numNodes;
+    int level, node, edge;
+
+    if (numNodes == 0)
+    {
+        printf("Failure: Graph must contain at least 1 city! - (overlayConstructor - customizableRoutes.c)\n");
+        return NULL;
+    }
+
+    struct Overlay* overlay = malloc(sizeof(struct Overlay));
+    int* seen = malloc(numNodes * sizeof(int));
+
+    overlay->numNodes = numNodes;
+    overlay->rowStart = malloc((numNodes + 1) * sizeof(int));
+    overlay->targets = malloc((graph->numEdges > 0 ? graph->numEdges : 1) * sizeof(int));
+
+    for (node = 0; node < numNodes; node++)
+        seen[node] = -1;
+
+    // One edge per connected neighbour.
+    int numEdges = 0;
+
+    for (node = 0; node < numNodes; node++)
+    {
+        overlay->rowStart[node] = numEdges;
+
+        for (edge = graph->rowStart[node]; edge < graph->rowStart[node + 1]; edge++)
+        {
+            int target = graph->targets[edge];
+
+            if (target != node && seen[target] != node)
+            {
+                seen[target] = node;
+                overlay->targets[numEdges++] = target;
+            }
+        }
+    }
+
+    overlay->rowStart[numNodes] = numEdges;
+    overlay->numEdges = numEdges;
+
+    // No distances until customized ('-1' differs from every path distance).
+    overlay->weights = malloc((numEdges > 0 ? numEdges : 1) * sizeof(int));
+
+    for (edge = 0; edge < numEdges; edge++)
+        overlay->weights[edge] = -1;
+
+    for (level = 0; level < OVERLAY_LEVELS; level++)
+    {
+        overlayGrowCells(overlay, level);
+        overlayFindBoundary(overlay, level);
+    }
+
+    free(seen);
+
+    overlay->names = graphCopyNames(graph);
+    overlay->numCustomized = 0;
+    overlay->customizeTime = 0;
+    overlay->buildTime = timerNow() - timeStart;
+
+    // Return new overlay.
+    return overlay;
+}
+
+/*
+    Overlay Destructor:
+        - Free memory associated with an overlay.
+*/
+void overlayDestructor(struct Overlay* overlay)
+{
+    int level;
+
+    if (overlay == NULL)
+        return;
+
+    for (level = 0; level < OVERLAY_LEVELS; level++)
+    {
+        free(overlay->cell[level]);
+        free(overlay->parent[level]);
+        free(overlay->boundaryIndex[level]);
+        free(overlay->boundaryStart[level]);
+        free(overlay->boundary[level]);
+        free(overlay->cliqueStart[level]);
+        free(overlay->clique[level]);
+    }
+
+    free(overlay->rowStart);
+    free(overlay->targets);
+    free(overlay->weights);
+    graphDestructor(overlay->names);
+    free(overlay);
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            OVERLAY METRIC FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Overlay Customize:
+        - Reads the path distances of a graph holding the same cities and connected pairs as the overlay
+            (matched by name, so a network's frozen graph rebuilt after removePath() and addPath() with a
+            new distance fits), then customizes every cell whose clique the changed paths affect (every
+            cell on the first call).
+        - Returns the number of cells customized, or '-1' if the graph's cities or connected pairs
+            differ from the overlay's (a new overlay is needed, the old distances are kept).
+*/
+int overlayCustomize(struct Overlay* overlay, struct Graph* graph, int numThreads)
+{
+    double timeStart = timerNow();
+    int numNodes = overlay->numNodes;
+    int valid = (graph->numNodes == numNodes);
+    int level, index, node, edge;
+
+    if (numThreads < 1)
+        numThreads = 1;
+
+    // Overlay id of each of the graph's nodes.
+    int* overlayId = malloc((graph->numNodes > 0 ? graph->numNodes : 1) * sizeof(int));
+
+    for (node = 0; node < graph->numNodes && valid == 1; node++)
+    {
+        overlayId[node] = graphCityIndex(overlay->names, graphCityName(graph, node));
+
+        if (overlayId[node] < 0)
+            valid = 0;
+    }
+
+    // Shortest distance between each connected pair.
+    int* weights = malloc((overlay->numEdges > 0 ? overlay->numEdges : 1) * sizeof(int));
+
+    for (edge = 0; edge < overlay->numEdges; edge++)
+        weights[edge] = INT_MAX;
+
+    for (node = 0; node < graph->numNodes && valid == 1; node++)
+    {
+        int from = overlayId[node];
+
+        for (edge = graph->rowStart[node]; edge < graph->rowStart[node + 1] && valid == 1; edge++)
+        {
+            int to = overlayId[graph->targets[edge]];
+            int match = -1;
+
+            if (to == from)
+                continue;
+
+            for (index = overlay->rowStart[from]; index < overlay->rowStart[from + 1]; index++)
+                if (overlay->targets[index] == to)
+                    match = index;
+
+            if (match < 0)
+                valid = 0;
+
+            else if (graph->weights[edge] < weights[match])
+                weights[match] = graph->weights[edge];
+        }
+    }
+
+    for (edge = 0; edge < overlay->numEdges && valid == 1; edge++)
+        if (weights[edge] == INT_MAX)
+            valid = 0;
+
+    free(overlayId);
+
+    if (valid == 0)
+    {
+        printf("Failure: Graph's cities or connected pairs differ from the overlay! - (overlayCustomize - customizableRoutes.c)\n");
+        free(weights);
+        return -1;
+    }
+
+    // Mark the cells holding both ends of each changed path, then every cell above a marked cell.
+    // The first customization marks every cell (a cell holding no path has a clique all the same).
+    int isFirst = (overlay->numEdges > 0 && overlay->weights[0] == -1);
+    char* marked[OVERLAY_LEVELS];
+
+    for (level = 0; level < OVERLAY_LEVELS; level++)
+    {
+        marked[level] = calloc(overlay->numCells[level] > 0 ? overlay->numCells[level] : 1, 1);
+
+        if (isFirst == 1)
+            memset(marked[level], 1, overlay->numCells[level]);
+    }
+
+    for (node = 0; node < numNodes; node++)
+    {
+        for (edge = overlay->rowStart[node]; edge < overlay->rowStart[node + 1]; edge++)
+        {
+            if (weights[edge] == overlay->weights[edge])
+                continue;
+
+            for (level = 0; level < OVERLAY_LEVELS; level++)
+                if (overlay->cell[level][node] == overlay->cell[level][overlay->targets[edge]])
+                    marked[level][overlay->cell[level][node]] = 1;
+        }
+    }
+
+    free(overlay->weights);
+    overlay->weights = weights;
+
+    for (level = 1; level < OVERLAY_LEVELS; level++)
+        for (index = 0; index < overlay->numCells[level - 1]; index++)
+            if (marked[level - 1][index] == 1)
+                marked[level][overlay->parent[level - 1][index]] = 1;
+
+    // Customize level by level, each level reads the cliques of the level below.
+    overlay->numCustomized = 0;
+
+    for (level = 0; level < OVERLAY_LEVELS; level++)
+    {
+        overlay->numCustomized += overlayCustomizeLevel(overlay, level, marked[level], numThreads);
+        free(marked[level]);
+    }
+
+    overlay->customizeTime = timerNow() - timeStart;
+
+    return overlay->numCustomized;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            OVERLAY QUERY FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Overlay Search Constructor:
+        - Allocate memory for a query workspace on a given overlay.
+        - Returns pointer to new workspace.
+*/
+struct OverlaySearch* overlaySearchConstructor(struct Overlay* overlay)
+{
+    struct OverlaySearch* overlaySearch = malloc(sizeof(struct OverlaySearch));
+    int numNodes = overlay->numNodes > 0 ? overlay->numNodes : 1;
+
+    overlaySearch->overlay = overlay;
+    overlaySearch->epoch = 0;
+    overlaySearch->stamp = calloc(numNodes, sizeof(int));
+    overlaySearch->distance = malloc(numNodes * sizeof(int));
+    overlaySearch->heap = heapConstructor(numNodes);
+    overlaySearch->settledCount = 0;
+
+    // Return new workspace.
+    return overlaySearch;
+}
+
+/*
+    Overlay Search Destructor:
+        - Free memory associated with a query workspace.
+*/
+void overlaySearchDestructor(struct OverlaySearch* overlaySearch)
+{
+    if (overlaySearch == NULL)
+        return;
+
+    free(overlaySearch->stamp);
+    free(overlaySearch->distance);
+    heapDestructor(overlaySearch->heap);
+    free(overlaySearch);
+}
+
+/*
+    Overlay Shortest Path:
+        - Runs Dijkstra's algorithm from the start node across the levels of the overlay (see top of
+            file), stopping once the end node is settled.
+        - Returns the shortest distance, or 'INT_MAX' if the cities are unreachable or an id is invalid.
+*/
+int overlayShortestPath(struct OverlaySearch* overlaySearch, int startId, int endId)
+{
+    struct Overlay* overlay = overlaySearch->overlay;
+    int startCell[OVERLAY_LEVELS], endCell[OVERLAY_LEVELS];
+    int level, index, edge, distance;
+
+    if (startId < 0 || startId >= overlay->numNodes || endId < 0 || endId >= overlay->numNodes)
+    {
+        printf("Failure: Invalid node id! - (overlayShortestPath - customizableRoutes.c)\n");
+        return INT_MAX;
+    }
+
+    if (overlaySearch->epoch == INT_MAX)
+    {
+        memset(overlaySearch->stamp, 0, overlay->numNodes * sizeof(int));
+        overlaySearch->epoch = 0;
+    }
+
+    for (level = 0; level < OVERLAY_LEVELS; level++)
+    {
+        startCell[level] = overlay->cell[level][startId];
+        endCell[level] = overlay->cell[level][endId];
+    }
+
+    overlaySearch->epoch++;
+    overlaySearch->settledCount = 0;
+    overlaySearch->stamp[startId] = overlaySearch->epoch;
+    overlaySearch->distance[startId] = 0;
+    heapClear(overlaySearch->heap);
+    heapPush(overlaySearch->heap, startId, 0);
+
+    while (heapIsEmpty(overlaySearch->heap) == 0)
+    {
+        int node = heapPop(overlaySearch->heap, &distance);
+        int nodeCell = -1;
+
+        overlaySearch->settledCount++;
+
+        if (node == endId)
+            return distance;
+
+        // Highest level whose cell holds neither the start nor the end ('-1' if none).
+        for (level = OVERLAY_LEVELS - 1; level >= 0; level--)
+        {
+            nodeCell = overlay->cell[level][node];
+
+            if (nodeCell != startCell[level] && nodeCell != endCell[level])
+                break;
+        }
+
+        // Across the node's clique on that level.
+        if (level >= 0)
+        {
+            int cellStart = overlay->boundaryStart[level][nodeCell];
+            int cellCount = overlay->boundaryStart[level][nodeCell + 1] - cellStart;
+            const int* row = &overlay->clique[level][overlay->cliqueStart[level][nodeCell]
+                                                     + (long long) overlay->boundaryIndex[level][node] * cellCount];
+
+            for (index = 0; index < cellCount; index++)
+            {
+                int target = overlay->boundary[level][cellStart + index];
+
+                if (row[index] == INT_MAX)
+                    continue;
+
+                if (overlaySearch->stamp[target] != overlaySearch->epoch || distance + row[index] < overlaySearch->distance[target])
+                {
+                    overlaySearch->stamp[target] = overlaySearch->epoch;
+                    overlaySearch->distance[target] = distance + row[index];
+                    heapPush(overlaySearch->heap, target, distance + row[index]);
+                }
+            }
+        }
+
+        // Along the paths leaving that cell (every path within the start and end cells).
+        for (edge = overlay->rowStart[node]; edge < overlay->rowStart[node + 1]; edge++)
+        {
+            int target = overlay->targets[edge];
+            int targetDistance = distance + overlay->weights[edge];
+
+            if (level >= 0 && overlay->cell[level][target] == nodeCell)
+                continue;
+
+            if (overlaySearch->stamp[target] != overlaySearch->epoch || targetDistance < overlaySearch->distance[target])
+            {
+                overlaySearch->stamp[target] = overlaySearch->epoch;
+                overlaySearch->distance[target] = targetDistance;
+                heapPush(overlaySearch->heap, target, targetDistance);
+            }
+        }
+    }
+
+    return INT_MAX;
+}
+
+/*
+    Overlay Settled Count:
+        - Returns the number of nodes settled by the last query.
+*/
+int overlaySettledCount(struct OverlaySearch* overlaySearch)
+{
+    return overlaySearch->settledCount;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            OVERLAY DISPLAY FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Overlay Report:
+        - Prints the cells, boundary nodes and clique entries of each level, the partitioning time and
+            the size and time of the last customization.
+*/
+void overlayReport(struct Overlay* overlay)
+{
+    int level;
+
+    printf("\nOVERLAY - (%d nodes, %d levels, %.3fs partitioning, last customization %d cells in %.3fms)\n",
+           overlay->numNodes, OVERLAY_LEVELS, overlay->buildTime, overlay->numCustomized, overlay->customizeTime * 1e3);
+
+    for (level = 0; level < OVERLAY_LEVELS; level++)
+        printf("\tLevel %d: %6d cells, %6d boundary nodes, %10lld clique entries\n", level + 1, overlay->numCells[level],
+               overlay->boundaryStart[level][overlay->numCells[level]], overlay->cliqueStart[level][overlay->numCells[level]]);
+}
@@ -0,0 +1,76 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    delta.h:
+        - Header file for the 'deltaStepping.c' source file.
+        - Defines the public functions to run a single one-to-all shortest path query on a frozen graph
+            across several threads (delta-stepping), for graphs too large for one sequential search.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+#ifndef DELTA_H_INCLUDED
+#define DELTA_H_INCLUDED
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        DELTA LIBRARIES/DEFINITIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// User Created Graph Library:
+#include "graph.h"
+
+/*
+    DELTA_THREADS:
+        - Default number of threads (including the calling thread) used by a delta-stepping search.
+*/
+#define DELTA_THREADS 4
+
+/*
+    DELTA_AUTO:
+        - Pass as the delta (bucket width) to let deltaConstructor() choose one from the graph,
+            (largest edge weight / average degree).
+        - Smaller deltas do less repeated work, larger deltas give each thread more work per phase.
+*/
+#define DELTA_AUTO 0
+
+/*
+    DELTA_CHUNK:
+        - Number of frontier nodes a thread takes at a time within a phase.
+*/
+#define DELTA_CHUNK 64
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        PUBLIC DELTA STRUCTURES
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    DeltaSearch Structure:
+        - Public structure defined in 'deltaStepping.c' source file.
+*/
+struct DeltaSearch;
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                    PUBLIC DELTA FUNCTION DECLARATIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Creates a delta-stepping search (and its thread pool) for a given graph.
+struct DeltaSearch* deltaConstructor(struct Graph* graph, int numThreads, int delta);
+
+// Stops the thread pool and frees memory associated with a delta-stepping search.
+void deltaDestructor(struct DeltaSearch* deltaSearch);
+
+// Returns the bucket width chosen for a delta-stepping search.
+int deltaWidth(struct DeltaSearch* deltaSearch);
+
+// Finds the shortest distance from a node id to every other node id.
+int deltaShortestPaths(struct DeltaSearch* deltaSearch, int startId);
+
+// Returns the shortest distance to a node id found by the last search (INT_MAX if unreachable).
+int deltaDistance(struct DeltaSearch* deltaSearch, int id);
+
+// Writes the node ids of the path from the start to a given node id, returns the number of nodes.
+int deltaPath(struct DeltaSearch* deltaSearch, int endId, int* path);
+
+#endif // DELTA_H_INCLUDED
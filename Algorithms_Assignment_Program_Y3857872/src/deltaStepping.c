@@ -0,0 +1,590 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    deltaStepping.c:
+        - Source file defining a parallel one-to-all shortest path engine (Meyer and Sanders' delta-stepping).
+        - Tentative distances are grouped into buckets of width delta. Every node within the lowest
+            non-empty bucket is relaxed at the same time by a pool of threads, instead of one node at a
+            time in priority order as in Dijkstra's algorithm.
+            - Light edges (weight <= delta) may refill the current bucket, so it is relaxed in phases
+                until it stays empty.
+            - Heavy edges (weight > delta) can only reach later buckets, so they are relaxed once for
+                every node removed from the bucket.
+        - Distances and back nodes are packed into one 64-bit word and lowered with compare-and-swap, so
+            the final distances match the sequential engine and every back node matches its distance.
+        - Threads wait on two barriers per phase, the calling thread takes part as thread '0' and files
+            the improved nodes into their buckets between phases.
+
+        - Functions:
+            - bucketAppend
+            - deltaWorkerThread
+            - deltaConstructor
+            - deltaDestructor
+            - deltaWidth
+            - deltaRelax
+            - deltaRunPhase
+            - deltaPhase
+            - deltaFileImproved
+            - deltaShortestPaths
+            - deltaDistance
+            - deltaPath
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Include respective header file:
+#include "delta.h"
+
+// Thread and atomic libraries:
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+
+// Phase types run by the thread pool.
+#define DELTA_PHASE_RESET 0
+#define DELTA_PHASE_LIGHT 1
+#define DELTA_PHASE_HEAVY 2
+#define DELTA_PHASE_STOP 3
+
+// Packed state of an unreached node (distance INT_MAX, no back node).
+#define DELTA_UNREACHED ((uint64_t) INT_MAX << 32)
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            DELTA STRUCTURES
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Bucket Structure:
+        size        - Number of node ids within the bucket.
+        capacity    - Capacity of the node id array.
+        ids         - Growable array of node ids (may hold stale ids, checked when removed).
+*/
+struct Bucket
+{
+    int size;
+    int capacity;
+    int* ids;
+};
+
+/*
+    DeltaWorker Structure:
+        owner       - Delta-stepping search the thread belongs to.
+        thread      - POSIX thread handle (unused for thread '0', the calling thread).
+        improved    - Nodes improved by this thread during the current phase.
+*/
+struct DeltaWorker
+{
+    struct DeltaSearch* owner;
+    pthread_t thread;
+    struct Bucket improved;
+};
+
+/*
+    DeltaSearch Structure:
+        graph           - Graph the search was created for.
+        delta           - Bucket width.
+        numThreads      - Number of threads, including the calling thread.
+        workers         - Per-thread state.
+
+        state           - Packed (distance << 32 | back node + 1) of every node.
+        improvedStamp   - Phase in which each node was last added to an improved list.
+        frontierStamp   - Frontier epoch in which each node was last added to the frontier.
+        removedStamp    - Bucket epoch in which each node was last removed from the current bucket.
+        stampEpoch      - Current frontier/bucket epoch.
+
+        numBuckets      - Number of buckets in the ring (every tentative distance fits within it).
+        buckets         - Ring of buckets, bucket 'i' is held at 'i % numBuckets'.
+        pending         - Number of node ids held within all buckets.
+        frontier        - Nodes relaxed by the current light phase.
+        removed         - Nodes removed from the current bucket, relaxed by its heavy phase.
+
+        phase           - Type of the current phase.
+        phaseId         - Identifier of the current phase.
+        phaseIds        - Node ids the current phase works on.
+        phaseSize       - Number of node ids (or nodes for a reset phase).
+        nextChunk       - Next unclaimed position within the phase.
+        startBarrier    - Barrier the threads wait on before a phase.
+        endBarrier      - Barrier the threads wait on after a phase.
+*/
+struct DeltaSearch
+{
+    struct Graph* graph;
+    int delta;
+    int numThreads;
+    struct DeltaWorker* workers;
+
+    _Atomic uint64_t* state;
+    atomic_int* improvedStamp;
+    int* frontierStamp;
+    int* removedStamp;
+    int stampEpoch;
+
+    int numBuckets;
+    struct Bucket* buckets;
+    long pending;
+    struct Bucket frontier;
+    struct Bucket removed;
+
+    int phase;
+    int phaseId;
+    int* phaseIds;
+    int phaseSize;
+    atomic_int nextChunk;
+    pthread_barrier_t startBarrier;
+    pthread_barrier_t endBarrier;
+};
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        DELTA CONSTRUCTORS/DESTRUCTORS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+static void deltaRunPhase(struct DeltaSearch* deltaSearch, struct DeltaWorker* worker);
+
+/*
+    Bucket Append:
+        - Adds a node id to the end of a bucket, doubling its capacity when full.
+*/
+static void bucketAppend(struct Bucket* bucket, int id)
+{
+    if (bucket->size >= bucket->capacity)
+    {
+        bucket->capacity = bucket->capacity > 0 ? bucket->capacity * 2 : 16;
+        bucket->ids = realloc(bucket->ids, bucket->capacity * sizeof(int));
+    }
+
+    bucket->ids[bucket->size++] = id;
+}
+
+/*
+    Delta Worker Thread:
+        - Runs every phase of every search on one pool thread until the search is destroyed.
+*/
+static void* deltaWorkerThread(void* argument)
+{
+    struct DeltaWorker* worker = argument;
+    struct DeltaSearch* deltaSearch = worker->owner;
+
+    while (1)
+    {
+        pthread_barrier_wait(&deltaSearch->startBarrier);
+
+        if (deltaSearch->phase == DELTA_PHASE_STOP)
+            break;
+
+        deltaRunPhase(deltaSearch, worker);
+
+        pthread_barrier_wait(&deltaSearch->endBarrier);
+    }
+
+    return NULL;
+}
+
+/*
+    Delta Constructor:
+        - Allocate memory for a delta-stepping search on a given graph and start its thread pool.
+        - A delta of DELTA_AUTO chooses the bucket width from the graph's weights and degree.
+        - Returns pointer to new delta-stepping search.
+*/
+struct DeltaSearch* deltaConstructor(struct Graph* graph, int numThreads, int delta)
+{
+    struct DeltaSearch* deltaSearch = malloc(sizeof(struct DeltaSearch));
+    int numNodes = graph->numNodes > 0 ? graph->numNodes : 1;
+    int index;
+
+    if (numThreads < 1)
+        numThreads = 1;
+
+    // Find the largest edge weight (sizes the bucket ring).
+    int maxWeight = 1;
+    for (index = 0; index < graph->numEdges; index++)
+    {
+        if (graph->weights[index] > maxWeight)
+            maxWeight = graph->weights[index];
+    }
+
+    // Automatic delta: about one light edge per node within a bucket.
+    if (delta <= DELTA_AUTO)
+    {
+        int averageDegree = graph->numNodes > 0 ? graph->numEdges / graph->numNodes : 1;
+        delta = maxWeight / (averageDegree > 1 ? averageDegree : 1);
+    }
+
+    if (delta < 1)
+        delta = 1;
+
+    deltaSearch->graph = graph;
+    deltaSearch->delta = delta;
+    deltaSearch->numThreads = numThreads;
+
+    // Reserve memory for the per-node values.
+    deltaSearch->state = malloc(numNodes * sizeof(_Atomic uint64_t));
+    deltaSearch->improvedStamp = malloc(numNodes * sizeof(atomic_int));
+    deltaSearch->frontierStamp = calloc(numNodes, sizeof(int));
+    deltaSearch->removedStamp = calloc(numNodes, sizeof(int));
+    deltaSearch->stampEpoch = 0;
+
+    for (index = 0; index < numNodes; index++)
+    {
+        atomic_init(&deltaSearch->state[index], DELTA_UNREACHED);
+        atomic_init(&deltaSearch->improvedStamp[index], 0);
+    }
+
+    // Tentative distances never exceed the current bucket by more than the largest weight.
+    deltaSearch->numBuckets = maxWeight / delta + 2;
+    deltaSearch->buckets = calloc(deltaSearch->numBuckets, sizeof(struct Bucket));
+    deltaSearch->pending = 0;
+    memset(&deltaSearch->frontier, 0, sizeof(struct Bucket));
+    memset(&deltaSearch->removed, 0, sizeof(struct Bucket));
+
+    deltaSearch->phase = DELTA_PHASE_RESET;
+    deltaSearch->phaseId = 0;
+    deltaSearch->phaseIds = NULL;
+    deltaSearch->phaseSize = 0;
+    atomic_init(&deltaSearch->nextChunk, 0);
+
+    // Start the thread pool, thread '0' is the calling thread.
+    deltaSearch->workers = calloc(numThreads, sizeof(struct DeltaWorker));
+
+    if (numThreads > 1)
+    {
+        pthread_barrier_init(&deltaSearch->startBarrier, NULL, numThreads);
+        pthread_barrier_init(&deltaSearch->endBarrier, NULL, numThreads);
+    }
+
+    for (index = 0; index < numThreads; index++)
+    {
+        deltaSearch->workers[index].owner = deltaSearch;
+
+        if (index > 0)
+            pthread_create(&deltaSearch->workers[index].thread, NULL, deltaWorkerThread, &deltaSearch->workers[index]);
+    }
+
+    // Return new delta-stepping search.
+    return deltaSearch;
+}
+
+/*
+    Delta Destructor:
+        - Stops the thread pool and frees memory associated with a delta-stepping search.
+*/
+void deltaDestructor(struct DeltaSearch* deltaSearch)
+{
+    int index;
+
+    if (deltaSearch == NULL)
+        return;
+
+    // Release the pool threads with a stop phase and wait for them to finish.
+    if (deltaSearch->numThreads > 1)
+    {
+        deltaSearch->phase = DELTA_PHASE_STOP;
+        pthread_barrier_wait(&deltaSearch->startBarrier);
+
+        for (index = 1; index < deltaSearch->numThreads; index++)
+            pthread_join(deltaSearch->workers[index].thread, NULL);
+
+        pthread_barrier_destroy(&deltaSearch->startBarrier);
+        pthread_barrier_destroy(&deltaSearch->endBarrier);
+    }
+
+    for (index = 0; index < deltaSearch->numThreads; index++)
+        free(deltaSearch->workers[index].improved.ids);
+
+    for (index = 0; index < deltaSearch->numBuckets; index++)
+        free(deltaSearch->buckets[index].ids);
+
+    free(deltaSearch->workers);
+    free(deltaSearch->buckets);
+    free(deltaSearch->frontier.ids);
+    free(deltaSearch->removed.ids);
+    free(deltaSearch->state);
+    free(deltaSearch->improvedStamp);
+    free(deltaSearch->frontierStamp);
+    free(deltaSearch->removedStamp);
+    free(deltaSearch);
+}
+
+/*
+    Delta Width:
+        - Returns the bucket width (delta) of a given delta-stepping search.
+*/
+int deltaWidth(struct DeltaSearch* deltaSearch)
+{
+    return deltaSearch->delta;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            DELTA PHASE FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Delta Relax:
+        - Lowers a node's distance (and sets its back node) if a new distance is shorter, safe to call
+            from several threads at once.
+        - Returns indication if the node was improved.
+            '1' -> Distance lowered.
+            '0' -> Node already has an equal or shorter distance.
+*/
+static int deltaRelax(struct DeltaSearch* deltaSearch, int id, int newDistance, int backId)
+{
+    uint64_t newState = ((uint64_t) newDistance << 32) | (uint32_t) (backId + 1);
+    uint64_t oldState = atomic_load_explicit(&deltaSearch->state[id], memory_order_relaxed);
+
+    while ((int) (oldState >> 32) > newDistance)
+    {
+        if (atomic_compare_exchange_weak_explicit(&deltaSearch->state[id], &oldState, newState,
+                                                  memory_order_relaxed, memory_order_relaxed))
+            return 1;
+    }
+
+    return 0;
+}
+
+/*
+    Delta Run Phase:
+        - Work done by one thread within a phase, taking DELTA_CHUNK positions at a time until none remain.
+            Reset phase -> Marks nodes as unreached.
+            Light phase -> Relaxes the light edges of the frontier nodes.
+            Heavy phase -> Relaxes the heavy edges of the nodes removed from the current bucket.
+        - Improved nodes are added (once per phase) to the thread's own improved list.
+*/
+static void deltaRunPhase(struct DeltaSearch* deltaSearch, struct DeltaWorker* worker)
+{
+    struct Graph* graph = deltaSearch->graph;
+    int delta = deltaSearch->delta;
+    int phase = deltaSearch->phase;
+    int phaseId = deltaSearch->phaseId;
+
+    while (1)
+    {
+        int begin = atomic_fetch_add_explicit(&deltaSearch->nextChunk, DELTA_CHUNK, memory_order_relaxed);
+
+        if (begin >= deltaSearch->phaseSize)
+            break;
+
+        int end = begin + DELTA_CHUNK < deltaSearch->phaseSize ? begin + DELTA_CHUNK : deltaSearch->phaseSize;
+        int position;
+
+        for (position = begin; position < end; position++)
+        {
+            if (phase == DELTA_PHASE_RESET)
+            {
+                atomic_store_explicit(&deltaSearch->state[position], DELTA_UNREACHED, memory_order_relaxed);
+                atomic_store_explicit(&deltaSearch->improvedStamp[position], 0, memory_order_relaxed);
+                continue;
+            }
+
+            int currentCity = deltaSearch->phaseIds[position];
+            int currentDistance = (int) (atomic_load_explicit(&deltaSearch->state[currentCity], memory_order_relaxed) >> 32);
+
+            int edge;
+            for (edge = graph->rowStart[currentCity]; edge < graph->rowStart[currentCity + 1]; edge++)
+            {
+                int weight = graph->weights[edge];
+
+                // Light phases only relax light edges, heavy phases only heavy edges.
+                if ((weight <= delta) != (phase == DELTA_PHASE_LIGHT))
+                    continue;
+
+                int connectedCity = graph->targets[edge];
+
+                if (deltaRelax(deltaSearch, connectedCity, currentDistance + weight, currentCity) == 1
+                    && atomic_exchange_explicit(&deltaSearch->improvedStamp[connectedCity], phaseId, memory_order_relaxed) != phaseId)
+                    bucketAppend(&worker->improved, connectedCity);
+            }
+        }
+    }
+}
+
+/*
+    Delta Phase:
+        - Runs one phase over a given array of node ids (or every node for a reset phase) on every thread,
+            returning once all threads have finished.
+*/
+static void deltaPhase(struct DeltaSearch* deltaSearch, int phase, int* ids, int size)
+{
+    deltaSearch->phase = phase;
+    deltaSearch->phaseId++;
+    deltaSearch->phaseIds = ids;
+    deltaSearch->phaseSize = size;
+    atomic_store(&deltaSearch->nextChunk, 0);
+
+    // Small phases are not worth waking the pool for.
+    if (deltaSearch->numThreads == 1 || size <= DELTA_CHUNK)
+    {
+        deltaRunPhase(deltaSearch, &deltaSearch->workers[0]);
+        return;
+    }
+
+    pthread_barrier_wait(&deltaSearch->startBarrier);
+    deltaRunPhase(deltaSearch, &deltaSearch->workers[0]);
+    pthread_barrier_wait(&deltaSearch->endBarrier);
+}
+
+/*
+    Delta File Improved:
+        - Moves every thread's improved nodes into the bucket of their current distance.
+*/
+static void deltaFileImproved(struct DeltaSearch* deltaSearch)
+{
+    int threadIndex, index;
+
+    for (threadIndex = 0; threadIndex < deltaSearch->numThreads; threadIndex++)
+    {
+        struct Bucket* improved = &deltaSearch->workers[threadIndex].improved;
+
+        for (index = 0; index < improved->size; index++)
+        {
+            int id = improved->ids[index];
+            int distance = (int) (atomic_load_explicit(&deltaSearch->state[id], memory_order_relaxed) >> 32);
+
+            bucketAppend(&deltaSearch->buckets[(distance / deltaSearch->delta) % deltaSearch->numBuckets], id);
+            deltaSearch->pending++;
+        }
+
+        improved->size = 0;
+    }
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            DELTA SEARCH FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Delta Shortest Paths:
+        - Finds the shortest distance (and back node) from a given node id to every node of the graph.
+        - Returns indication if function was successful.
+            '1' -> Search complete.
+            '0' -> Invalid start node id.
+*/
+int deltaShortestPaths(struct DeltaSearch* deltaSearch, int startId)
+{
+    struct Graph* graph = deltaSearch->graph;
+    int index;
+
+    if (startId < 0 || startId >= graph->numNodes)
+    {
+        printf("Failure: %d = Invalid start id! - (deltaShortestPaths - deltaStepping.c)\n", startId);
+        return 0;
+    }
+
+    // Forget the previous search on every thread.
+    deltaPhase(deltaSearch, DELTA_PHASE_RESET, NULL, graph->numNodes);
+    deltaSearch->phaseId = 0;
+
+    for (index = 0; index < deltaSearch->numBuckets; index++)
+        deltaSearch->buckets[index].size = 0;
+
+    // Start node is the only node in bucket '0'.
+    atomic_store(&deltaSearch->state[startId], (uint64_t) 0);
+    bucketAppend(&deltaSearch->buckets[0], startId);
+    deltaSearch->pending = 1;
+
+    int currentBucket = 0;
+
+    while (deltaSearch->pending > 0)
+    {
+        struct Bucket* bucket = &deltaSearch->buckets[currentBucket % deltaSearch->numBuckets];
+
+        // Skip to the next non-empty bucket.
+        if (bucket->size == 0)
+        {
+            currentBucket++;
+            continue;
+        }
+
+        // Stamps are epoch based, only cleared on the rare overflow.
+        if (deltaSearch->stampEpoch >= INT_MAX - 2)
+        {
+            memset(deltaSearch->frontierStamp, 0, graph->numNodes * sizeof(int));
+            memset(deltaSearch->removedStamp, 0, graph->numNodes * sizeof(int));
+            deltaSearch->stampEpoch = 0;
+        }
+
+        int removedEpoch = ++deltaSearch->stampEpoch;
+        deltaSearch->removed.size = 0;
+
+        // Relax light edges until the bucket stays empty.
+        while (bucket->size > 0)
+        {
+            int frontierEpoch = ++deltaSearch->stampEpoch;
+            deltaSearch->frontier.size = 0;
+
+            for (index = 0; index < bucket->size; index++)
+            {
+                int id = bucket->ids[index];
+                int distance = (int) (atomic_load_explicit(&deltaSearch->state[id], memory_order_relaxed) >> 32);
+
+                // Skip stale entries (node has since moved to an earlier bucket) and duplicates.
+                if (distance / deltaSearch->delta != currentBucket || deltaSearch->frontierStamp[id] == frontierEpoch)
+                    continue;
+
+                deltaSearch->frontierStamp[id] = frontierEpoch;
+                bucketAppend(&deltaSearch->frontier, id);
+
+                if (deltaSearch->removedStamp[id] != removedEpoch)
+                {
+                    deltaSearch->removedStamp[id] = removedEpoch;
+                    bucketAppend(&deltaSearch->removed, id);
+                }
+            }
+
+            deltaSearch->pending -= bucket->size;
+            bucket->size = 0;
+
+            deltaPhase(deltaSearch, DELTA_PHASE_LIGHT, deltaSearch->frontier.ids, deltaSearch->frontier.size);
+            deltaFileImproved(deltaSearch);
+        }
+
+        // Heavy edges of every node removed from the bucket lead to later buckets only.
+        deltaPhase(deltaSearch, DELTA_PHASE_HEAVY, deltaSearch->removed.ids, deltaSearch->removed.size);
+        deltaFileImproved(deltaSearch);
+
+        currentBucket++;
+    }
+
+    return 1;
+}
+
+/*
+    Delta Distance:
+        - Returns the shortest distance from the last search's start to a given node id.
+        - Returns INT_MAX if the node id was not reached.
+*/
+int deltaDistance(struct DeltaSearch* deltaSearch, int id)
+{
+    return (int) (atomic_load(&deltaSearch->state[id]) >> 32);
+}
+
+/*
+    Delta Path:
+        - Writes the node ids of the shortest path from the last search's start to a given node id
+            into 'path' (if not NULL), in order from start to end.
+        - Returns the number of nodes on the path ('0' if the node id was not reached).
+*/
+int deltaPath(struct DeltaSearch* deltaSearch, int endId, int* path)
+{
+    int length = 0;
+    int id;
+
+    if (deltaDistance(deltaSearch, endId) == INT_MAX)
+        return 0;
+
+    // Count the nodes by back propagating from the end node.
+    for (id = endId; id >= 0; id = (int) (uint32_t) atomic_load(&deltaSearch->state[id]) - 1)
+        length++;
+
+    // Write the nodes from the end of the path backwards.
+    if (path != NULL)
+    {
+        int position = length;
+
+        for (id = endId; id >= 0; id = (int) (uint32_t) atomic_load(&deltaSearch->state[id]) - 1)
+            path[--position] = id;
+    }
+
+    return length;
+}
@@ -0,0 +1,644 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    dijkstraSearch.c:
+        - Source file defining the shortest path engine used by dijkstra() and the batch pipeline.
+        - Runs Dijkstra's algorithm on a frozen graph, keeping every per-query value inside a 'Search'
+            workspace instead of the network nodes, so one graph can be searched by many threads at once.
+        - Uses an indexed binary heap with decrease-key as the priority queue.
+        - Edges are relaxed a whole row at a time by the vector kernels within 'relaxKernel.c'.
+
+        - Functions:
+            - searchConstructor
+            - searchDestructor
+            - searchReset
+            - searchDistance
+            - searchIsSettled
+            - searchShortestPath
+            - searchShortestPathWithin
+            - searchSetLimits
+            - searchLimitsExpired
+            - searchStartBlocks
+            - searchBlockEdge
+            - searchBlockNode
+            - searchClearBlocks
+            - searchPath
+            - textAppend
+            - searchStatusText
+            - searchQuery
+            - searchQueryIds
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Include respective header file:
+#include "search.h"
+
+// Edge relaxation kernels:
+#include "relax.h"
+
+// Landmark (A*) searches:
+#include "landmarks.h"
+
+// Arc flag searches:
+#include "arcFlags.h"
+
+// Variable argument library used to format result text:
+#include <stdarg.h>
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        SEARCH CONSTRUCTORS/DESTRUCTORS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Search Constructor:
+        - Allocate memory for a new search workspace sized to a given graph.
+        - Returns pointer to new search workspace.
+*/
+struct Search* searchConstructor(struct Graph* graph)
+{
+    struct Search* search = malloc(sizeof(struct Search));
+    int numNodes = graph->numNodes > 0 ? graph->numNodes : 1;
+
+    search->graph = graph;
+
+    // Choose the relaxation kernel for this processor (first workspace only).
+    relaxKernelInit();
+
+    // Reserve memory for the per-node values, stamps start at '0' so no node is valid in epoch '1'.
+    search->epoch = 0;
+    search->stamp = calloc(numNodes, sizeof(int));
+    search->settledStamp = calloc(numNodes, sizeof(int));
+    search->distance = malloc(numNodes * sizeof(int));
+    search->back = malloc(numNodes * sizeof(int));
+
+    search->heap = heapConstructor(numNodes);
+
+    search->start = -1;
+    search->settledCount = 0;
+
+    // No blocks until one is requested.
+    search->hasBlocks = 0;
+    search->blockEpoch = 0;
+    search->edgeBlocked = NULL;
+    search->nodeBlocked = NULL;
+
+    // Plain Dijkstra until landmarks are set.
+    search->landmarks = NULL;
+    search->potential = NULL;
+
+    // Plain Dijkstra until arc flags are set.
+    search->arcFlags = NULL;
+
+    // Every pair is searched until component labels are set.
+    search->component = NULL;
+
+    // Searches run to completion until limits are set.
+    search->hasLimits = 0;
+    search->limits.timeLimit = 0;
+    search->limits.maxSettled = 0;
+    search->limits.cancel = NULL;
+    search->deadline = 0;
+    search->status = SEARCH_STATUS_COMPLETE;
+
+    // Return new search workspace.
+    return search;
+}
+
+/*
+    Search Destructor:
+        - Free memory associated with a search workspace.
+*/
+void searchDestructor(struct Search* search)
+{
+    if (search == NULL)
+        return;
+
+    free(search->stamp);
+    free(search->settledStamp);
+    free(search->distance);
+    free(search->back);
+    free(search->edgeBlocked);
+    free(search->nodeBlocked);
+    free(search->potential);
+    heapDestructor(search->heap);
+    free(search);
+}
+
+/*
+    Search Reset:
+        - Starts a new search from a given node id.
+        - Moving to the next epoch invalidates every node value at once, only on the rare epoch
+            overflow are the stamp arrays cleared.
+*/
+void searchReset(struct Search* search, int startId)
+{
+    if (search->epoch == INT_MAX)
+    {
+        memset(search->stamp, 0, search->graph->numNodes * sizeof(int));
+        memset(search->settledStamp, 0, search->graph->numNodes * sizeof(int));
+        search->epoch = 0;
+    }
+
+    search->epoch++;
+    search->settledCount = 0;
+    search->start = startId;
+    search->status = SEARCH_STATUS_COMPLETE;
+
+    // Every search gets the full time limit from its own start.
+    if (search->hasLimits == 1 && search->limits.timeLimit > 0)
+        search->deadline = timerNow() + search->limits.timeLimit;
+
+    heapClear(search->heap);
+
+    // Initialise starting position.
+    if (startId >= 0)
+    {
+        search->stamp[startId] = search->epoch;
+        search->distance[startId] = 0;
+        search->back[startId] = -1;
+        heapPush(search->heap, startId, 0);
+    }
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            SEARCH STATE FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Search Distance:
+        - Returns the shortest known distance from the start to a given node id.
+        - Returns INT_MAX if the node has not been reached by the current search.
+*/
+int searchDistance(struct Search* search, int id)
+{
+    if (search->stamp[id] != search->epoch)
+        return INT_MAX;
+
+    return search->distance[id];
+}
+
+/*
+    Search Is Settled:
+        - Checks if a given node id has been settled (its distance is final).
+            '1' -> Node settled.
+            '0' -> Node not yet settled.
+*/
+int searchIsSettled(struct Search* search, int id)
+{
+    if (search->settledStamp[id] == search->epoch)
+        return 1;
+
+    else return 0;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            SEARCH DIJKSTRA'S ALGORITHM
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Search Shortest Path:
+        - Performs Dijkstra's algorithm between two node ids.
+        - Stops as soon as the end node is settled, an end id of '-1' settles every reachable node.
+        - Returns indication if the end node was reached.
+            '1' -> End node settled (or every reachable node settled for an end id of '-1').
+            '0' -> Cities are unreachable.
+*/
+int searchShortestPath(struct Search* search, int startId, int endId)
+{
+    return searchShortestPathWithin(search, startId, endId, INT_MAX);
+}
+
+/*
+    Search Shortest Path Within:
+        - Performs Dijkstra's algorithm between two node ids, skipping blocked edges and nodes.
+        - Stops as soon as the end node is settled, an end id of '-1' settles every reachable node.
+        - Gives up once the closest unsettled node is further than 'maxDistance' from the start.
+        - Searches with an end node run as A* instead when the workspace has landmarks (see 'landmarks.h'),
+            or over the flagged edges only when it has arc flags (see 'arcFlags.h').
+        - An end node within another component (when the workspace has component labels) is reported
+            unreachable straight away, instead of settling the start's whole component first.
+        - Stops early once a limit of the workspace expires (see searchSetLimits()), the reason is
+            left within 'search->status' and searchDistance() gives the best distance known so far.
+        - Returns indication if the end node was reached.
+            '1' -> End node settled (or every node within range settled for an end id of '-1').
+            '0' -> Cities are unreachable, further apart than 'maxDistance' or a limit expired.
+        - (Code referenced from Vaidehi Joshi - Reference [8])
+*/
+int searchShortestPathWithin(struct Search* search, int startId, int endId, int maxDistance)
+{
+    int currentDistance;
+
+    if (search->component != NULL && endId >= 0 && search->component[startId] != search->component[endId])
+    {
+        searchReset(search, startId);
+        return 0;
+    }
+
+    if (search->landmarks != NULL && endId >= 0)
+        return searchShortestPathLandmarks(search, startId, endId, maxDistance);
+
+    if (search->arcFlags != NULL && endId >= 0)
+        return searchShortestPathArcFlags(search, startId, endId, maxDistance);
+
+    searchReset(search, startId);
+
+    while (heapIsEmpty(search->heap) == 0)
+    {
+        // Stop once every remaining node is out of range.
+        if (heapTopKey(search->heap) > maxDistance)
+            break;
+
+        // Stop once the query has used up its time or budget.
+        if (search->hasLimits == 1 && searchLimitsExpired(search) == 1)
+            return 0;
+
+        // Set next current city to the city with shortest total distance within the heap.
+        int currentCity = heapPop(search->heap, &currentDistance);
+
+        // Current city is now fully explored.
+        search->settledStamp[currentCity] = search->epoch;
+        search->settledCount++;
+
+        if (currentCity == endId)
+            return 1;
+
+        // Relax every edge of the current city, improved cities are pushed onto the heap.
+        relaxRow(search, currentCity, currentDistance);
+    }
+
+    // Heap exhausted, only a one-to-all search counts as complete.
+    if (endId < 0)
+        return 1;
+
+    return 0;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            SEARCH LIMIT FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Search Set Limits:
+        - Copies a deadline, settled node budget and cancellation token applied to every following
+            search of the workspace. Passing 'NULL' (or no limit at all) lets searches run to completion.
+*/
+void searchSetLimits(struct Search* search, struct SearchLimits* limits)
+{
+    if (limits == NULL || (limits->timeLimit <= 0 && limits->maxSettled <= 0 && limits->cancel == NULL))
+    {
+        search->hasLimits = 0;
+        search->limits.timeLimit = 0;
+        search->limits.maxSettled = 0;
+        search->limits.cancel = NULL;
+        return;
+    }
+
+    search->hasLimits = 1;
+    search->limits = *limits;
+}
+
+/*
+    Search Limits Expired:
+        - Checks the current search against the workspace's limits before settling another node.
+        - The clock is only read every SEARCH_LIMITS_CLOCK_INTERVAL settled nodes, so a deadline costs
+            next to nothing on short searches.
+        - Returns indication if the search has to stop.
+            '1' -> Limit expired, 'search->status' holds which.
+            '0' -> Search may continue.
+*/
+int searchLimitsExpired(struct Search* search)
+{
+    struct SearchLimits* limits = &search->limits;
+
+    if (limits->maxSettled > 0 && search->settledCount >= limits->maxSettled)
+        search->status = SEARCH_STATUS_BUDGET;
+
+    else if (limits->cancel != NULL && atomic_load_explicit(limits->cancel, memory_order_relaxed) != 0)
+        search->status = SEARCH_STATUS_CANCELLED;
+
+    else if (limits->timeLimit > 0 && search->settledCount % SEARCH_LIMITS_CLOCK_INTERVAL == 0
+             && timerNow() > search->deadline)
+        search->status = SEARCH_STATUS_DEADLINE;
+
+    return search->status != SEARCH_STATUS_COMPLETE;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            SEARCH BLOCKING FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Search Start Blocks:
+        - Allocates the block arrays on first use and makes sure a block epoch is active.
+*/
+static void searchStartBlocks(struct Search* search)
+{
+    if (search->edgeBlocked == NULL)
+    {
+        search->edgeBlocked = calloc(search->graph->numEdges > 0 ? search->graph->numEdges : 1, sizeof(int));
+        search->nodeBlocked = calloc(search->graph->numNodes > 0 ? search->graph->numNodes : 1, sizeof(int));
+    }
+
+    if (search->blockEpoch == 0)
+        search->blockEpoch = 1;
+
+    search->hasBlocks = 1;
+}
+
+/*
+    Search Block Edge:
+        - Hides a given graph edge (index into 'targets') from the workspace's searches
+            until searchClearBlocks() is called. The graph itself is not modified.
+*/
+void searchBlockEdge(struct Search* search, int edge)
+{
+    searchStartBlocks(search);
+    search->edgeBlocked[edge] = search->blockEpoch;
+}
+
+/*
+    Search Block Node:
+        - Hides a given node id from the workspace's searches until searchClearBlocks() is called.
+*/
+void searchBlockNode(struct Search* search, int id)
+{
+    searchStartBlocks(search);
+    search->nodeBlocked[id] = search->blockEpoch;
+}
+
+/*
+    Search Clear Blocks:
+        - Restores every blocked edge and node by moving to the next block epoch.
+*/
+void searchClearBlocks(struct Search* search)
+{
+    if (search->hasBlocks == 0)
+        return;
+
+    search->hasBlocks = 0;
+
+    if (search->blockEpoch == INT_MAX)
+    {
+        memset(search->edgeBlocked, 0, (search->graph->numEdges > 0 ? search->graph->numEdges : 1) * sizeof(int));
+        memset(search->nodeBlocked, 0, (search->graph->numNodes > 0 ? search->graph->numNodes : 1) * sizeof(int));
+        search->blockEpoch = 0;
+    }
+
+    search->blockEpoch++;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            SEARCH PATH FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Search Path:
+        - Back propagates from a given node id to the start of the current search.
+        - Writes the node ids from start to end into the given path array (if not NULL).
+        - Returns the number of nodes on the path, or '0' if the node has not been reached.
+*/
+int searchPath(struct Search* search, int endId, int* path)
+{
+    int currentCity;
+    int length = 0;
+
+    if (endId < 0 || search->stamp[endId] != search->epoch)
+        return 0;
+
+    // Count the nodes on the path.
+    for (currentCity = endId; currentCity != -1; currentCity = search->back[currentCity])
+        length++;
+
+    // Write the path backwards so it reads from start to end.
+    if (path != NULL)
+    {
+        int index = length;
+
+        for (currentCity = endId; currentCity != -1; currentCity = search->back[currentCity])
+            path[--index] = currentCity;
+    }
+
+    return length;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            SEARCH QUERY FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Text Append:
+        - Appends formatted text to a growable buffer, doubling its capacity as required.
+*/
+static void textAppend(char** text, int* length, int* capacity, const char* format, ...)
+{
+    va_list args;
+
+    if (*text == NULL || *capacity <= 0)
+    {
+        *capacity = 256;
+        *text = realloc(*text, *capacity);
+    }
+
+    while (1)
+    {
+        va_start(args, format);
+        int written = vsnprintf(*text + *length, *capacity - *length, format, args);
+        va_end(args);
+
+        // Text fitted, update length.
+        if (written < *capacity - *length)
+        {
+            *length += written;
+            return;
+        }
+
+        // Otherwise grow the buffer and try again.
+        while (*capacity - *length <= written)
+            *capacity *= 2;
+
+        *text = realloc(*text, *capacity);
+    }
+}
+
+/*
+    Search Status Text:
+        - Returns the reason a search stopped early as text, for the result of an expired query.
+*/
+static const char* searchStatusText(int status)
+{
+    if (status == SEARCH_STATUS_DEADLINE)
+        return "Deadline passed";
+
+    else if (status == SEARCH_STATUS_BUDGET)
+        return "Settled city budget used up";
+
+    else if (status == SEARCH_STATUS_CANCELLED)
+        return "Query cancelled";
+
+    return "Search complete";
+}
+
+/*
+    Search Query:
+        - Resolves two city names within the workspace's graph and runs searchQueryIds() between them.
+        - Formats the same text dijkstra() prints into the given growable buffer ('*text' may be NULL).
+        - Stores the computation time in the 'algorithmTime' pointer argument.
+        - A search stopped by the workspace's limits (see searchSetLimits()) reports why, with the best
+            distance known to the end city if it was reached at all ('search->status' holds the code).
+        - Returns indication if function was successful.
+            '1' -> Graph searched - Path found, cities are unreachable or the query expired (text holds the results).
+            '0' -> City names invalid / Graph is too small (text holds the failure message).
+*/
+int searchQuery(struct Search* search, const char* cityStartName, const char* cityEndName,
+                char** text, int* textCapacity, double* algorithmTime)
+{
+    struct Graph* graph = search->graph;
+    int length = 0;
+
+    // Find city ids.
+    int cityStartId = graphCityIndex(graph, cityStartName);
+    int cityEndId = graphCityIndex(graph, cityEndName);
+
+    // Error flagging system:
+
+    *algorithmTime = 0;
+
+    if (cityStartId < 0 && cityEndId < 0)
+    {
+        textAppend(text, &length, textCapacity,
+                   "Failure: Cities '%s' and '%s' not found in network! - (searchQuery - dijkstraSearch.c)\n",
+                   cityStartName, cityEndName);
+        return 0;
+    }
+    else if (cityStartId < 0)
+    {
+        textAppend(text, &length, textCapacity,
+                   "Failure: City '%s' not found in network! - (searchQuery - dijkstraSearch.c)\n", cityStartName);
+        return 0;
+    }
+    else if (cityEndId < 0)
+    {
+        textAppend(text, &length, textCapacity,
+                   "Failure: City '%s' not found in network! - (searchQuery - dijkstraSearch.c)\n", cityEndName);
+        return 0;
+    }
+    else if (graph->numNodes <= 1)
+    {
+        textAppend(text, &length, textCapacity,
+                   "Failure: Network must contain at least 2 cities! - (searchQuery - dijkstraSearch.c)\n");
+        return 0;
+    }
+
+    // No errors were found.
+    return searchQueryIds(search, cityStartId, cityEndId, text, textCapacity, algorithmTime);
+}
+
+/*
+    Search Query Ids:
+        - Runs Dijkstra's algorithm between two node ids already resolved within the workspace's graph
+            (see 'handle.h'), so no city name is looked up on the way in.
+        - Formats the same text as searchQuery() into the given growable buffer ('*text' may be NULL).
+        - Stores the computation time in the 'algorithmTime' pointer argument.
+        - Returns indication if function was successful.
+            '1' -> Graph searched - Path found, cities are unreachable or the query expired (text holds the results).
+            '0' -> Node ids invalid / Graph is too small (text holds the failure message).
+*/
+int searchQueryIds(struct Search* search, int cityStartId, int cityEndId, char** text, int* textCapacity, double* algorithmTime)
+{
+    struct Graph* graph = search->graph;
+    int length = 0;
+
+    // Error flagging system:
+
+    *algorithmTime = 0;
+
+    if (cityStartId < 0 || cityStartId >= graph->numNodes || cityEndId < 0 || cityEndId >= graph->numNodes)
+    {
+        textAppend(text, &length, textCapacity,
+                   "Failure: City ids %d and %d must be between 0 and %d! - (searchQueryIds - dijkstraSearch.c)\n",
+                   cityStartId, cityEndId, graph->numNodes - 1);
+        return 0;
+    }
+    else if (graph->numNodes <= 1)
+    {
+        textAppend(text, &length, textCapacity,
+                   "Failure: Network must contain at least 2 cities! - (searchQueryIds - dijkstraSearch.c)\n");
+        return 0;
+    }
+
+    // No errors were found.
+    textAppend(text, &length, textCapacity, "\n- DIJKSTRA'S ALGORITHM -\n");
+    textAppend(text, &length, textCapacity, "Shortest path between '%s' and '%s'.\n",
+               graphCityName(graph, cityStartId), graphCityName(graph, cityEndId));
+
+    // Start Algorithm:
+    timer stopwatch;
+    stopwatch.timeStart = timerNow();
+
+    int isReachable = searchShortestPath(search, cityStartId, cityEndId);
+
+    // Stop Algorithm:
+    stopwatch.timeEnd = timerNow();
+    stopwatch.timeInSeconds = stopwatch.timeEnd - stopwatch.timeStart;
+    *algorithmTime = stopwatch.timeInSeconds;
+
+    textAppend(text, &length, textCapacity, "PATH RESULTS:\n");
+
+    // PATH NOT FOUND / UNREACHABLE:
+
+        if (isReachable == 0 && search->status != SEARCH_STATUS_COMPLETE)
+        {
+            textAppend(text, &length, textCapacity, "\tQuery stopped! - %s after %d cities settled.\n",
+                       searchStatusText(search->status), search->settledCount);
+
+            if (searchDistance(search, cityEndId) != INT_MAX)
+                textAppend(text, &length, textCapacity, "\tBest known distance is %dkm (not final).\n",
+                           searchDistance(search, cityEndId));
+
+            else textAppend(text, &length, textCapacity, "\tEnd city not reached.\n");
+
+            textAppend(text, &length, textCapacity, "ALGORITHM STOPPED - (%fs)\n", stopwatch.timeInSeconds);
+            return 1;
+        }
+
+        if (isReachable == 0)
+        {
+            textAppend(text, &length, textCapacity, "\tPath not found! - Cities are unreachable.\nALGORITHM COMPLETED\n");
+            return 1;
+        }
+
+    // PATH FOUND:
+
+        textAppend(text, &length, textCapacity, "\tPath: [ ");
+
+        // Walk back from the end city to the start city, printing from the start.
+        int pathLength = searchPath(search, cityEndId, NULL);
+        int* path = malloc(pathLength * sizeof(int));
+        searchPath(search, cityEndId, path);
+
+        int index;
+        for (index = 0; index < pathLength; index++)
+        {
+            // Print edge distance between cities.
+            if (index > 0)
+                textAppend(text, &length, textCapacity, " -(%dkm)-> ",
+                           search->distance[path[index]] - search->distance[path[index - 1]]);
+
+            // Print current city name.
+            textAppend(text, &length, textCapacity, "%s", graphCityName(graph, path[index]));
+        }
+
+        free(path);
+
+        textAppend(text, &length, textCapacity, " ]\n\tThe distance of this path is %dkm.\n", search->distance[cityEndId]);
+        textAppend(text, &length, textCapacity, "ALGORITHM COMPLETE - (%fs)\n", stopwatch.timeInSeconds);
+
+    return 1;
+}
@@ -0,0 +1,132 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    graph.h:
+        - Header file for the 'compactGraph.c' source file.
+        - Defines the public functions to create and read a compact, read-only copy of a network
+            (a 'frozen' graph) that the shortest path engines query from many threads at once.
+        - Contains the 'Graph' structure needed within the search and other source files.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+#ifndef GRAPH_H_INCLUDED
+#define GRAPH_H_INCLUDED
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        GRAPH LIBRARIES/DEFINITIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// User Created Network Library:
+#include "network.h"
+
+/*
+    GRAPH_SIMD_WIDTH:
+        - The 'targets' and 'weights' arrays are aligned to this many 32-bit entries and followed by
+            this many padding entries, so a vector loop may load a whole register at any row start.
+*/
+#define GRAPH_SIMD_WIDTH LIST_SIMD_WIDTH
+
+/*
+    GRAPH_GENERATE_LOCALITY:
+        - Most paths of a generated graph join node ids at most this far apart.
+*/
+#define GRAPH_GENERATE_LOCALITY 64
+
+/*
+    GRAPH_ORDER:
+        - Node orders understood by graphOrder() and graphReorder().
+                GRAPH_ORDER_NONE    -> Keep the current ids.
+                GRAPH_ORDER_BFS     -> Breadth first order.
+                GRAPH_ORDER_RCM     -> Reverse Cuthill-McKee order.
+                GRAPH_ORDER_DEGREE  -> Highest degree first.
+*/
+#define GRAPH_ORDER_NONE 0
+#define GRAPH_ORDER_BFS 1
+#define GRAPH_ORDER_RCM 2
+#define GRAPH_ORDER_DEGREE 3
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        PUBLIC GRAPH STRUCTURES
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Graph Structure:
+        - Public structure so the search engines can read the adjacency arrays directly in their inner loops.
+        - Nodes are numbered 0 to numNodes - 1, the edges of node 'id' are the entries
+            rowStart[id] to rowStart[id + 1] - 1 of the 'targets' and 'weights' arrays.
+        - Every undirected path of the network is stored once in each direction.
+        - Entries past numEdges are padding (target '0', weight LIST_PAD_DISTANCE).
+
+        numNodes        - Number of nodes (cities) within the graph.
+        numEdges        - Number of directed edge entries within the graph.
+        rowStart        - Index of the first edge of each node (numNodes + 1 entries).
+        targets         - Node id at the far end of each edge.
+        weights         - Integer distance of each edge.
+        nameOffset      - Offset of each node name within 'namePool'.
+        namePool        - All node names stored back to back, each terminated by '\0'.
+        hashSize        - Number of slots within the name hash table (power of two).
+        hashTable       - Open addressing table mapping city names to node ids ('-1' marks an empty slot).
+*/
+struct Graph
+{
+    int numNodes;
+    int numEdges;
+
+    int* rowStart;
+    int* targets;
+    int* weights;
+
+    int* nameOffset;
+    char* namePool;
+
+    int hashSize;
+    int* hashTable;
+};
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                    PUBLIC GRAPH FUNCTION DECLARATIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Creates an empty graph with room for a given number of nodes, edges and name characters.
+struct Graph* graphConstructor(int numNodes, int numEdges, int namePoolSize);
+
+// Frees memory associated with a given graph.
+void graphDestructor(struct Graph* graph);
+
+// Writes the name of a node into a graph (nodes must be named in id order).
+void graphSetName(struct Graph* graph, int id, const char* cityName);
+
+// Builds the name hash table once every node has been named.
+void graphBuildIndex(struct Graph* graph);
+
+// Returns the node id of a given city name within a graph.
+int graphCityIndex(struct Graph* graph, const char* cityName);
+
+// Returns the name of a given node id within a graph.
+char* graphCityName(struct Graph* graph, int id);
+
+// Creates a graph holding only the node names of a given graph.
+struct Graph* graphCopyNames(struct Graph* graph);
+
+// Returns the number of edges of a given node id within a graph.
+int graphDegree(struct Graph* graph, int id);
+
+// Returns the weight of the edge between two node ids, or '-1' if they are not connected.
+int graphEdgeWeight(struct Graph* graph, int fromId, int toId);
+
+// Creates a connected synthetic graph for testing the search engines on large inputs.
+struct Graph* graphGenerate(int numNodes, int averageDegree, int maxWeight, unsigned int seed);
+
+// Chooses a new id for every node of a graph in a given order, returns the new id of each old id.
+int* graphOrder(struct Graph* graph, int order);
+
+// Creates a copy of a graph with every node renumbered to a given new id.
+struct Graph* graphPermute(struct Graph* graph, int* newId);
+
+// Creates a copy of a graph renumbered in a given order for better cache locality.
+struct Graph* graphReorder(struct Graph* graph, int order, int** newId);
+
+#endif // GRAPH_H_INCLUDED
@@ -17,12 +17,36 @@
             - networkIsEmpty
             - cityNameSearch
             - getNode
+            - componentFind
+            - componentUnion
+            - componentCompareSizes
+            - componentsRebuild
             - addCity
             - addEdge
             - removeCity
             - removeEdge
+            - batchConstructor
+            - batchDestructor
+            - batchAppend
+            - batchAddCity / batchAddPath / batchRemoveCity / batchRemovePath
+            - batchSize
+            - batchTableSlot
+            - networkLinkNode
+            - networkUnlinkNode
+            - batchApplyOperation
+            - batchUndoOperation
+            - batchApply
             - displayNetwork
             - displayConnections
+            - getNodeName
+            - getNodeConnections
+            - timerNow
+            - networkVersion
+            - networkBuildGraph
+            - networkFreeze
+            - networkSearch
+            - networkComponentCount
+            - displayComponents
             - dijkstra
 
 * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
@@ -30,6 +54,16 @@
 // Include respective header file:
 #include "network.h"
 
+// Batch operation types.
+#define BATCH_ADD_CITY 0
+#define BATCH_ADD_PATH 1
+#define BATCH_REMOVE_CITY 2
+#define BATCH_REMOVE_PATH 3
+
+// Name table entry of a city removed by a batch.
+static char batchRemovedSlot;
+#define BATCH_REMOVED ((struct Node*) &batchRemovedSlot)
+
 
 /** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
                                             NETWORK STRUCTURES
@@ -43,10 +77,11 @@
 		prev                - Pointer to the previous node in the network.
 
         (For Dijkstra's algorithm)
-        shortestDistance    - Relative integer distance travelled from a starting node.
-        routeEdgeDistance   - Edge integer distance for node via the shortest path.
-        isVisited           - Indication if node has been visited.
-		back                - Pointer to the previous node via the shortest path to back propagate.
+        index               - Node id within the network's frozen graph, set by networkFreeze().
+
+        (For the connected component index)
+        component           - Parent node within the component's union-find tree (itself for the root).
+        componentSize       - Number of cities within the component (only kept by the root).
 */
 struct Node
 {
@@ -58,17 +93,33 @@ struct Node
     struct Node* prev;
 
     // For Dijkstra's algorithm.
-    int shortestDistance;
-    int routeEdgeDistance;
-    int isVisited;
-    struct Node* back;
+    int index;
+
+    // For the connected component index.
+    struct Node* component;
+    int componentSize;
 };
 
 /*
     Network Structure:
-        size    - Number of nodes within network.
-        head    - Pointer to the first node in the network.
-		prev    - Pointer to the last node in the network.
+        size            - Number of nodes within network.
+        head            - Pointer to the first node in the network.
+		prev            - Pointer to the last node in the network.
+
+        (For Dijkstra's algorithm)
+        version         - Incremented every time a city or path is added or removed.
+        frozen          - Compact read-only copy of the network used by the search engines.
+        frozenVersion   - Network version the frozen graph was built from.
+        search          - Search workspace on the frozen graph used by dijkstra().
+        resultText      - Growable buffer dijkstra() formats its results into.
+        resultCapacity  - Capacity of the result text buffer.
+
+        (For the connected component index)
+        numComponents   - Number of connected components (groups of cities joined by paths).
+        componentsStale - Indication if a removal may have split a component, the union-find trees
+                            are rebuilt before they are next read.
+        componentLabel  - Component of each node id of the frozen graph (the root's id), read by the
+                            network's search to answer unreachable pairs without searching.
 */
 struct Network
 {
@@ -76,6 +127,100 @@ struct Network
 
     struct Node* head;
     struct Node* tail;
+
+    // For Dijkstra's algorithm.
+    int version;
+    struct Graph* frozen;
+    int frozenVersion;
+    struct Search* search;
+    char* resultText;
+    int resultCapacity;
+
+    // For the connected component index.
+    int numComponents;
+    int componentsStale;
+    int* componentLabel;
+};
+
+/*
+    Batch Operation Structure:
+        type            - Change to make (BATCH_ADD_CITY, BATCH_ADD_PATH, BATCH_REMOVE_CITY or BATCH_REMOVE_PATH).
+        city1Name       - City to add or remove, or the first city of a path.
+        city2Name       - Second city of a path.
+        distance        - Distance of a path to add.
+*/
+struct BatchOperation
+{
+    int type;
+    char city1Name[127];
+    char city2Name[127];
+    int distance;
+};
+
+/*
+    Batch Structure:
+        count           - Number of operations collected.
+        capacity        - Capacity of the operations array.
+        operations      - Operations in the order they are applied.
+*/
+struct Batch
+{
+    int count;
+    int capacity;
+    struct BatchOperation* operations;
+};
+
+/*
+    Batch Undo Structure:
+        - Records how to reverse one applied operation, should a later operation of its batch fail.
+
+        type            - Type of the applied operation.
+        city1           - City added or removed, or the first city of a path.
+        city2           - Second city of a path, or the city before a removed city (NULL if it was the head).
+        distance        - Distance of a path added or removed.
+        firstPath       - Index of a removed city's first path within the batch's removed paths.
+        numPaths        - Number of paths removed with the city.
+*/
+struct BatchUndo
+{
+    int type;
+    struct Node* city1;
+    struct Node* city2;
+    int distance;
+    int firstPath;
+    int numPaths;
+};
+
+/*
+    Batch Path Structure:
+        city            - City at the other end of a path removed with a city.
+        distance        - Distance of the removed path.
+*/
+struct BatchPath
+{
+    struct Node* city;
+    int distance;
+};
+
+/*
+    Batch State Structure:
+        - Working state of batchApply(), built once per batch.
+
+        table           - Open addressing table mapping city names to nodes (replaces cityNameSearch() and getNode()).
+        mask            - Number of table slots minus one (power of two).
+        paths           - Paths removed with cities, kept to reconnect the cities if the batch is undone.
+        numPaths        - Number of removed paths.
+        pathCapacity    - Capacity of the removed paths array.
+*/
+struct BatchState
+{
+    struct Node** table;
+    int mask;
+
+    struct BatchPath* paths;
+
+    int numPaths;
+    int pathCapacity;
 };
 
 
@@ -88,7 +233,7 @@ struct Network
         - Allocate memory and create a new node with a provided city name.
         - Returns pointer to new node.
 */
-struct Node* nodeConstructor(char cityName[127])
+struct Node* nodeConstructor(const char* cityName)
 {
     struct Node* newCity;
 
@@ -100,10 +245,11 @@ struct Node* nodeConstructor(char cityName[127])
     strcpy(newCity->name, cityName);
 
     // Initialise Dijkstra parameters.
-    newCity->isVisited = 0;
-    newCity->shortestDistance = INT_MAX;
-    newCity->routeEdgeDistance = 0;
-    newCity->back = NULL;
+    newCity->index = -1;
+
+    // City is a component of its own until a path is added.
+    newCity->component = newCity;
+    newCity->componentSize = 1;
 
     // Initialise neighbouring nodes.
     newCity->next = NULL;
@@ -141,6 +287,19 @@ struct Network* networkConstructor(void)
     newNetwork->head = NULL;
     newNetwork->tail = NULL;
 
+    // No frozen graph until the first search.
+    newNetwork->version = 0;
+    newNetwork->frozen = NULL;
+    newNetwork->frozenVersion = -1;
+    newNetwork->search = NULL;
+    newNetwork->resultText = NULL;
+    newNetwork->resultCapacity = 0;
+
+    // No cities, no components.
+    newNetwork->numComponents = 0;
+    newNetwork->componentsStale = 0;
+    newNetwork->componentLabel = NULL;
+
     // Return new network.
     return newNetwork;
 }
@@ -166,6 +325,19 @@ void networkDestructor(struct Network* cityNetwork)
         nodeDestructor(currentNode);
     }
 
+    // Free the frozen graph and its search workspace.
+    searchDestructor(cityNetwork->search);
+    graphDestructor(cityNetwork->frozen);
+    free(cityNetwork->resultText);
+    free(cityNetwork->componentLabel);
+    cityNetwork->search = NULL;
+    cityNetwork->frozen = NULL;
+    cityNetwork->resultText = NULL;
+    cityNetwork->componentLabel = NULL;
+    cityNetwork->resultCapacity = 0;
+    cityNetwork->head = NULL;
+    cityNetwork->tail = NULL;
+
     //Set network size to '0' and address to 'NULL'.
     cityNetwork->size = 0;
     cityNetwork = NULL;
@@ -230,7 +402,7 @@ int networkIsEmpty(struct Network* cityNetwork)
             'index' -> City name found, index within network returned.
             '-1'    -> Node not present in network.
 */
-int cityNameSearch(struct Network* cityNetwork, char citySearch[127])
+int cityNameSearch(struct Network* cityNetwork, const char* citySearch)
 {
     // Start at the first node in the network.
     struct Node* currentCity = cityNetwork->head;
@@ -292,6 +464,87 @@ struct Node* getNode(struct Network* cityNetwork, int cityIndex)
 }
 
 
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        NETWORK COMPONENT FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Component Find:
+        - Returns the root node of a given node's component.
+        - Halves the path walked on the way, so the trees stay close to flat.
+*/
+static struct Node* componentFind(struct Node* city)
+{
+    while (city->component != city)
+    {
+        city->component = city->component->component;
+        city = city->component;
+    }
+
+    return city;
+}
+
+/*
+    Component Union:
+        - Joins the components of two given nodes, the smaller tree is hung beneath the larger root.
+*/
+static void componentUnion(struct Network* cityNetwork, struct Node* city1, struct Node* city2)
+{
+    struct Node* root1 = componentFind(city1);
+    struct Node* root2 = componentFind(city2);
+
+    if (root1 == root2)
+        return;
+
+    if (root1->componentSize < root2->componentSize)
+    {
+        struct Node* swap = root1;
+        root1 = root2;
+        root2 = swap;
+    }
+
+    root2->component = root1;
+    root1->componentSize += root2->componentSize;
+    cityNetwork->numComponents--;
+}
+
+/*
+    Component Compare Sizes:
+        - qsort() comparison of two component sizes, largest first.
+*/
+static int componentCompareSizes(const void* size1, const void* size2)
+{
+    return *(const int*) size2 - *(const int*) size1;
+}
+
+/*
+    Components Rebuild:
+        - Rebuilds the union-find trees from every path if a removal has left them stale.
+*/
+static void componentsRebuild(struct Network* cityNetwork)
+{
+    struct Node* currentCity;
+    int connection;
+
+    if (cityNetwork->componentsStale == 0)
+        return;
+
+    for (currentCity = cityNetwork->head; currentCity != NULL; currentCity = currentCity->next)
+    {
+        currentCity->component = currentCity;
+        currentCity->componentSize = 1;
+    }
+
+    cityNetwork->numComponents = cityNetwork->size;
+
+    for (currentCity = cityNetwork->head; currentCity != NULL; currentCity = currentCity->next)
+        for (connection = 0; connection < nodeDegree(currentCity); connection++)
+            componentUnion(cityNetwork, currentCity, listCities(currentCity->connections)[connection]);
+
+    cityNetwork->componentsStale = 0;
+}
+
+
 /** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
                                         NETWORK ADD/REMOVE FUNCTIONS
 * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
@@ -304,7 +557,7 @@ struct Node* getNode(struct Network* cityNetwork, int cityIndex)
             '1' -> City added to network
             '0' -> City already present in network and rejected.
 */
-int addCity(struct Network* cityNetwork, char cityName[127])
+int addCity(struct Network* cityNetwork, const char* cityName)
 {
     // Check if city has already been added, returns '0' if present.
     if (cityNameSearch(cityNetwork, cityName) >= 0)
@@ -344,8 +597,10 @@ int addCity(struct Network* cityNetwork, char cityName[127])
         cityNetwork->head = newCity;
     }
 
-    // Increase the network size by 1.
+    // Increase the network size by 1, the city is a new component.
     cityNetwork->size++;
+    cityNetwork->numComponents++;
+    cityNetwork->version++;
 
     // Print and indicate success (return '1').
     printf("Success: %s added to network.\n", cityName);
@@ -361,7 +616,7 @@ int addCity(struct Network* cityNetwork, char cityName[127])
             '1' -> Both cities are present in network and edge was successfully added.
             '0' -> City/Cities not present in network or distance is invalid, or other additional error flags.
 */
-int addPath(struct Network* cityNetwork, char city1Name[127], char city2Name[127], int distance)
+int addPath(struct Network* cityNetwork, const char* city1Name, const char* city2Name, int distance)
 {
     // Find city indexes.
     int city1Index = cityNameSearch(cityNetwork, city1Name);
@@ -414,8 +669,14 @@ int addPath(struct Network* cityNetwork, char city1Name[127], char city2Name[127
     struct Node* city2Node = getNode(cityNetwork, city2Index);
 
     // Add both cities to each others connection lists with the distance defined.
-    listAdd(city1Node->connections, city2Node, distance);
-    listAdd(city2Node->connections, city1Node, distance);
+    if (listAddPath(city1Node, city2Node, distance) == 0)
+        return 0;
+
+    // Join the cities' components (stale trees are rebuilt from every path anyway).
+    if (cityNetwork->componentsStale == 0)
+        componentUnion(cityNetwork, city1Node, city2Node);
+
+    cityNetwork->version++;
 
     // Print and indicate success.
     printf("Success: (%s -> %s) of distance %dkm added to network.\n", city1Name, city2Name, distance);
@@ -430,7 +691,7 @@ int addPath(struct Network* cityNetwork, char city1Name[127], char city2Name[127
             '1' -> Entity found and removed from list.
             '0' -> Entity not present in list.
 */
-int removeCity(struct Network* cityNetwork, char cityName[127])
+int removeCity(struct Network* cityNetwork, const char* cityName)
 {
     // Find the requested node.
     int cityIndex = cityNameSearch(cityNetwork, cityName);
@@ -445,18 +706,17 @@ int removeCity(struct Network* cityNetwork, char cityName[127])
     // Node is present within network:
 
     struct Node* currentCity = getNode(cityNetwork, cityIndex);
-    int* pathDistance = &cityIndex;
 
-    // Remove all edges attached to node to remove.
-    for (cityIndex = 0; cityIndex < nodeDegree(currentCity); cityIndex++)
-    {
-        // Get connectedCity on respective currentCity's connection list ...
-        struct Node* connectedCity = getListEntity(currentCity->connections, cityIndex, pathDistance);
+    // A city without paths is a component of its own, removing a connected city may split its component.
+    if (nodeDegree(currentCity) == 0 && cityNetwork->componentsStale == 0)
+        cityNetwork->numComponents--;
 
-        // ... and remove currentCity from connectedCity's connection list.
-        int listIndex = listSearch(connectedCity->connections, currentCity->name);
-        listRemove(connectedCity->connections, listIndex);
-    }
+    else cityNetwork->componentsStale = 1;
+
+    // Remove all edges attached to node to remove, last first (each removal also unties the
+    // connected city's twin entry in constant time).
+    while (nodeDegree(currentCity) > 0)
+        listRemovePath(currentCity->connections, nodeDegree(currentCity) - 1);
 
     // If we have a previous item make it point to this node's next item ...
     if (currentCity->prev != NULL)
@@ -479,6 +739,7 @@ int removeCity(struct Network* cityNetwork, char cityName[127])
 
     // Update the element count.
     cityNetwork->size--;
+    cityNetwork->version++;
 
     // Print and indicate success (return '1').
     printf("Success: %s removed from network.\n", cityName);
@@ -493,7 +754,7 @@ int removeCity(struct Network* cityNetwork, char cityName[127])
             '1' -> Edge found and removed from network.
             '0' -> Cities / Edge not present in network, or other additional error flags.
 */
-int removePath(struct Network* cityNetwork, char city1Name[127], char city2Name[127])
+int removePath(struct Network* cityNetwork, const char* city1Name, const char* city2Name)
 {
     // Find city indexes.
     int city1Index = cityNameSearch(cityNetwork, city1Name);
@@ -539,12 +800,20 @@ int removePath(struct Network* cityNetwork, char city1Name[127], char city2Name[
     struct Node* city1Node = getNode(cityNetwork, city1Index);
     struct Node* city2Node = getNode(cityNetwork, city2Index);
 
-    // Search for city name in each others respective connections list.
-    int list1Index = listSearch(city1Node->connections, city2Node->name);
-    int list2Index = listSearch(city2Node->connections, city1Node->name);
+    // Search the shorter connections list for the other city, its twin entry is found with it.
+    struct Node* searchNode = city1Node;
+    struct Node* targetNode = city2Node;
+
+    if (nodeDegree(city2Node) < nodeDegree(city1Node))
+    {
+        searchNode = city2Node;
+        targetNode = city1Node;
+    }
+
+    int listIndex = listFind(searchNode->connections, targetNode);
 
     // Flag error and return '0' is either city isn't connected to the other.
-    if (list1Index == -1 || list2Index == -1)
+    if (listIndex == -1)
     {
         printf("Failure: Either city is not connected to the other respective city! - (removePath - graphNetwork.c)\n");
         return 0;
@@ -552,9 +821,10 @@ int removePath(struct Network* cityNetwork, char city1Name[127], char city2Name[
 
     // Both cities are present in both the network and in each other's connections list, continue code.
 
-    // Remove both cities to each others connection lists with the distance defined.
-    listRemove(city1Node->connections, city2Index);
-    listRemove(city2Node->connections, city1Index);
+    // Remove both cities from each others connection lists.
+    listRemovePath(searchNode->connections, listIndex);
+    cityNetwork->componentsStale = 1;
+    cityNetwork->version++;
 
     // Print and indicate success.
     printf("Success: Edge (%s -> %s) removed from network.\n", city1Name, city2Name);
@@ -562,6 +832,401 @@ int removePath(struct Network* cityNetwork, char city1Name[127], char city2Name[
 }
 
 
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            NETWORK BATCH FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Batch Constructor:
+        - Allocate memory for a new, empty batch of network changes.
+        - Returns pointer to new batch.
+*/
+struct Batch* batchConstructor(void)
+{
+    struct Batch* batch = malloc(sizeof(struct Batch));
+
+    batch->count = 0;
+    batch->capacity = 16;
+    batch->operations = malloc(batch->capacity * sizeof(struct BatchOperation));
+
+    // Return new batch.
+    return batch;
+}
+
+/*
+    Batch Destructor:
+        - Free memory associated with a batch (the network it was applied to is unaffected).
+*/
+void batchDestructor(struct Batch* batch)
+{
+    if (batch == NULL)
+        return;
+
+    free(batch->operations);
+    free(batch);
+}
+
+/*
+    Batch Append:
+        - Adds an operation to the end of a batch, doubling the batch's capacity when full.
+        - Returns '1' (operations are only checked once the batch is applied).
+*/
+static int batchAppend(struct Batch* batch, int type, const char* city1Name, const char* city2Name, int distance)
+{
+    if (batch->count == batch->capacity)
+    {
+        batch->capacity *= 2;
+        batch->operations = realloc(batch->operations, batch->capacity * sizeof(struct BatchOperation));
+    }
+
+    struct BatchOperation* operation = &batch->operations[batch->count++];
+
+    operation->type = type;
+    operation->distance = distance;
+    strcpy(operation->city1Name, city1Name);
+    strcpy(operation->city2Name, city2Name != NULL ? city2Name : "");
+
+    return 1;
+}
+
+/*
+    Batch Add City / Add Path / Remove City / Remove Path:
+        - Add the respective change to a batch, in the same form as addCity(), addPath(), removeCity() and removePath().
+*/
+int batchAddCity(struct Batch* batch, const char* cityName)
+{
+    return batchAppend(batch, BATCH_ADD_CITY, cityName, NULL, 0);
+}
+
+int batchAddPath(struct Batch* batch, const char* city1Name, const char* city2Name, int distance)
+{
+    return batchAppend(batch, BATCH_ADD_PATH, city1Name, city2Name, distance);
+}
+
+int batchRemoveCity(struct Batch* batch, const char* cityName)
+{
+    return batchAppend(batch, BATCH_REMOVE_CITY, cityName, NULL, 0);
+}
+
+int batchRemovePath(struct Batch* batch, const char* city1Name, const char* city2Name)
+{
+    return batchAppend(batch, BATCH_REMOVE_PATH, city1Name, city2Name, 0);
+}
+
+/*
+    Batch Size:
+        - Returns the number of operations within a batch.
+*/
+int batchSize(struct Batch* batch)
+{
+    return batch->count;
+}
+
+/*
+    Batch Table Slot:
+        - Returns the table slot holding a given city name, or the empty slot where it would be added.
+        - Slots of cities removed by the batch hold BATCH_REMOVED and are skipped over.
+*/
+static int batchTableSlot(struct BatchState* state, const char* cityName)
+{
+    // FNV-1a hash of the city name.
+    unsigned int hash = 2166136261u;
+    const char* character;
+
+    for (character = cityName; *character != '\0'; character++)
+    {
+        hash ^= (unsigned char) *character;
+        hash *= 16777619u;
+    }
+
+    int slot = hash & state->mask;
+
+    while (state->table[slot] != NULL)
+    {
+        if (state->table[slot] != BATCH_REMOVED && strcmp(state->table[slot]->name, cityName) == 0)
+            return slot;
+
+        slot = (slot + 1) & state->mask;
+    }
+
+    return slot;
+}
+
+/*
+    Network Link Node:
+        - Ties a detached node back into a network straight after a given node ('NULL' for the head).
+*/
+static void networkLinkNode(struct Network* cityNetwork, struct Node* city, struct Node* prevCity)
+{
+    city->prev = prevCity;
+    city->next = (prevCity != NULL) ? prevCity->next : cityNetwork->head;
+
+    if (city->next != NULL)
+        city->next->prev = city;
+
+    else cityNetwork->tail = city;
+
+    if (prevCity != NULL)
+        prevCity->next = city;
+
+    else cityNetwork->head = city;
+
+    cityNetwork->size++;
+}
+
+/*
+    Network Unlink Node:
+        - Unties a node from a network without freeing it.
+*/
+static void networkUnlinkNode(struct Network* cityNetwork, struct Node* city)
+{
+    if (city->prev != NULL)
+        city->prev->next = city->next;
+
+    else cityNetwork->head = city->next;
+
+    if (city->next != NULL)
+        city->next->prev = city->prev;
+
+    else cityNetwork->tail = city->prev;
+
+    city->next = NULL;
+    city->prev = NULL;
+    cityNetwork->size--;
+}
+
+/*
+    Batch Apply Operation:
+        - Applies one operation of a batch, recording how to undo it.
+        - Nothing is printed on success, failures are printed as the single network functions would.
+        - Removed cities are only untied from the network, they are freed once the whole batch succeeds.
+        - Returns indication if function was successful.
+            '1' -> Operation applied.
+            '0' -> Operation invalid, nothing changed.
+*/
+static int batchApplyOperation(struct Network* cityNetwork, struct BatchState* state, struct BatchOperation* operation,
+                               struct BatchUndo* undo)
+{
+    int slot1 = batchTableSlot(state, operation->city1Name);
+    struct Node* city1 = state->table[slot1];
+
+    undo->type = operation->type;
+    undo->city1 = city1;
+    undo->city2 = NULL;
+    undo->distance = 0;
+    undo->firstPath = state->numPaths;
+    undo->numPaths = 0;
+
+    if (operation->type == BATCH_ADD_CITY)
+    {
+        if (city1 != NULL)
+        {
+            printf("Failure: %s already present within network. - (batchApply - graphNetwork.c)\n", operation->city1Name);
+            return 0;
+        }
+
+        city1 = nodeConstructor(operation->city1Name);
+        networkLinkNode(cityNetwork, city1, cityNetwork->tail);
+
+        state->table[slot1] = city1;
+        undo->city1 = city1;
+        return 1;
+    }
+
+    if (operation->type == BATCH_REMOVE_CITY)
+    {
+        if (city1 == NULL)
+        {
+            printf("Failure: %s not present within network. - (batchApply - graphNetwork.c)\n", operation->city1Name);
+            return 0;
+        }
+
+        // Remove every path of the city, last first, keeping each one to reconnect it on undo.
+        while (nodeDegree(city1) > 0)
+        {
+            if (state->numPaths == state->pathCapacity)
+            {
+                state->pathCapacity *= 2;
+                state->paths = realloc(state->paths, state->pathCapacity * sizeof(struct BatchPath));
+            }
+
+            int last = nodeDegree(city1) - 1;
+            state->paths[state->numPaths].city = listCities(city1->connections)[last];
+            state->paths[state->numPaths].distance = listDistances(city1->connections)[last];
+            state->numPaths++;
+
+            listRemovePath(city1->connections, last);
+        }
+
+        undo->numPaths = state->numPaths - undo->firstPath;
+        undo->city2 = city1->prev;
+
+        networkUnlinkNode(cityNetwork, city1);
+        state->table[slot1] = BATCH_REMOVED;
+        return 1;
+    }
+
+    // Paths: both cities must be present (either may have been added earlier in the batch).
+    struct Node* city2 = state->table[batchTableSlot(state, operation->city2Name)];
+
+    if (city1 == NULL || city2 == NULL)
+    {
+        printf("Failure: City '%s' not found in network! - (batchApply - graphNetwork.c)\n",
+               city1 == NULL ? operation->city1Name : operation->city2Name);
+        return 0;
+    }
+
+    undo->city2 = city2;
+
+    if (operation->type == BATCH_ADD_PATH)
+    {
+        if (operation->distance <= 0)
+        {
+            printf("Failure: Distance must be greater than 0km! - (batchApply - graphNetwork.c)\n");
+            return 0;
+        }
+
+        if (listAddPath(city1, city2, operation->distance) == 0)
+            return 0;
+
+        undo->distance = operation->distance;
+        return 1;
+    }
+
+    // Remove path: search the shorter connections list for the other city.
+    struct Node* searchNode = (nodeDegree(city2) < nodeDegree(city1)) ? city2 : city1;
+    struct Node* targetNode = (searchNode == city1) ? city2 : city1;
+
+    int listIndex = listFind(searchNode->connections, targetNode);
+
+    if (listIndex == -1)
+    {
+        printf("Failure: '%s' is not connected to '%s'! - (batchApply - graphNetwork.c)\n",
+               operation->city1Name, operation->city2Name);
+        return 0;
+    }
+
+    undo->distance = listDistances(searchNode->connections)[listIndex];
+    listRemovePath(searchNode->connections, listIndex);
+
+    return 1;
+}
+
+/*
+    Batch Undo Operation:
+        - Reverses an operation applied by batchApplyOperation().
+        - Operations are undone last first, so the network is exactly as it was straight after the
+            operation, and a removed city goes back after the same node it followed.
+*/
+static void batchUndoOperation(struct Network* cityNetwork, struct BatchState* state, struct BatchUndo* undo)
+{
+    int index;
+
+    switch (undo->type) {
+        case BATCH_ADD_CITY :
+            state->table[batchTableSlot(state, undo->city1->name)] = BATCH_REMOVED;
+            networkUnlinkNode(cityNetwork, undo->city1);
+            nodeDestructor(undo->city1);
+            break;
+        case BATCH_REMOVE_CITY :
+            networkLinkNode(cityNetwork, undo->city1, undo->city2);
+            state->table[batchTableSlot(state, undo->city1->name)] = undo->city1;
+
+            for (index = undo->firstPath + undo->numPaths - 1; index >= undo->firstPath; index--)
+                listAddPath(undo->city1, state->paths[index].city, state->paths[index].distance);
+            break;
+        case BATCH_ADD_PATH :
+            // Remove the added entry (matching both the city and the distance, in case of parallel paths).
+            for (index = nodeDegree(undo->city1) - 1; index >= 0; index--)
+            {
+                if (listCities(undo->city1->connections)[index] == undo->city2
+                    && listDistances(undo->city1->connections)[index] == undo->distance)
+                {
+                    listRemovePath(undo->city1->connections, index);
+                    break;
+                }
+            }
+            break;
+        case BATCH_REMOVE_PATH :
+            listAddPath(undo->city1, undo->city2, undo->distance);
+            break;
+    }
+}
+
+/*
+    Batch Apply:
+        - Applies every operation of a batch to a network in one pass, all or nothing.
+        - City names are looked up once through a hash table built for the batch, instead of a
+            linear cityNameSearch() and getNode() walk per operation.
+        - Operations are applied in order, so later operations may use cities added earlier in the batch.
+            If any operation fails, the operations already applied are undone and the network is left unchanged.
+        - The network version is raised once per batch, so the frozen graph (and any published
+            snapshot, see 'snapshot.h') is rebuilt once per batch instead of once per change.
+        - Returns indication if function was successful.
+            '1' -> Every operation applied.
+            '0' -> An operation was invalid, no operation applied.
+*/
+int batchApply(struct Network* cityNetwork, struct Batch* batch)
+{
+    // Nothing to apply.
+    if (batch->count == 0)
+        return 1;
+
+    struct BatchState state;
+    int tableSize = 16;
+
+    while (tableSize < 2 * (cityNetwork->size + batch->count))
+        tableSize *= 2;
+
+    state.table = calloc(tableSize, sizeof(struct Node*));
+    state.mask = tableSize - 1;
+    state.numPaths = 0;
+    state.pathCapacity = 16;
+    state.paths = malloc(state.pathCapacity * sizeof(struct BatchPath));
+
+    // Index every city name once.
+    struct Node* currentCity;
+    for (currentCity = cityNetwork->head; currentCity != NULL; currentCity = currentCity->next)
+        state.table[batchTableSlot(&state, currentCity->name)] = currentCity;
+
+    struct BatchUndo* undo = malloc(batch->count * sizeof(struct BatchUndo));
+    int applied = 0;
+
+    while (applied < batch->count && batchApplyOperation(cityNetwork, &state, &batch->operations[applied], &undo[applied]) == 1)
+        applied++;
+
+    int success = (applied == batch->count);
+
+    if (success == 1)
+    {
+        // Free the cities removed by the batch.
+        for (applied = 0; applied < batch->count; applied++)
+            if (undo[applied].type == BATCH_REMOVE_CITY)
+                nodeDestructor(undo[applied].city1);
+
+        // Cities and paths were added and removed without the union-find trees.
+        cityNetwork->componentsStale = 1;
+        cityNetwork->version++;
+        printf("Success: Batch of %d changes applied to network.\n", batch->count);
+    }
+    else
+    {
+        printf("Failure: Batch change %d of %d rejected, network left unchanged. - (batchApply - graphNetwork.c)\n",
+               applied + 1, batch->count);
+
+        // Undo the applied operations, last first (the network is as before, so are its components).
+        while (applied-- > 0)
+            batchUndoOperation(cityNetwork, &state, &undo[applied]);
+    }
+
+    free(undo);
+    free(state.paths);
+    free(state.table);
+
+    return success;
+}
+
+
 /** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
                                             NETWORK DISPLAY FUNCTIONS
 * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
@@ -606,7 +1271,7 @@ void displayNetwork(struct Network* cityNetwork)
         - Prints all connected nodes in a given node's connection list as an array.
         - Additionally indicates if the network or connection list is empty.
 */
-void displayConnections(struct Network* cityNetwork, char cityName[127])
+void displayConnections(struct Network* cityNetwork, const char* cityName)
 {
     // Print if network is empty and immediately return.
     if (cityNetwork->size == 0) {
@@ -641,219 +1306,240 @@ char* getNodeName(struct Node* node)
     return node->name;
 }
 
+/*
+    Get Node Connections:
+        - Returns pointer to the connection list of the given node.
+        - Used within 'arrayList.c' to reach the twin entry of a path.
+*/
+struct List* getNodeConnections(struct Node* node)
+{
+    return node->connections;
+}
+
 /** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
-                                        NETWORK DIJKSTRA'S ALGORITHM
+                                            NETWORK FREEZE FUNCTIONS
 * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
 
 /*
-    Dijkstra:
-        - Performs Dijkstra's algorithm from two given city names.
-        - Prints relevant information and the results of the algorithm, such as the path and the minimal distance,
-            to the terminal and to a 'dijkstraresults.txt' text file.
-        - Flags an error if either or both cities aren't present within the network already.
-        - Additionally calculates algorithm duration time (speed), result is printed at the end.
-        - Returns indication if function was successful.
-            '1' -> Network scanned - Path found or cities are unreachable.
-            '0' -> City names invalid / Network is too small, or other additional error flags.
-        - (Code referenced from Vaidehi Joshi - Reference [8])
+    Timer Now:
+        - Returns a monotonic wall clock time in seconds.
+        - Unlike clock(), the result is not the CPU time of the whole process, so it stays meaningful
+            when several threads are running at once.
 */
-int dijkstra(FILE* dijkstraresults_file, double *algorithmTime, struct Network* cityNetwork, char cityStartName[127], char cityEndName[127])
+double timerNow(void)
 {
-    // Find city indexes.
-    int cityStartIndex = cityNameSearch(cityNetwork, cityStartName);
-    int cityEndIndex = cityNameSearch(cityNetwork, cityEndName);
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
 
-    // Error flagging system:
+    return (double) now.tv_sec + (double) now.tv_nsec / 1e9;
+}
 
-    // Error checking system if cities are in the specified network.
-    int dijkstraErrorCode = 0;
+/*
+    Network Version:
+        - Returns the number of changes (cities or paths added or removed) made to a network so far.
+*/
+int networkVersion(struct Network* cityNetwork)
+{
+    return cityNetwork->version;
+}
 
-    if (cityStartIndex < 0 && cityEndIndex < 0)
-        dijkstraErrorCode = 1;
+/*
+    Network Build Graph:
+        - Builds a new compact read-only copy (graph) of a given network for the search engines.
+        - Node ids in the graph are renumbered in FREEZE_ORDER (from 'network.h') for cache locality,
+            each node's id is kept in its 'index' field and names still resolve through the graph.
+        - Nothing is cached, the returned graph belongs to the caller (see networkFreeze()).
+*/
+struct Graph* networkBuildGraph(struct Network* cityNetwork)
+{
+    // Number every node and count the edges and name characters needed.
+    int numEdges = 0;
+    int namePoolSize = 0;
+    int index = 0;
 
-    else if (cityStartIndex < 0)
-        dijkstraErrorCode = 2;
+    struct Node* currentCity;
+    for (currentCity = cityNetwork->head; currentCity != NULL; currentCity = currentCity->next)
+    {
+        currentCity->index = index++;
+        numEdges += nodeDegree(currentCity);
+        namePoolSize += strlen(currentCity->name) + 1;
+    }
 
-    else if (cityEndIndex < 0)
-        dijkstraErrorCode = 3;
+    struct Graph* graph = graphConstructor(cityNetwork->size, numEdges, namePoolSize);
 
-    else if (cityNetwork->size <= 1)
-        dijkstraErrorCode = 4;
+    // Copy each node's name and connection list into its row of the graph.
+    int edge = 0;
 
-    // Print respective error case and indicate failure ('0').
-    switch(dijkstraErrorCode) {
-        case 1 :
-            printf("Failure: Cities '%s' and '%s' not found in network! - (dijkstra - graphNetwork.c)\n",
-                    cityStartName, cityEndName);
-            return 0;
-        case 2 :
-            printf("Failure: City '%s' not found in network! - (dijkstra - graphNetwork.c)\n", cityStartName);
-            return 0;
-        case 3 :
-            printf("Failure: City '%s' not found in network! - (dijkstra - graphNetwork.c)\n", cityEndName);
-            return 0;
-        case 4 :
-            printf("Failure: Network must contain at least 2 cities! - (dijkstra - graphNetwork.c)\n");
-            return 0;
-        default :
-            // No errors were found.
-            printf("\n- DIJKSTRA'S ALGORITHM -\n");
-            fprintf(dijkstraresults_file, "\n- DIJKSTRA'S ALGORITHM -\n");
-            break;
-    }
+    for (currentCity = cityNetwork->head; currentCity != NULL; currentCity = currentCity->next)
+    {
+        graphSetName(graph, currentCity->index, currentCity->name);
+        graph->rowStart[currentCity->index] = edge;
 
-    // Set up network:
+        // Distances are already contiguous within the list, node pointers are mapped to ids.
+        int degree = nodeDegree(currentCity);
+        struct Node** connectedCities = listCities(currentCity->connections);
 
-        printf("Shortest path between '%s' and '%s'.\n", cityStartName, cityEndName);
-        fprintf(dijkstraresults_file, "Shortest path between '%s' and '%s'.\n", cityStartName, cityEndName);
+        memcpy(&graph->weights[edge], listDistances(currentCity->connections), degree * sizeof(int));
 
-        // Initialise respective start and end city nodes.
-        struct Node* startCity = getNode(cityNetwork, cityStartIndex);
-        struct Node* endCity = getNode(cityNetwork, cityEndIndex);
+        int connectionIndex;
+        for (connectionIndex = 0; connectionIndex < degree; connectionIndex++)
+            graph->targets[edge + connectionIndex] = connectedCities[connectionIndex]->index;
 
-        // Create a priority stack array.
-        struct Stack* priorityStack = stackConstructor();
+        edge += degree;
+    }
 
-        // Reset all nodes in network to initial Dijkstra state.
-        struct Node* currentCity = cityNetwork->head;
+    graph->rowStart[cityNetwork->size] = edge;
+    graphBuildIndex(graph);
 
-        // Edge distance between current and connected cities.
-        int edgeDistance;
+    // Renumber the nodes so connected cities sit close together, names and node indexes follow.
+    if (FREEZE_ORDER != GRAPH_ORDER_NONE)
+    {
+        int* newId;
+        struct Graph* reordered = graphReorder(graph, FREEZE_ORDER, &newId);
 
-        // Initialise Network.
-        while (1)
-        {
-            currentCity->isVisited = 0;
-            currentCity->shortestDistance = INT_MAX;
-            currentCity->routeEdgeDistance = 0;
-            currentCity->back = NULL;
-            if (currentCity->next == NULL)
-                break;
-            else
-                currentCity = currentCity->next;
-        }
+        for (currentCity = cityNetwork->head; currentCity != NULL; currentCity = currentCity->next)
+            currentCity->index = newId[currentCity->index];
 
-        // Initialise starting position.
-        startCity->shortestDistance = 0;
-        startCity->routeEdgeDistance = 0;
-        currentCity = startCity;
+        graphDestructor(graph);
+        free(newId);
+        graph = reordered;
+    }
 
-    // Start Algorithm:
-    timer stopwatch;
-    stopwatch.timeStart = (double) clock();    // Start clock.
+    return graph;
+}
 
-    do { // While endCity has not been visited.
+/*
+    Network Freeze:
+        - Returns a compact read-only copy (graph) of a given network for the search engines.
+        - The graph is cached and only rebuilt once the network has changed since it was last frozen.
+        - The returned graph belongs to the network and must not be freed by the caller.
+*/
+struct Graph* networkFreeze(struct Network* cityNetwork)
+{
+    // Return the cached graph if the network has not changed.
+    if (cityNetwork->frozen != NULL && cityNetwork->frozenVersion == cityNetwork->version)
+        return cityNetwork->frozen;
 
-        int connectionIndex; // Index within the currentCity's connection list.
+    // Free the out of date graph and its workspace.
+    searchDestructor(cityNetwork->search);
+    graphDestructor(cityNetwork->frozen);
+    cityNetwork->search = NULL;
 
-        for (connectionIndex = 0; connectionIndex < nodeDegree(currentCity); connectionIndex++)
-        {
-            // Read each connected city on respective currentCity's connection list.
-            struct Node* connectedCity = getListEntity(currentCity->connections, connectionIndex, &edgeDistance);
+    // Build and cache the new graph.
+    struct Graph* graph = networkBuildGraph(cityNetwork);
 
-            // If node has not yet been visited, ...
-            if (connectedCity->isVisited == 0)
-            {
-                // ... check if the connectedCity's shortest distance is shorter via the currentCity than it's
-                //      shortest distance, ...
-                if (connectedCity->shortestDistance > currentCity->shortestDistance + edgeDistance)
-                {
-                    // ... and update its shortest distance and its route if true.
-                    connectedCity->shortestDistance = currentCity->shortestDistance + edgeDistance;
-                    connectedCity->routeEdgeDistance = edgeDistance;
-                    connectedCity->back = currentCity;
+    cityNetwork->frozen = graph;
+    cityNetwork->frozenVersion = cityNetwork->version;
 
-                }
+    // Label each node id with its component's root id.
+    struct Node* currentCity;
 
-                // Check if connected city is already in the priority stack, ...
-                if (stackSearch(priorityStack, connectedCity->name) == -1)
-                {
-                    // ... if it isn't, enqueue current city node to priority stack with relative distance travelled.
-                    stackPush(priorityStack, connectedCity, connectedCity->shortestDistance, edgeDistance);
-                }
-            }
-        }
+    componentsRebuild(cityNetwork);
+    cityNetwork->componentLabel = realloc(cityNetwork->componentLabel, (graph->numNodes > 0 ? graph->numNodes : 1) * sizeof(int));
 
-        // Current city has now been visited and is now fully explored.
-        currentCity->isVisited = 1;
+    for (currentCity = cityNetwork->head; currentCity != NULL; currentCity = currentCity->next)
+        cityNetwork->componentLabel[currentCity->index] = componentFind(currentCity)->index;
 
-        // Sort the priority stack.
-        stackHeapSort(priorityStack);
+    return graph;
+}
 
-        // Set next current city to the city with shortest total distance within the stack.
-        currentCity = stackPop(priorityStack, &edgeDistance);
 
-        // If there are no more nodes to explore and endCity has still not been found, cities are disconnected.
-        if (currentCity == NULL)
-            break;
+/*
+    Network Search:
+        - Returns the network's own search workspace on its up to date frozen graph.
+        - Used by the single-threaded query functions (dijkstra, kShortestPaths) so that they do
+            not allocate a workspace per call.
+        - The workspace belongs to the network and must not be freed by the caller.
+*/
+struct Search* networkSearch(struct Network* cityNetwork)
+{
+    struct Graph* graph = networkFreeze(cityNetwork);
 
-    } while (endCity->isVisited != 1);
+    if (cityNetwork->search == NULL)
+    {
+        cityNetwork->search = searchConstructor(graph);
+        cityNetwork->search->component = cityNetwork->componentLabel;
+    }
 
-    // Stop Algorithm:
-    stopwatch.timeEnd = (double) clock();      // Stop clock.
+    return cityNetwork->search;
+}
 
-    printf("PATH RESULTS:\n");
-    fprintf(dijkstraresults_file, "PATH RESULTS:\n");
+/*
+    Network Component Count:
+        - Returns the number of connected components (groups of cities joined by paths) of a network.
+        - Kept up to date by addCity() and addPath(), a removal rebuilds the union-find trees first.
+*/
+int networkComponentCount(struct Network* cityNetwork)
+{
+    componentsRebuild(cityNetwork);
 
-    // PATH NOT FOUND / UNREACHABLE:
+    return cityNetwork->numComponents;
+}
 
-        if (endCity->isVisited == 0)
-        {
-            printf("\tPath not found! - Cities are unreachable.\nALGORITHM COMPLETED\n");
-            fprintf(dijkstraresults_file, "\tPath not found! - Cities are unreachable.\nALGORITHM COMPLETED\n");
-            return 1;
-        }
+/*
+    Display Components:
+        - Displays the number of connected components of a network and the number of cities within
+            each, largest first (only the first 'maxShown' are listed).
+*/
+void displayComponents(struct Network* cityNetwork, int maxShown)
+{
+    struct Node* currentCity;
+    int numSizes = 0;
+    int index;
 
-    // PATH FOUND:
+    componentsRebuild(cityNetwork);
 
-        // Start at end city.
-        currentCity = endCity;
+    int* sizes = malloc((cityNetwork->numComponents > 0 ? cityNetwork->numComponents : 1) * sizeof(int));
 
-        printf("\tPath: [ ");
-        fprintf(dijkstraresults_file, "\tPath: [ ");
+    // Each root holds its component's size.
+    for (currentCity = cityNetwork->head; currentCity != NULL; currentCity = currentCity->next)
+        if (currentCity->component == currentCity)
+            sizes[numSizes++] = currentCity->componentSize;
 
-        // Reverse order of Dijkstra path by back propagating from the end city and pushing to a stack.
-        struct Stack* dijkstraPath = stackConstructor();
+    qsort(sizes, numSizes, sizeof(int), componentCompareSizes);
 
-        while (currentCity != NULL)
-        {
-            stackPush(dijkstraPath, currentCity, currentCity->shortestDistance, edgeDistance);
-            currentCity = currentCity->back;
-        }
+    printf("Network Components: %d - [ ", cityNetwork->numComponents);
 
-        // Print Results.
-        while (stackIsEmpty(dijkstraPath) == 0)
-        {
-            // Pop next city from dijkstraPath stack.
-            currentCity = stackPop(dijkstraPath, &edgeDistance);
+    for (index = 0; index < numSizes && index < maxShown; index++)
+        printf("%s%d", index > 0 ? ", " : "", sizes[index]);
 
-            // Print edge distance between cities.
-            if (currentCity != startCity)
-            {
-                printf(" -(%dkm)-> ", currentCity->routeEdgeDistance);
-                fprintf(dijkstraresults_file, " -(%dkm)-> ", currentCity->routeEdgeDistance);
-            }
+    printf("%s ] cities\n", numSizes > maxShown ? ", ..." : "");
 
-            // Print current city name.
-            printf("%s", currentCity->name);
-            fprintf(dijkstraresults_file, "%s", currentCity->name);
-        }
+    free(sizes);
+}
 
-        printf(" ]\n\tThe distance of this path is %dkm.\n", endCity->shortestDistance);
-        fprintf(dijkstraresults_file, " ]\n\tThe distance of this path is %dkm.\n", endCity->shortestDistance);
 
-    // Free stack memories associated with function.
-    stackDestructor(priorityStack);
-    stackDestructor(dijkstraPath);
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        NETWORK DIJKSTRA'S ALGORITHM
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
 
-    // Calcuate function time duration.
-    stopwatch.timeInSeconds = (stopwatch.timeEnd - stopwatch.timeStart) / CLOCKS_PER_SEC;
+/*
+    Dijkstra:
+        - Performs Dijkstra's algorithm from two given city names.
+        - Prints relevant information and the results of the algorithm, such as the path and the minimal distance,
+            to the terminal and to a 'dijkstraresults.txt' text file.
+        - Flags an error if either or both cities aren't present within the network already.
+        - Additionally calculates algorithm duration time (speed), result is printed at the end.
+        - Searches the network's frozen graph through searchQuery() from 'search.h', the same engine
+            the batch pipeline runs on its worker threads.
+        - Returns indication if function was successful.
+            '1' -> Network scanned - Path found or cities are unreachable.
+            '0' -> City names invalid / Network is too small, or other additional error flags.
+*/
+int dijkstra(FILE* dijkstraresults_file, double *algorithmTime, struct Network* cityNetwork, const char* cityStartName, const char* cityEndName)
+{
+    // Bring the frozen graph and its search workspace up to date.
+    struct Search* search = networkSearch(cityNetwork);
 
-    // Store computation time in 'algorithmTime' pointer argument.
-    *algorithmTime = stopwatch.timeInSeconds;
+    // Run the search and format its results.
+    int isSuccessful = searchQuery(search, cityStartName, cityEndName,
+                                   &cityNetwork->resultText, &cityNetwork->resultCapacity, algorithmTime);
 
-    printf("ALGORITHM COMPLETE - (%fs)\n", stopwatch.timeInSeconds);
-    fprintf(dijkstraresults_file, "ALGORITHM COMPLETE - (%fs)\n", stopwatch.timeInSeconds);
+    // Failures are only printed to the terminal.
+    printf("%s", cityNetwork->resultText);
 
-    return 1;
+    if (isSuccessful == 1)
+        fprintf(dijkstraresults_file, "%s", cityNetwork->resultText);
+
+    return isSuccessful;
 }
@@ -0,0 +1,68 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    handle.h:
+        - Header file for the 'cityHandles.c' source file.
+        - Defines the public functions to resolve city names once into handles, and to run queries
+            from handles so repeated queries never look a city name up again.
+        - Contains the 'CityHandle' structure.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+#ifndef HANDLE_H_INCLUDED
+#define HANDLE_H_INCLUDED
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        HANDLE LIBRARIES/DEFINITIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// User Created Network Library:
+#include "network.h"
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        PUBLIC HANDLE STRUCTURES
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    CityHandle Structure:
+        - A city name resolved to its node id within the network's frozen graph. Node ids are renumbered
+            whenever the network changes, so a handle stays valid for the network version it was
+            resolved on and is refused (not silently misread) after that.
+        - Small enough to pass by value.
+
+        id              - Node id within the frozen graph ('-1' if the city was not found).
+        version         - Network version the handle was resolved on (see networkVersion()).
+*/
+struct CityHandle
+{
+    int id;
+    int version;
+};
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                    PUBLIC HANDLE FUNCTION DECLARATIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Resolves a city name present within a network into a handle.
+struct CityHandle cityHandle(struct Network* cityNetwork, const char* cityName);
+
+// Resolves many city names into handles at once, returns the number found.
+int cityHandles(struct Network* cityNetwork, char cityNames[][127], int numCities, struct CityHandle* handles);
+
+// Indicates if a handle was found and belongs to the network's current version.
+int handleIsValid(struct Network* cityNetwork, struct CityHandle handle);
+
+// Applies Dijkstra's algorithm between two city handles, printing the same results as dijkstra().
+int dijkstraHandles(FILE* dijkstraresults_file, double* algorithmTime, struct Network* cityNetwork,
+                    struct CityHandle cityStart, struct CityHandle cityEnd);
+
+// Returns the shortest distance between two city handles without formatting any text.
+int handleDistance(struct Network* cityNetwork, struct CityHandle cityStart, struct CityHandle cityEnd);
+
+// Rewrites a Dijkstra pairs file of city names as a pairs file of node ids, returns the number of pairs.
+int handlesWritePairs(FILE* namePairs_file, FILE* idPairs_file, struct Network* cityNetwork);
+
+#endif // HANDLE_H_INCLUDED
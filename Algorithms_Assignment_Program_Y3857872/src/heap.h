@@ -0,0 +1,65 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    heap.h:
+        - Header file for the 'indexedHeap.c' source file.
+        - Defines the public functions to create and control an indexed minimum binary heap
+            keyed on integer node ids from within the search and other source files.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+#ifndef HEAP_H_INCLUDED
+#define HEAP_H_INCLUDED
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        HEAP LIBRARIES/DEFINITIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// User Created Network Library:
+#include "network.h"
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        PUBLIC HEAP STRUCTURES
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Heap Structure:
+        - Public structure defined in 'indexedHeap.c' source file.
+*/
+struct Heap;
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                    PUBLIC HEAP FUNCTION DECLARATIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Creates a heap able to hold every node id below a given capacity.
+struct Heap* heapConstructor(int capacity);
+
+// Frees memory associated with a given heap.
+void heapDestructor(struct Heap* heap);
+
+// Removes all items from a heap.
+void heapClear(struct Heap* heap);
+
+// Returns the number of items within a heap.
+int heapSize(struct Heap* heap);
+
+// Indicates if a given heap is empty.
+int heapIsEmpty(struct Heap* heap);
+
+// Indicates if a given node id is currently queued within a heap.
+int heapContains(struct Heap* heap, int id);
+
+// Inserts a node id with a given key, or lowers its key if already queued.
+int heapPush(struct Heap* heap, int id, int key);
+
+// Returns the lowest key within a heap without removing it.
+int heapTopKey(struct Heap* heap);
+
+// Removes and returns the node id with the lowest key.
+int heapPop(struct Heap* heap, int* key);
+
+#endif // HEAP_H_INCLUDED
@@ -0,0 +1,140 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    hierarchy.h:
+        - Header file for the 'contractionHierarchy.c' source file.
+        - Defines the public functions to preprocess a frozen graph into a contraction hierarchy and
+            answer shortest path queries on it, for graphs too large for Dijkstra's algorithm per query.
+        - Contains the 'Hierarchy' structure.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+#ifndef HIERARCHY_H_INCLUDED
+#define HIERARCHY_H_INCLUDED
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        HIERARCHY LIBRARIES/DEFINITIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// User Created Search Library:
+#include "search.h"
+
+/*
+    HIERARCHY_THREADS:
+        - Default number of threads (including the calling thread) used to preprocess a hierarchy.
+*/
+#define HIERARCHY_THREADS 4
+
+/*
+    HIERARCHY_WITNESS_SETTLED:
+        - Maximum number of nodes a witness search settles before giving up (a shortcut is then added).
+        - Larger limits add fewer unneeded shortcuts but make preprocessing slower.
+*/
+#define HIERARCHY_WITNESS_SETTLED 500
+
+/*
+    HIERARCHY_ESTIMATE_SETTLED:
+        - Maximum number of nodes a witness search settles while only estimating a node's priority.
+        - Estimates are repeated for every neighbour of every contracted node, so a lower limit keeps
+            preprocessing fast at the cost of a slightly worse contraction order.
+*/
+#define HIERARCHY_ESTIMATE_SETTLED 50
+
+/*
+    HIERARCHY_CORE_GROWTH:
+        - A node is only contracted while it adds at most this many more shortcuts than the edges it
+            removes. Contraction stops once no remaining node is within the limit, leaving them as an
+            uncontracted core searched by bidirectional Dijkstra's algorithm.
+        - Road-like graphs contract almost completely, graphs with many long random paths would
+            otherwise spend most of their preprocessing time adding shortcuts within a near-complete core.
+*/
+#define HIERARCHY_CORE_GROWTH 2
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        PUBLIC HIERARCHY STRUCTURES
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Hierarchy Structure:
+        - Every node has a rank (the order it was contracted in). Each node's row holds only its
+            upward edges, to higher ranked nodes, both original edges and shortcuts.
+        - A shortcut replaces the two edges through its middle node, which is ranked below both ends.
+        - Core nodes (left uncontracted) are ranked last and keep their edges to each other in both directions.
+        - Paths are undirected, so the same upward rows serve the forward and backward searches.
+
+        numNodes        - Number of nodes within the hierarchy.
+        numEdges        - Number of upward edges.
+        numShortcuts    - Number of upward edges that are shortcuts.
+        numCore         - Number of core nodes.
+        rank            - Contraction order of each node ('0' contracted first).
+        rowStart        - Index of the first upward edge of each node (numNodes + 1 entries).
+        targets         - Node id at the far end of each upward edge.
+        weights         - Distance of each upward edge.
+        middles         - Middle node id of each shortcut ('-1' for an original edge).
+        names           - Graph holding only the node names and name index (no edges).
+        buildTime       - Preprocessing time in seconds.
+*/
+struct Hierarchy
+{
+    int numNodes;
+    int numEdges;
+    int numShortcuts;
+    int numCore;
+
+    int* rank;
+    int* rowStart;
+    int* targets;
+    int* weights;
+    int* middles;
+
+    struct Graph* names;
+    double buildTime;
+};
+
+/*
+    HierarchySearch Structure:
+        - Public structure defined in 'contractionHierarchy.c' source file.
+*/
+struct HierarchySearch;
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                    PUBLIC HIERARCHY FUNCTION DECLARATIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Preprocesses a graph into a contraction hierarchy across a given number of threads.
+struct Hierarchy* hierarchyConstructor(struct Graph* graph, int numThreads);
+
+// Frees memory associated with a given hierarchy.
+void hierarchyDestructor(struct Hierarchy* hierarchy);
+
+// Writes a hierarchy to a binary file.
+int hierarchySave(struct Hierarchy* hierarchy, const char* fileName);
+
+// Reads a hierarchy written by hierarchySave().
+struct Hierarchy* hierarchyLoad(const char* fileName);
+
+// Creates a query workspace for a given hierarchy (one per thread).
+struct HierarchySearch* hierarchySearchConstructor(struct Hierarchy* hierarchy);
+
+// Frees memory associated with a given hierarchy query workspace.
+void hierarchySearchDestructor(struct HierarchySearch* hierarchySearch);
+
+// Finds the shortest distance between two node ids, returns INT_MAX if unreachable.
+int hierarchyShortestPath(struct HierarchySearch* hierarchySearch, int startId, int endId);
+
+// Writes the original node ids of the last path found, returns the number of nodes.
+int hierarchyPath(struct HierarchySearch* hierarchySearch, int* path);
+
+// Returns the number of nodes settled by the last query.
+int hierarchySettledCount(struct HierarchySearch* hierarchySearch);
+
+// Prints the last path found in the same form as dijkstra().
+void hierarchyDisplayPath(struct HierarchySearch* hierarchySearch);
+
+// Prints the size and preprocessing time of a hierarchy.
+void hierarchyReport(struct Hierarchy* hierarchy);
+
+#endif // HIERARCHY_H_INCLUDED
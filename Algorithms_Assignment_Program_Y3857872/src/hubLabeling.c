@@ -0,0 +1,806 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    hubLabeling.c:
+        - Source file defining the functions to build, store and query hub labels.
+        - Labels are built by pruned landmark labeling: nodes are taken as hubs in order of importance
+            and a Dijkstra search from each hub adds the hub to the label of every node it settles. A settled node whose distance the labels built so far already give
+            is pruned (neither labelled nor expanded), so later hubs only reach the nodes earlier hubs
+            do not cover and labels stay small.
+        - Importance is the number of shortest paths through a node over LABELS_ORDER_SAMPLES shortest
+            path trees (the size of the node's subtree in each), ties broken by degree. Nodes on many
+            shortest paths (main junctions) cover most pairs, so they are taken first.
+        - The first LABELS_SERIAL_HUBS hubs are searched one at a time. After that, rounds of hubs are
+            searched across the threads, each pruning only with the labels of earlier rounds, and their
+            entries are appended in hub order once the round ends. Labels stay sorted by hub and exact,
+            at the cost of a few entries a strictly serial build would have pruned.
+        - A query merges the two sorted labels like the merge step of merge sort, so it touches a few
+            hundred bytes instead of searching the graph.
+        - The label file is laid out as it sits in memory (offsets, entries, then names), so loading maps
+            the file and points into it rather than reading and copying it.
+
+        - Functions:
+            - labelsCompareOrder
+            - labelsOrder
+            - labelsRowAdd
+            - labelsPrunedSearch
+            - labelsWorkerThread
+            - labelsRunRound
+            - labelsConstructor
+            - labelsDestructor
+            - labelsSave
+            - labelsLoad
+            - labelsDistance
+            - labelsReport
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Include respective header file:
+#include "labels.h"
+
+// Thread and atomic libraries:
+#include <pthread.h>
+#include <stdatomic.h>
+
+// Memory mapping libraries:
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// Identifies a hub label file.
+#define LABELS_FILE_TAG 0x4c425548
+
+// Number of shortest path trees sampled to rank the hubs.
+#define LABELS_ORDER_SAMPLES 16
+
+// Number of 8 byte words in the header of a hub label file.
+#define LABELS_HEADER_SIZE 4
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            LABELS STRUCTURES
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    LabelOrder Structure:
+        - Node sorted by a key: descending distance while counting subtrees, descending importance
+            while ranking the hubs.
+
+        key         - Sort key.
+        tie         - Second sort key (degree when ranking the hubs).
+        id          - Node id.
+*/
+struct LabelOrder
+{
+    long long key;
+    int tie;
+    int id;
+};
+
+/*
+    LabelRow Structure:
+        - Growable label of one node during construction.
+
+        count       - Number of entries.
+        capacity    - Capacity of the entry array.
+        entries     - Entries sorted by hub rank.
+*/
+struct LabelRow
+{
+    int count;
+    int capacity;
+    struct LabelEntry* entries;
+};
+
+/*
+    LabelResult Structure:
+        - Entries found by the search from one hub of the current round.
+
+        worker      - Thread whose buffer holds the entries.
+        start       - Position of the first entry within that buffer.
+        count       - Number of entries.
+*/
+struct LabelResult
+{
+    int worker;
+    int start;
+    int count;
+};
+
+/*
+    LabelWorker Structure:
+        - Per-thread pruned search workspace.
+
+        build       - Shared construction state.
+        index       - Thread number ('0' is the calling thread).
+        thread      - POSIX thread handle (unused for thread '0').
+        epoch       - Current search number, distances are only valid when stamped with it.
+        stamp       - Search number each node was last reached in.
+        distance    - Tentative distance of each node.
+        hubDistance - Distance of the current hub to each hub rank of its label ('INT_MAX' elsewhere).
+        heap        - Indexed priority queue of reached nodes.
+        found       - Entries found by this thread's searches in the current round ('hub' holds the
+                        labelled node id until the entries are appended).
+        numFound    - Number of entries.
+        capacity    - Capacity of the entry array.
+*/
+struct LabelWorker
+{
+    struct LabelBuild* build;
+    int index;
+    pthread_t thread;
+
+    int epoch;
+    int* stamp;
+    int* distance;
+    int* hubDistance;
+    struct Heap* heap;
+
+    struct LabelEntry* found;
+    int numFound;
+    int capacity;
+};
+
+/*
+    LabelBuild Structure:
+        - Shared construction state.
+
+        graph           - Graph labelled.
+        order           - Node id of each hub rank.
+        rows            - Current label of every node.
+        results         - Entries found from each hub of the current round.
+        firstHub        - Rank of the first hub of the current round.
+        numHubs         - Number of hubs in the current round.
+        nextHub         - Next unclaimed hub within the round.
+*/
+struct LabelBuild
+{
+    struct Graph* graph;
+    int* order;
+    struct LabelRow* rows;
+
+    struct LabelResult* results;
+    int firstHub;
+    int numHubs;
+    atomic_int nextHub;
+};
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        LABELS CONSTRUCTION FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Labels Compare Order:
+        - Compare function for qsort(), sorting by descending key, then descending tie, then ascending id.
+*/
+static int labelsCompareOrder(const void* item1, const void* item2)
+{
+    const struct LabelOrder* order1 = item1;
+    const struct LabelOrder* order2 = item2;
+
+    if (order1->key != order2->key)
+        return (order1->key > order2->key ? -1 : 1);
+
+    if (order1->tie != order2->tie)
+        return (order1->tie > order2->tie ? -1 : 1);
+
+    return (order1->id > order2->id) - (order1->id < order2->id);
+}
+
+/*
+    Labels Order:
+        - Ranks the nodes of a graph as hubs, most shortest paths through them first (see top of file).
+        - Returns the node id of each hub rank.
+*/
+static int* labelsOrder(struct Graph* graph)
+{
+    int numNodes = graph->numNodes;
+    long long* importance = calloc(numNodes > 0 ? numNodes : 1, sizeof(long long));
+    long long* size = malloc((numNodes > 0 ? numNodes : 1) * sizeof(long long));
+    struct LabelOrder* order = malloc((numNodes > 0 ? numNodes : 1) * sizeof(struct LabelOrder));
+    struct Search* search = searchConstructor(graph);
+    int sample, index, node;
+
+    for (sample = 0; sample < LABELS_ORDER_SAMPLES && sample < numNodes; sample++)
+    {
+        int root = (int) ((long long) sample * numNodes / LABELS_ORDER_SAMPLES);
+        int numReached = 0;
+
+        searchShortestPath(search, root, -1);
+
+        for (node = 0; node < numNodes; node++)
+        {
+            if (searchIsSettled(search, node) == 1)
+            {
+                order[numReached].key = search->distance[node];
+                order[numReached].tie = 0;
+                order[numReached].id = node;
+                size[node] = 1;
+                numReached++;
+            }
+        }
+
+        // Furthest first, so every subtree is complete before it is added to its parent.
+        qsort(order, numReached, sizeof(struct LabelOrder), labelsCompareOrder);
+
+        for (index = 0; index < numReached; index++)
+        {
+            node = order[index].id;
+            importance[node] += size[node];
+
+            if (search->back[node] >= 0)
+                size[search->back[node]] += size[node];
+        }
+    }
+
+    for (node = 0; node < numNodes; node++)
+    {
+        order[node].key = importance[node];
+        order[node].tie = graphDegree(graph, node);
+        order[node].id = node;
+    }
+
+    qsort(order, numNodes, sizeof(struct LabelOrder), labelsCompareOrder);
+
+    int* hubs = malloc((numNodes > 0 ? numNodes : 1) * sizeof(int));
+
+    for (index = 0; index < numNodes; index++)
+        hubs[index] = order[index].id;
+
+    searchDestructor(search);
+    free(importance);
+    free(size);
+    free(order);
+
+    return hubs;
+}
+
+/*
+    Labels Row Add:
+        - Appends an entry to a growable label (or to a thread's buffer of found entries).
+*/
+static void labelsRowAdd(struct LabelEntry** entries, int* count, int* capacity, int hub, int distance)
+{
+    if (*count == *capacity)
+    {
+        *capacity = (*capacity > 0 ? *capacity * 2 : 4);
+        *entries = realloc(*entries, *capacity * sizeof(struct LabelEntry));
+    }
+
+    (*entries)[*count].hub = hub;
+    (*entries)[*count].distance = distance;
+    (*count)++;
+}
+
+/*
+    Labels Pruned Search:
+        - Runs Dijkstra's algorithm from the hub of a given rank, recording each settled node not
+            already covered by the labels of earlier rounds into the worker's buffer.
+        - Only reads the labels, so the hubs of one round may be searched at the same time.
+*/
+static void labelsPrunedSearch(struct LabelBuild* build, struct LabelWorker* worker, int hubRank)
+{
+    struct Graph* graph = build->graph;
+    struct LabelRow* hubRow = &build->rows[build->order[hubRank]];
+    int* hubDistance = worker->hubDistance;
+    int hub = build->order[hubRank];
+    int index, key;
+
+    // Spread the hub's own label over an array indexed by hub rank, so each check is one lookup per entry.
+    for (index = 0; index < hubRow->count; index++)
+        hubDistance[hubRow->entries[index].hub] = hubRow->entries[index].distance;
+
+    hubDistance[hubRank] = 0;
+
+    worker->epoch++;
+    worker->stamp[hub] = worker->epoch;
+    worker->distance[hub] = 0;
+    heapClear(worker->heap);
+    heapPush(worker->heap, hub, 0);
+
+    while (heapIsEmpty(worker->heap) == 0)
+    {
+        int node = heapPop(worker->heap, &key);
+        int nodeDistance = worker->distance[node];
+        struct LabelRow* row = &build->rows[node];
+        int covered = 0;
+
+        // Prune the node if a hub shared with the search's hub already gives its distance.
+        for (index = 0; index < row->count; index++)
+        {
+            int bound = hubDistance[row->entries[index].hub];
+
+            if (bound != INT_MAX && bound + row->entries[index].distance <= nodeDistance)
+            {
+                covered = 1;
+                break;
+            }
+        }
+
+        if (covered == 1)
+            continue;
+
+        labelsRowAdd(&worker->found, &worker->numFound, &worker->capacity, node, nodeDistance);
+
+        int edge;
+        for (edge = graph->rowStart[node]; edge < graph->rowStart[node + 1]; edge++)
+        {
+            int neighbour = graph->targets[edge];
+            int neighbourDistance = nodeDistance + graph->weights[edge];
+
+            if (worker->stamp[neighbour] != worker->epoch || neighbourDistance < worker->distance[neighbour])
+            {
+                worker->stamp[neighbour] = worker->epoch;
+                worker->distance[neighbour] = neighbourDistance;
+                heapPush(worker->heap, neighbour, neighbourDistance);
+            }
+        }
+    }
+
+    // Leave the rank array clear for the next hub.
+    for (index = 0; index < hubRow->count; index++)
+        hubDistance[hubRow->entries[index].hub] = INT_MAX;
+
+    hubDistance[hubRank] = INT_MAX;
+}
+
+/*
+    Labels Worker Thread:
+        - Claims and searches hubs of the current round until none are left.
+*/
+static void* labelsWorkerThread(void* argument)
+{
+    struct LabelWorker* worker = argument;
+    struct LabelBuild* build = worker->build;
+    int task;
+
+    while ((task = atomic_fetch_add(&build->nextHub, 1)) < build->numHubs)
+    {
+        struct LabelResult* result = &build->results[task];
+
+        result->worker = worker->index;
+        result->start = worker->numFound;
+        labelsPrunedSearch(build, worker, build->firstHub + task);
+        result->count = worker->numFound - result->start;
+    }
+
+    return NULL;
+}
+
+/*
+    Labels Run Round:
+        - Searches a round of hubs across the threads, then appends their entries to the labels in
+            hub order (keeping every label sorted by hub rank).
+*/
+static void labelsRunRound(struct LabelBuild* build, struct LabelWorker* workers, int numThreads)
+{
+    int index, task;
+
+    if (numThreads > build->numHubs)
+        numThreads = build->numHubs;
+
+    atomic_store(&build->nextHub, 0);
+
+    for (index = 0; index < numThreads; index++)
+        workers[index].numFound = 0;
+
+    for (index = 1; index < numThreads; index++)
+        pthread_create(&workers[index].thread, NULL, labelsWorkerThread, &workers[index]);
+
+    labelsWorkerThread(&workers[0]);
+
+    for (index = 1; index < numThreads; index++)
+        pthread_join(workers[index].thread, NULL);
+
+    for (task = 0; task < build->numHubs; task++)
+    {
+        struct LabelResult* result = &build->results[task];
+        struct LabelEntry* found = &workers[result->worker].found[result->start];
+
+        for (index = 0; index < result->count; index++)
+        {
+            struct LabelRow* row = &build->rows[found[index].hub];
+            labelsRowAdd(&row->entries, &row->count, &row->capacity, build->firstHub + task, found[index].distance);
+        }
+    }
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        LABELS CONSTRUCTORS/DESTRUCTORS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Labels Constructor:
+        - Builds the hub labels of a graph across a given number of threads (including the calling thread).
+        - The labels keep their own names, so the graph may be freed afterwards.
+        - Returns pointer to new hub labels.
+*/
+struct HubLabels* labelsConstructor(struct Graph* graph, int numThreads)
+{
+    double timeStart = timerNow();
+    int numNodes = graph->numNodes;
+    int roundSize, index, node;
+
+    if (numThreads < 1)
+        numThreads = 1;
+
+    roundSize = numThreads * LABELS_ROUND_HUBS;
+
+    struct LabelBuild build;
+    build.graph = graph;
+    build.order = labelsOrder(graph);
+    build.rows = calloc(numNodes > 0 ? numNodes : 1, sizeof(struct LabelRow));
+    build.results = malloc(roundSize * sizeof(struct LabelResult));
+
+    struct LabelWorker* workers = malloc(numThreads * sizeof(struct LabelWorker));
+
+    for (index = 0; index < numThreads; index++)
+    {
+        struct LabelWorker* worker = &workers[index];
+
+        worker->build = &build;
+        worker->index = index;
+        worker->epoch = 0;
+        worker->stamp = calloc(numNodes > 0 ? numNodes : 1, sizeof(int));
+        worker->distance = malloc((numNodes > 0 ? numNodes : 1) * sizeof(int));
+        worker->hubDistance = malloc((numNodes > 0 ? numNodes : 1) * sizeof(int));
+        worker->heap = heapConstructor(numNodes);
+        worker->found = NULL;
+        worker->numFound = 0;
+        worker->capacity = 0;
+
+        for (node = 0; node < numNodes; node++)
+            worker->hubDistance[node] = INT_MAX;
+    }
+
+    // Search the most important hubs one at a time, then the rest in rounds across the threads.
+    build.firstHub = 0;
+
+    while (build.firstHub < numNodes)
+    {
+        build.numHubs = (build.firstHub < LABELS_SERIAL_HUBS ? 1 : roundSize);
+
+        if (build.numHubs > numNodes - build.firstHub)
+            build.numHubs = numNodes - build.firstHub;
+
+        labelsRunRound(&build, workers, numThreads);
+        build.firstHub += build.numHubs;
+    }
+
+    for (index = 0; index < numThreads; index++)
+    {
+        free(workers[index].stamp);
+        free(workers[index].distance);
+        free(workers[index].hubDistance);
+        heapDestructor(workers[index].heap);
+        free(workers[index].found);
+    }
+
+    free(workers);
+    free(build.results);
+    free(build.order);
+
+    // Pack the labels into one array, each closed by a sentinel.
+    struct HubLabels* labels = malloc(sizeof(struct HubLabels));
+
+    labels->numNodes = numNodes;
+    labels->numEntries = 0;
+
+    for (node = 0; node < numNodes; node++)
+        labels->numEntries += build.rows[node].count;
+
+    labels->offsets = malloc((numNodes + 1) * sizeof(long long));
+    labels->entries = malloc((labels->numEntries + numNodes > 0 ? labels->numEntries + numNodes : 1)
+                             * sizeof(struct LabelEntry));
+
+    long long offset = 0;
+
+    for (node = 0; node < numNodes; node++)
+    {
+        struct LabelRow* row = &build.rows[node];
+
+        labels->offsets[node] = offset;
+        memcpy(&labels->entries[offset], row->entries, row->count * sizeof(struct LabelEntry));
+        offset += row->count;
+
+        labels->entries[offset].hub = LABELS_SENTINEL;
+        labels->entries[offset].distance = INT_MAX;
+        offset++;
+
+        free(row->entries);
+    }
+
+    labels->offsets[numNodes] = offset;
+    free(build.rows);
+
+    labels->names = graphCopyNames(graph);
+    labels->mapping = NULL;
+    labels->mappingSize = 0;
+    labels->buildTime = timerNow() - timeStart;
+
+    // Return new hub labels.
+    return labels;
+}
+
+/*
+    Labels Destructor:
+        - Free memory associated with hub labels, or unmap their file if they were loaded.
+*/
+void labelsDestructor(struct HubLabels* labels)
+{
+    if (labels == NULL)
+        return;
+
+    if (labels->mapping != NULL)
+        munmap(labels->mapping, labels->mappingSize);
+
+    else
+    {
+        free(labels->offsets);
+        free(labels->entries);
+    }
+
+    graphDestructor(labels->names);
+    free(labels);
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            LABELS FILE FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Labels Save:
+        - Writes hub labels to a binary file (native byte order) of 8 byte aligned sections: a header
+            (tag, numNodes, numEntries, name pool size), the offsets, the entries with their sentinels,
+            and the name pool.
+        - Returns indication if function was successful.
+            '1' -> File written.
+            '0' -> File could not be written.
+*/
+int labelsSave(struct HubLabels* labels, const char* fileName)
+{
+    FILE* file = fopen(fileName, "wb");
+
+    if (file == NULL)
+    {
+        printf("Failure: Unable to open '%s'! - (labelsSave - hubLabeling.c)\n", fileName);
+        return 0;
+    }
+
+    int numNodes = labels->numNodes;
+    size_t numEntries = (size_t) labels->offsets[numNodes];
+    long long header[LABELS_HEADER_SIZE] = { LABELS_FILE_TAG, numNodes, labels->numEntries,
+                                             labels->names->nameOffset[numNodes] };
+
+    int written = (fwrite(header, sizeof(long long), LABELS_HEADER_SIZE, file) == LABELS_HEADER_SIZE);
+    written &= (fwrite(labels->offsets, sizeof(long long), numNodes + 1, file) == (size_t) numNodes + 1);
+    written &= (fwrite(labels->entries, sizeof(struct LabelEntry), numEntries, file) == numEntries);
+    written &= (fwrite(labels->names->namePool, 1, header[3], file) == (size_t) header[3]);
+
+    if (fclose(file) != 0 || written == 0)
+    {
+        printf("Failure: Unable to write '%s'! - (labelsSave - hubLabeling.c)\n", fileName);
+        return 0;
+    }
+
+    return 1;
+}
+
+/*
+    Labels Load:
+        - Memory maps hub labels written by labelsSave(). Pages of the labels are only read from disk
+            once a query touches them, and are shared by every process mapping the same file.
+        - Returns pointer to new hub labels, or 'NULL' if the file is missing or invalid.
+*/
+struct HubLabels* labelsLoad(const char* fileName)
+{
+    int fileDescriptor = open(fileName, O_RDONLY);
+    struct stat fileStatus;
+
+    if (fileDescriptor < 0)
+    {
+        printf("Failure: Unable to open '%s'! - (labelsLoad - hubLabeling.c)\n", fileName);
+        return NULL;
+    }
+
+    if (fstat(fileDescriptor, &fileStatus) != 0 || (size_t) fileStatus.st_size < LABELS_HEADER_SIZE * sizeof(long long))
+    {
+        printf("Failure: '%s' is not a hub label file! - (labelsLoad - hubLabeling.c)\n", fileName);
+        close(fileDescriptor);
+        return NULL;
+    }
+
+    size_t mappingSize = (size_t) fileStatus.st_size;
+    void* mapping = mmap(NULL, mappingSize, PROT_READ, MAP_SHARED, fileDescriptor, 0);
+
+    close(fileDescriptor);
+
+    if (mapping == MAP_FAILED)
+    {
+        printf("Failure: Unable to map '%s'! - (labelsLoad - hubLabeling.c)\n", fileName);
+        return NULL;
+    }
+
+    // Check the sections exactly fill the file.
+    const long long* header = mapping;
+    long long numNodes = header[1], numEntries = header[2], poolSize = header[3];
+
+    if (header[0] != LABELS_FILE_TAG || numNodes < 0 || numNodes >= INT_MAX || numEntries < 0 || poolSize < 0
+        || (size_t) ((LABELS_HEADER_SIZE + numNodes + 1) * sizeof(long long)
+                     + (numEntries + numNodes) * sizeof(struct LabelEntry) + poolSize) != mappingSize)
+    {
+        printf("Failure: '%s' is not a hub label file! - (labelsLoad - hubLabeling.c)\n", fileName);
+        munmap(mapping, mappingSize);
+        return NULL;
+    }
+
+    struct HubLabels* labels = malloc(sizeof(struct HubLabels));
+
+    labels->numNodes = (int) numNodes;
+    labels->numEntries = numEntries;
+    labels->offsets = (long long*) &header[LABELS_HEADER_SIZE];
+    labels->entries = (struct LabelEntry*) &labels->offsets[numNodes + 1];
+    labels->buildTime = 0;
+    labels->mapping = mapping;
+    labels->mappingSize = mappingSize;
+
+    // Check every label lies within the entries and ends with its sentinel.
+    int valid = (labels->offsets[0] == 0 && labels->offsets[numNodes] == numEntries + numNodes);
+    int node;
+
+    for (node = 0; node < numNodes && valid == 1; node++)
+    {
+        if (labels->offsets[node + 1] <= labels->offsets[node]
+            || labels->entries[labels->offsets[node + 1] - 1].hub != LABELS_SENTINEL)
+            valid = 0;
+    }
+
+    // Rebuild the names, one per node.
+    const char* namePool = (const char*) &labels->entries[numEntries + numNodes];
+    long long offset = 0;
+
+    labels->names = graphConstructor((int) numNodes, 0, (int) poolSize);
+
+    for (node = 0; node < numNodes && valid == 1; node++)
+    {
+        long long length = strnlen(&namePool[offset], poolSize - offset);
+
+        if (offset + length >= poolSize)
+            valid = 0;
+
+        else graphSetName(labels->names, node, (char*) &namePool[offset]);
+
+        offset += length + 1;
+    }
+
+    if (valid == 0)
+    {
+        printf("Failure: '%s' is incomplete! - (labelsLoad - hubLabeling.c)\n", fileName);
+        labelsDestructor(labels);
+        return NULL;
+    }
+
+    graphBuildIndex(labels->names);
+
+    // Return new hub labels.
+    return labels;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            LABELS QUERY FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Labels Distance:
+        - Merges the labels of two node ids, keeping the shortest distance through a hub in both.
+        - The sentinels end both labels on the same hub, so the merge needs no length checks.
+        - Returns the shortest distance, 'INT_MAX' if the nodes are unreachable, or '-1' for an invalid id.
+*/
+int labelsDistance(struct HubLabels* labels, int startId, int endId)
+{
+    if (startId < 0 || startId >= labels->numNodes || endId < 0 || endId >= labels->numNodes)
+    {
+        printf("Failure: Invalid node id! - (labelsDistance - hubLabeling.c)\n");
+        return -1;
+    }
+
+    const struct LabelEntry* label1 = &labels->entries[labels->offsets[startId]];
+    const struct LabelEntry* label2 = &labels->entries[labels->offsets[endId]];
+    int best = INT_MAX;
+
+    while (1)
+    {
+        if (label1->hub == label2->hub)
+        {
+            if (label1->hub == LABELS_SENTINEL)
+                break;
+
+            if (label1->distance + label2->distance < best)
+                best = label1->distance + label2->distance;
+
+            label1++;
+            label2++;
+        }
+
+        else if (label1->hub < label2->hub)
+            label1++;
+
+        else label2++;
+    }
+
+    return best;
+}
+
+/*
+    Labels Report:
+        - Prints the size of the labels and the time per query of Dijkstra's algorithm and of the labels
+            over a file of city pairs, counting the pairs whose distances differ.
+*/
+void labelsReport(struct HubLabels* labels, struct Search* search, FILE* dijkstrapairs_file)
+{
+    char cityStartName[127], cityEndName[127];
+    double dijkstraTime = 0, labelsTime = 0;
+    int numPairs = 0, numMismatches = 0, largest = 0;
+    int node;
+
+    if (labels->numNodes != search->graph->numNodes)
+    {
+        printf("Failure: Labels were built for a different graph! - (labelsReport - hubLabeling.c)\n");
+        return;
+    }
+
+    for (node = 0; node < labels->numNodes; node++)
+    {
+        if (labels->offsets[node + 1] - labels->offsets[node] - 1 > largest)
+            largest = (int) (labels->offsets[node + 1] - labels->offsets[node] - 1);
+    }
+
+    rewind(dijkstrapairs_file);
+
+    while (2 == fscanf(dijkstrapairs_file, " %126s %126s", cityStartName, cityEndName))
+    {
+        int startId = graphCityIndex(search->graph, cityStartName);
+        int endId = graphCityIndex(search->graph, cityEndName);
+
+        if (startId < 0 || endId < 0)
+            continue;
+
+        double timeStart = timerNow();
+        searchShortestPath(search, startId, endId);
+        dijkstraTime += timerNow() - timeStart;
+
+        int distance = searchDistance(search, endId);
+
+        timeStart = timerNow();
+        int labelDistance = labelsDistance(labels, startId, endId);
+        labelsTime += timerNow() - timeStart;
+
+        if (labelDistance != distance)
+            numMismatches++;
+
+        numPairs++;
+    }
+
+    rewind(dijkstrapairs_file);
+
+    if (numPairs == 0)
+    {
+        printf("Failure: No known city pairs to compare! - (labelsReport - hubLabeling.c)\n");
+        return;
+    }
+
+    printf("\nHUB LABELS - (%d nodes, %.1f average / %d largest label, %.2fMB, %.3fs preprocessing, %d pairs)\n",
+           labels->numNodes, labels->numNodes > 0 ? (double) labels->numEntries / labels->numNodes : 0.0, largest,
+           (double) (labels->offsets[labels->numNodes] * sizeof(struct LabelEntry)
+                     + (labels->numNodes + 1) * sizeof(long long)) / (1 << 20),
+           labels->buildTime, numPairs);
+    printf("\tDijkstra : %8.2fus per query\n", dijkstraTime / numPairs * 1e6);
+    printf("\tLabels   : %8.2fus per query\n", labelsTime / numPairs * 1e6);
+    printf("\tSpeed-up : %8.2fx faster, %d distances differ.\n",
+           labelsTime > 0 ? dijkstraTime / labelsTime : 0.0, numMismatches);
+}
@@ -0,0 +1,315 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    indexedHeap.c:
+        - Source file defining the functions to create and control indexed minimum binary heaps.
+        - Implemented within 'dijkstraSearch.c' as the priority queue of the shortest path engine.
+        - Each node id is held at most once, a position array allows its key to be lowered in place
+            (decrease-key) rather than pushing duplicates or re-sorting the whole array.
+
+        - Functions:
+            - heapConstructor
+            - heapDestructor
+            - heapClear
+            - heapSize
+            - heapIsEmpty
+            - heapContains
+            - heapSiftUp
+            - heapSiftDown
+            - heapPush
+            - heapTopKey
+            - heapPop
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Include respective header file:
+#include "heap.h"
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                                    HEAP STRUCTURES
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Heap Structure:
+        capacity        - Number of node ids the heap can index (ids 0 to capacity - 1).
+        size            - Current number of items within the heap.
+        ids             - Array representation of the binary tree, storing node ids.
+        keys            - Keys of the items in the same order as 'ids'.
+        position        - Index of each node id within 'ids', or '-1' if not queued.
+*/
+struct Heap
+{
+    int capacity;
+    int size;
+    int* ids;
+    int* keys;
+    int* position;
+};
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            HEAP CONSTRUCTORS/DESTRUCTORS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Heap Constructor:
+        - Allocate memory for and create a new heap for node ids below a given capacity.
+        - Returns pointer to new heap.
+*/
+struct Heap* heapConstructor(int capacity)
+{
+    struct Heap* heap;
+
+    // Reserve memory for the heap and its arrays (at least one slot to keep allocations valid).
+    if (capacity < 1)
+        capacity = 1;
+
+    heap = malloc(sizeof(struct Heap));
+    heap->ids = malloc(capacity * sizeof(int));
+    heap->keys = malloc(capacity * sizeof(int));
+    heap->position = malloc(capacity * sizeof(int));
+
+    // Initialise heap values, no node id is queued.
+    heap->capacity = capacity;
+    heap->size = 0;
+    memset(heap->position, -1, capacity * sizeof(int));
+
+    // Return new heap.
+    return heap;
+}
+
+/*
+    Heap Destructor:
+        - Free memory associated with a heap.
+*/
+void heapDestructor(struct Heap* heap)
+{
+    free(heap->ids);
+    free(heap->keys);
+    free(heap->position);
+    free(heap);
+}
+
+/*
+    Heap Clear:
+        - Removes all items from a heap.
+        - Only the positions of queued items are reset, so clearing is proportional to the heap size
+            rather than the capacity.
+*/
+void heapClear(struct Heap* heap)
+{
+    int index;
+
+    for (index = 0; index < heap->size; index++)
+        heap->position[heap->ids[index]] = -1;
+
+    heap->size = 0;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                                HEAP SIZE FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Heap Size:
+        - Returns the current number of items in a given heap.
+*/
+int heapSize(struct Heap* heap)
+{
+    return heap->size;
+}
+
+/*
+    Heap Is Empty:
+        - Checks if a given heap is empty.
+            '1' -> Heap is empty.
+            '0' -> Heap contains at least one item.
+*/
+int heapIsEmpty(struct Heap* heap)
+{
+    if (heap->size == 0)
+        return 1;
+
+    else return 0;
+}
+
+/*
+    Heap Contains:
+        - Checks if a given node id is currently queued within a heap.
+            '1' -> Node id is queued.
+            '0' -> Node id is not queued or invalid.
+*/
+int heapContains(struct Heap* heap, int id)
+{
+    if (id < 0 || id >= heap->capacity)
+        return 0;
+
+    if (heap->position[id] >= 0)
+        return 1;
+
+    else return 0;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                                HEAP ORDERING FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Heap Sift Up:
+        - Moves the item at a given index towards the root until its parent has a smaller or equal key.
+*/
+static void heapSiftUp(struct Heap* heap, int index)
+{
+    int id = heap->ids[index];
+    int key = heap->keys[index];
+
+    while (index > 0)
+    {
+        int parentIndex = (index - 1) / 2;
+
+        // Parent is already in order, stop.
+        if (heap->keys[parentIndex] <= key)
+            break;
+
+        // Move parent down into the hole.
+        heap->ids[index] = heap->ids[parentIndex];
+        heap->keys[index] = heap->keys[parentIndex];
+        heap->position[heap->ids[index]] = index;
+
+        index = parentIndex;
+    }
+
+    heap->ids[index] = id;
+    heap->keys[index] = key;
+    heap->position[id] = index;
+}
+
+/*
+    Heap Sift Down:
+        - Moves the item at a given index towards the leaves until both children have larger or equal keys.
+*/
+static void heapSiftDown(struct Heap* heap, int index)
+{
+    int id = heap->ids[index];
+    int key = heap->keys[index];
+
+    while (1)
+    {
+        int childIndex = (2 * index) + 1;
+
+        if (childIndex >= heap->size)
+            break;
+
+        // Pick the smaller of the two children.
+        if (childIndex + 1 < heap->size && heap->keys[childIndex + 1] < heap->keys[childIndex])
+            childIndex++;
+
+        // Item is already in order, stop.
+        if (key <= heap->keys[childIndex])
+            break;
+
+        // Move child up into the hole.
+        heap->ids[index] = heap->ids[childIndex];
+        heap->keys[index] = heap->keys[childIndex];
+        heap->position[heap->ids[index]] = index;
+
+        index = childIndex;
+    }
+
+    heap->ids[index] = id;
+    heap->keys[index] = key;
+    heap->position[id] = index;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            HEAP ADD/REMOVE FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Heap Push:
+        - Inserts a node id with a given key into a heap.
+        - If the node id is already queued its key is lowered instead (larger keys are ignored).
+        - Returns indication if function was successful.
+            '1' -> Item inserted or key lowered.
+            '0' -> Node id is outside the heap capacity.
+*/
+int heapPush(struct Heap* heap, int id, int key)
+{
+    if (id < 0 || id >= heap->capacity)
+    {
+        printf("Failure: %d = Invalid heap id! - (heapPush - indexedHeap.c)\n", id);
+        return 0;
+    }
+
+    int index = heap->position[id];
+
+    // Node id already queued, decrease its key in place.
+    if (index >= 0)
+    {
+        if (key < heap->keys[index])
+        {
+            heap->keys[index] = key;
+            heapSiftUp(heap, index);
+        }
+        return 1;
+    }
+
+    // Otherwise write the new item into the next free leaf and restore the heap order.
+    index = heap->size++;
+    heap->ids[index] = id;
+    heap->keys[index] = key;
+    heapSiftUp(heap, index);
+
+    // Indicate success.
+    return 1;
+}
+
+/*
+    Heap Top Key:
+        - Returns the lowest key within a heap without removing it.
+        - Returns INT_MAX if the heap is empty.
+*/
+int heapTopKey(struct Heap* heap)
+{
+    if (heap->size == 0)
+        return INT_MAX;
+
+    return heap->keys[0];
+}
+
+/*
+    Heap Pop:
+        - Removes the node id with the lowest key from a given heap.
+        - Function returns the key of the removed item to the given address argument.
+        - Returns integer value.
+            'id' -> Node id with the lowest key.
+            '-1' -> Heap is empty.
+*/
+int heapPop(struct Heap* heap, int* key)
+{
+    // If the heap is empty then do nothing.
+    if (heap->size == 0)
+        return -1;
+
+    int id = heap->ids[0];
+
+    if (key != NULL)
+        *key = heap->keys[0];
+
+    heap->position[id] = -1;
+    heap->size--;
+
+    // Move the last leaf into the root and restore the heap order.
+    if (heap->size > 0)
+    {
+        heap->ids[0] = heap->ids[heap->size];
+        heap->keys[0] = heap->keys[heap->size];
+        heapSiftDown(heap, 0);
+    }
+
+    return id;
+}
@@ -0,0 +1,85 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    iterator.h:
+        - Header file for the 'searchIterator.c' source file.
+        - Defines the public functions to run Dijkstra's algorithm one settled city at a time, so a caller
+            can walk the cities in distance order and stop on a condition of its own.
+        - Contains the 'SearchIterator' structure.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+#ifndef ITERATOR_H_INCLUDED
+#define ITERATOR_H_INCLUDED
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        ITERATOR LIBRARIES/DEFINITIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// User Created Search Library:
+#include "search.h"
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        PUBLIC ITERATOR STRUCTURES
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    SearchIterator Structure:
+        - The frontier and distances live within the search workspace, the iterator only remembers
+            which search it belongs to (the workspace's epoch) and the last city handed out.
+        - The last city's edges are relaxed at the start of the next call, so a caller that stops
+            after a city never pays for exploring past it.
+        - Any other search run on the same workspace ends the iterator.
+
+        search          - Search workspace holding the frontier and per-node state.
+        epoch           - Epoch of the workspace's search this iterator belongs to.
+        lastCity        - Last node id handed out, not yet relaxed ('-1' if none).
+        lastDistance    - Distance of the last node id handed out.
+        isFinished      - Indication if no more node ids will be handed out.
+        maxDistance     - No node id beyond this distance is handed out ('INT_MAX' if unlimited).
+
+        (For stopping once every target is settled, see searchIteratorAddTarget())
+        targetStamp     - Epoch in which each node id was last made a target (allocated on first use).
+        numRemaining    - Number of targets not yet handed out.
+*/
+struct SearchIterator
+{
+    struct Search* search;
+    int epoch;
+
+    int lastCity;
+    int lastDistance;
+    int isFinished;
+    int maxDistance;
+
+    // For stopping once every target is settled.
+    int* targetStamp;
+    int numRemaining;
+};
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                    PUBLIC ITERATOR FUNCTION DECLARATIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Starts an iterator over the cities of a network in distance order from a given city name.
+struct SearchIterator* dijkstraBegin(struct Network* cityNetwork, const char* cityStartName);
+
+// Starts an iterator over the node ids of a search workspace in distance order from a given node id.
+struct SearchIterator* searchBegin(struct Search* search, int startId);
+
+// Settles and returns the next closest node id with its distance ('-1' once finished).
+int searchNext(struct SearchIterator* iterator, int* distance);
+
+// Makes a node id a target, the iterator finishes once every target has been handed out.
+int searchIteratorAddTarget(struct SearchIterator* iterator, int id);
+
+// Lowers the distance beyond which the iterator finishes.
+void searchIteratorLimit(struct SearchIterator* iterator, int maxDistance);
+
+// Frees memory associated with a given iterator (the search workspace is kept).
+void searchEnd(struct SearchIterator* iterator);
+
+#endif // ITERATOR_H_INCLUDED
@@ -0,0 +1,341 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    kShortestPaths.c:
+        - Source file defining the functions to find the k shortest loopless paths between two cities.
+        - Uses Yen's algorithm: each new route is the best 'spur' deviation from a previously found route,
+            found with Dijkstra's algorithm while the root of the route and the edges already taken
+            from it are hidden.
+        - Edges and cities are hidden with the search workspace's block masks, so the network and its
+            frozen graph are never modified, and every spur search starts in constant time.
+        - Spur searches start at the deviation city of the route they extend (Lawler's improvement) and
+            give up once they can no longer beat the candidates already held.
+
+        - Functions:
+            - routeConstructor
+            - routeDestructor
+            - routesDestructor
+            - routesAreEqual
+            - candidateInsert
+            - searchKShortestPaths
+            - kShortestPaths
+            - displayRoutes
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Include respective header file:
+#include "paths.h"
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        ROUTE CONSTRUCTORS/DESTRUCTORS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Route Constructor:
+        - Builds a route from the first 'rootLength' cities of a given root route followed by the path
+            the search workspace found from its start city (the spur city) to a given end node id.
+        - 'rootDistance' is the distance travelled along the root when reaching the spur city.
+*/
+static struct Route routeConstructor(struct Search* search, int endId, struct Route* root, int rootLength, int rootDistance)
+{
+    struct Route route;
+    int spurLength = searchPath(search, endId, NULL);
+    int index;
+
+    route.numNodes = rootLength + spurLength;
+    route.nodes = malloc(route.numNodes * sizeof(int));
+    route.distances = malloc(route.numNodes * sizeof(int));
+    route.deviation = rootLength;
+
+    // Copy the root cities.
+    if (rootLength > 0)
+    {
+        memcpy(route.nodes, root->nodes, rootLength * sizeof(int));
+        memcpy(route.distances, root->distances, rootLength * sizeof(int));
+    }
+
+    // Append the spur path.
+    searchPath(search, endId, &route.nodes[rootLength]);
+
+    for (index = rootLength; index < route.numNodes; index++)
+        route.distances[index] = rootDistance + searchDistance(search, route.nodes[index]);
+
+    return route;
+}
+
+/*
+    Route Destructor:
+        - Free memory associated with a route.
+*/
+static void routeDestructor(struct Route* route)
+{
+    free(route->nodes);
+    free(route->distances);
+}
+
+/*
+    Routes Destructor:
+        - Free memory associated with a set of routes.
+*/
+void routesDestructor(struct Routes* routes)
+{
+    int index;
+
+    if (routes == NULL)
+        return;
+
+    for (index = 0; index < routes->count; index++)
+        routeDestructor(&routes->route[index]);
+
+    free(routes->route);
+    free(routes);
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            CANDIDATE FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Routes Are Equal:
+        - Checks if two routes visit the same cities in the same order.
+            '1' -> Routes are equal.
+            '0' -> Routes differ.
+*/
+static int routesAreEqual(struct Route* route1, struct Route* route2)
+{
+    if (route1->numNodes != route2->numNodes)
+        return 0;
+
+    if (memcmp(route1->nodes, route2->nodes, route1->numNodes * sizeof(int)) != 0)
+        return 0;
+
+    return 1;
+}
+
+/*
+    Candidate Insert:
+        - Inserts a candidate route into an array kept in increasing order of distance.
+        - Only the best 'limit' candidates can ever be used, any beyond that are freed.
+        - Duplicate routes are freed instead of inserted.
+*/
+static void candidateInsert(struct Route* candidates, int* numCandidates, int limit, struct Route candidate)
+{
+    int index;
+    int distance = candidate.distances[candidate.numNodes - 1];
+
+    for (index = 0; index < *numCandidates; index++)
+    {
+        if (routesAreEqual(&candidates[index], &candidate) == 1)
+        {
+            routeDestructor(&candidate);
+            return;
+        }
+    }
+
+    // Find the insert position (after candidates of equal distance).
+    index = *numCandidates;
+    while (index > 0 && candidates[index - 1].distances[candidates[index - 1].numNodes - 1] > distance)
+        index--;
+
+    if (index >= limit)
+    {
+        routeDestructor(&candidate);
+        return;
+    }
+
+    // Drop the worst candidate if the array is full.
+    if (*numCandidates == limit)
+    {
+        routeDestructor(&candidates[limit - 1]);
+        (*numCandidates)--;
+    }
+
+    memmove(&candidates[index + 1], &candidates[index], (*numCandidates - index) * sizeof(struct Route));
+    candidates[index] = candidate;
+    (*numCandidates)++;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            K SHORTEST PATHS FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Search K Shortest Paths:
+        - Performs Yen's algorithm between two node ids using a given search workspace.
+        - Returns the routes found in increasing order of distance (fewer than k if the graph
+            does not contain k loopless routes, none if the cities are unreachable).
+*/
+struct Routes* searchKShortestPaths(struct Search* search, int startId, int endId, int k)
+{
+    struct Graph* graph = search->graph;
+    struct Routes* routes = malloc(sizeof(struct Routes));
+
+    routes->graph = graph;
+    routes->count = 0;
+    routes->route = malloc((k > 0 ? k : 1) * sizeof(struct Route));
+
+    if (k <= 0 || searchShortestPath(search, startId, endId) == 0)
+        return routes;
+
+    // First route is the ordinary shortest path.
+    routes->route[routes->count++] = routeConstructor(search, endId, NULL, 0, 0);
+
+    // Candidate routes, best first.
+    struct Route* candidates = malloc(k * sizeof(struct Route));
+    int numCandidates = 0;
+
+    while (routes->count < k)
+    {
+        struct Route* previous = &routes->route[routes->count - 1];
+        int needed = k - routes->count;
+        int spurIndex;
+
+        // Deviate from each city of the previous route, from where it left its own parent route.
+        for (spurIndex = previous->deviation; spurIndex < previous->numNodes - 1; spurIndex++)
+        {
+            int spurCity = previous->nodes[spurIndex];
+            int rootDistance = previous->distances[spurIndex];
+            int index, edge;
+
+            searchClearBlocks(search);
+
+            // Hide the next edge of every found route sharing this root ...
+            for (index = 0; index < routes->count; index++)
+            {
+                struct Route* route = &routes->route[index];
+
+                if (route->numNodes > spurIndex + 1
+                    && memcmp(route->nodes, previous->nodes, (spurIndex + 1) * sizeof(int)) == 0)
+                {
+                    for (edge = graph->rowStart[spurCity]; edge < graph->rowStart[spurCity + 1]; edge++)
+                    {
+                        if (graph->targets[edge] == route->nodes[spurIndex + 1])
+                            searchBlockEdge(search, edge);
+                    }
+                }
+            }
+
+            // ... and the root cities, so the route stays loopless.
+            for (index = 0; index < spurIndex; index++)
+                searchBlockNode(search, previous->nodes[index]);
+
+            // Only spur paths that beat the worst candidate still needed are worth finding.
+            int maxDistance = INT_MAX;
+
+            if (numCandidates >= needed)
+            {
+                maxDistance = candidates[needed - 1].distances[candidates[needed - 1].numNodes - 1] - rootDistance - 1;
+
+                if (maxDistance < 0)
+                    continue;
+            }
+
+            if (searchShortestPathWithin(search, spurCity, endId, maxDistance) == 1)
+                candidateInsert(candidates, &numCandidates, needed,
+                                routeConstructor(search, endId, previous, spurIndex, rootDistance));
+        }
+
+        searchClearBlocks(search);
+
+        // No deviations left, fewer than k routes exist.
+        if (numCandidates == 0)
+            break;
+
+        // Best candidate becomes the next route.
+        routes->route[routes->count++] = candidates[0];
+        memmove(&candidates[0], &candidates[1], (numCandidates - 1) * sizeof(struct Route));
+        numCandidates--;
+    }
+
+    // Free unused candidates.
+    while (numCandidates > 0)
+        routeDestructor(&candidates[--numCandidates]);
+
+    free(candidates);
+
+    return routes;
+}
+
+/*
+    K Shortest Paths:
+        - Finds up to k shortest loopless paths (alternative routes) between two given city names.
+        - Uses the network's frozen graph and search workspace, the network itself is not changed.
+        - Flags an error if either or both cities aren't present within the network already.
+        - Returns the routes found, or NULL on failure.
+*/
+struct Routes* kShortestPaths(struct Network* cityNetwork, const char* cityStartName, const char* cityEndName, int k)
+{
+    struct Search* search = networkSearch(cityNetwork);
+
+    // Find city ids.
+    int cityStartId = graphCityIndex(search->graph, cityStartName);
+    int cityEndId = graphCityIndex(search->graph, cityEndName);
+
+    // Error flagging system:
+
+    if (cityStartId < 0 && cityEndId < 0)
+    {
+        printf("Failure: Cities '%s' and '%s' not found in network! - (kShortestPaths - kShortestPaths.c)\n",
+               cityStartName, cityEndName);
+        return NULL;
+    }
+    else if (cityStartId < 0)
+    {
+        printf("Failure: City '%s' not found in network! - (kShortestPaths - kShortestPaths.c)\n", cityStartName);
+        return NULL;
+    }
+    else if (cityEndId < 0)
+    {
+        printf("Failure: City '%s' not found in network! - (kShortestPaths - kShortestPaths.c)\n", cityEndName);
+        return NULL;
+    }
+    else if (k <= 0)
+    {
+        printf("Failure: Number of paths must be greater than 0! - (kShortestPaths - kShortestPaths.c)\n");
+        return NULL;
+    }
+
+    return searchKShortestPaths(search, cityStartId, cityEndId, k);
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            ROUTES DISPLAY FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Display Routes:
+        - Prints every route in a given set of routes, in the same path format as dijkstra().
+        - Additionally indicates if no route was found.
+*/
+void displayRoutes(struct Routes* routes)
+{
+    int index, city;
+
+    if (routes == NULL || routes->count == 0)
+    {
+        printf("\tNo routes found! - Cities are unreachable.\n");
+        return;
+    }
+
+    for (index = 0; index < routes->count; index++)
+    {
+        struct Route* route = &routes->route[index];
+
+        printf("\tRoute %d: [ ", index + 1);
+
+        for (city = 0; city < route->numNodes; city++)
+        {
+            // Print edge distance between cities.
+            if (city > 0)
+                printf(" -(%dkm)-> ", route->distances[city] - route->distances[city - 1]);
+
+            printf("%s", graphCityName(routes->graph, route->nodes[city]));
+        }
+
+        printf(" ] - %dkm\n", route->distances[route->numNodes - 1]);
+    }
+}
@@ -0,0 +1,118 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    labels.h:
+        - Header file for the 'hubLabeling.c' source file.
+        - Defines the public functions to build, store and query a hub label distance oracle, for
+            queries that only need the distance between two cities (no path).
+        - Contains the 'HubLabels' structure.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+#ifndef LABELS_H_INCLUDED
+#define LABELS_H_INCLUDED
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        LABELS LIBRARIES/DEFINITIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// User Created Search Library:
+#include "search.h"
+
+/*
+    LABELS_THREADS:
+        - Default number of threads (including the calling thread) used to build the labels.
+*/
+#define LABELS_THREADS 4
+
+/*
+    LABELS_SERIAL_HUBS:
+        - Number of most important hubs searched one at a time before the threads take over.
+        - Their labels prune almost every later search, so they are worth building in order.
+*/
+#define LABELS_SERIAL_HUBS 64
+
+/*
+    LABELS_ROUND_HUBS:
+        - Number of hubs each thread searches per parallel round. Hubs of the same round cannot prune
+            each other's searches, so larger rounds add a few redundant label entries.
+*/
+#define LABELS_ROUND_HUBS 8
+
+/*
+    LABELS_SENTINEL:
+        - Hub of the entry closing every label, so two labels merge without bounds checks.
+*/
+#define LABELS_SENTINEL INT_MAX
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        PUBLIC LABELS STRUCTURES
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    LabelEntry Structure:
+        hub         - Rank of the hub node (its position within the hub order, not its node id).
+        distance    - Shortest distance between the label's node and the hub.
+*/
+struct LabelEntry
+{
+    int hub;
+    int distance;
+};
+
+/*
+    HubLabels Structure:
+        - Every node's label lists hubs sorted by rank, such that any two connected nodes share a hub
+            on one of their shortest paths. A query is the smallest sum over the hubs both labels share.
+        - Loaded labels point straight into the memory mapped file, so loading costs no copying.
+
+        numNodes        - Number of nodes.
+        numEntries      - Number of label entries, not counting the sentinels.
+        offsets         - Index of the first entry of each node's label (numNodes + 1 entries).
+        entries         - Every label in node id order, each closed by a LABELS_SENTINEL entry.
+        names           - Graph holding only the node names and name index (no edges).
+        buildTime       - Construction time in seconds ('0' once loaded).
+        mapping         - Start of the memory mapped file ('NULL' if built in memory).
+        mappingSize     - Size of the memory mapped file in bytes.
+*/
+struct HubLabels
+{
+    int numNodes;
+    long long numEntries;
+
+    long long* offsets;
+    struct LabelEntry* entries;
+
+    struct Graph* names;
+    double buildTime;
+
+    void* mapping;
+    size_t mappingSize;
+};
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                    PUBLIC LABELS FUNCTION DECLARATIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Builds the hub labels of a graph by pruned landmark labeling across a given number of threads.
+struct HubLabels* labelsConstructor(struct Graph* graph, int numThreads);
+
+// Frees (or unmaps) memory associated with given hub labels.
+void labelsDestructor(struct HubLabels* labels);
+
+// Writes hub labels to a binary file laid out to be memory mapped.
+int labelsSave(struct HubLabels* labels, const char* fileName);
+
+// Memory maps hub labels written by labelsSave().
+struct HubLabels* labelsLoad(const char* fileName);
+
+// Returns the shortest distance between two node ids (INT_MAX if unreachable).
+int labelsDistance(struct HubLabels* labels, int startId, int endId);
+
+// Prints the label sizes and the query time of the labels against Dijkstra's algorithm over a file of city pairs.
+void labelsReport(struct HubLabels* labels, struct Search* search, FILE* dijkstrapairs_file);
+
+#endif // LABELS_H_INCLUDED
@@ -0,0 +1,740 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    landmarkSearch.c:
+        - Source file defining the functions to choose landmarks, build and store their distance tables,
+            and run A* searches directed by them within a 'Search' workspace.
+        - For any landmark 'L' the triangle inequality gives |d(L, end) - d(L, node)| as a lower bound on
+            the distance from a node to the end. The largest bound over every landmark is the node's
+            potential, and A* settles nodes in order of distance plus potential. The bound is consistent,
+            so settled nodes are final exactly as in Dijkstra's algorithm and the same paths are found.
+        - Bounds are tightest for end nodes lying 'behind' a landmark, so landmarks are spread to the
+            edges of the graph: either the node furthest from the landmarks so far, or a leaf of a
+            random shortest path tree below the subtree the landmarks so far bound worst ('avoid').
+
+        - Functions:
+            - landmarksChecksum
+            - landmarksAllocate
+            - landmarksRandom
+            - landmarksBound
+            - landmarksCompareOrder
+            - landmarksFarthest
+            - landmarksAvoid
+            - landmarksConstructor
+            - landmarksDestructor
+            - landmarksSave
+            - landmarksLoad
+            - landmarksAttach
+            - searchSetLandmarks
+            - searchShortestPathLandmarks
+            - dijkstraLandmarks
+            - landmarksReport
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Include respective header file:
+#include "landmarks.h"
+
+// Identifies a landmarks file.
+#define LANDMARKS_FILE_TAG 0x4b4d444c
+
+// Seed of the random root nodes (the same graph always gets the same landmarks).
+#define LANDMARKS_SEED 0x2545f491u
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            LANDMARKS STRUCTURES
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    LandmarkOrder Structure:
+        - Node reached by a shortest path tree, sorted furthest first so children come before parents.
+
+        distance    - Distance of the node from the tree's root.
+        id          - Node id.
+*/
+struct LandmarkOrder
+{
+    int distance;
+    int id;
+};
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        LANDMARKS PREPROCESSING FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Landmarks Checksum:
+        - Returns the FNV-1a checksum of a graph's node count and rows (ids, targets and distances).
+        - Any change to a path or city changes the checksum, so stale tables are never used.
+*/
+unsigned int landmarksChecksum(struct Graph* graph)
+{
+    unsigned int checksum = 2166136261u;
+    int index;
+
+    checksum = (checksum ^ (unsigned int) graph->numNodes) * 16777619u;
+
+    for (index = 0; index <= graph->numNodes; index++)
+        checksum = (checksum ^ (unsigned int) graph->rowStart[index]) * 16777619u;
+
+    for (index = 0; index < graph->numEdges; index++)
+    {
+        checksum = (checksum ^ (unsigned int) graph->targets[index]) * 16777619u;
+        checksum = (checksum ^ (unsigned int) graph->weights[index]) * 16777619u;
+    }
+
+    return checksum;
+}
+
+/*
+    Landmarks Allocate:
+        - Allocate memory for the tables of a given number of landmarks over a given number of nodes.
+        - Returns pointer to new landmark tables.
+*/
+static struct Landmarks* landmarksAllocate(int numNodes, int numLandmarks)
+{
+    struct Landmarks* landmarks = malloc(sizeof(struct Landmarks));
+    size_t numEntries = (size_t) numNodes * numLandmarks;
+
+    landmarks->numNodes = numNodes;
+    landmarks->numLandmarks = numLandmarks;
+    landmarks->method = LANDMARKS_FARTHEST;
+    landmarks->checksum = 0;
+
+    landmarks->ids = malloc((numLandmarks > 0 ? numLandmarks : 1) * sizeof(int));
+    landmarks->distance = malloc((numEntries > 0 ? numEntries : 1) * sizeof(int));
+    landmarks->buildTime = 0;
+
+    landmarks->checkedGraph = NULL;
+    landmarks->checkedVersion = -1;
+
+    // Return new landmark tables.
+    return landmarks;
+}
+
+/*
+    Landmarks Random:
+        - Returns the next value of a simple linear congruential generator.
+*/
+static unsigned int landmarksRandom(unsigned int* seed)
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return *seed >> 8;
+}
+
+/*
+    Landmarks Bound:
+        - Returns the largest lower bound on the distance between two nodes given by the first
+            'numLandmarks' landmarks, reading each node's table row.
+*/
+static inline int landmarksBound(const int* row1, const int* row2, int numLandmarks)
+{
+    int bound = 0;
+    int index;
+
+    for (index = 0; index < numLandmarks; index++)
+    {
+        if (row1[index] == LANDMARKS_UNREACHABLE || row2[index] == LANDMARKS_UNREACHABLE)
+            continue;
+
+        int difference = row1[index] - row2[index];
+
+        if (difference < 0)
+            difference = -difference;
+
+        if (difference > bound)
+            bound = difference;
+    }
+
+    return bound;
+}
+
+/*
+    Landmarks Compare Order:
+        - Compares two reached nodes for qsort(), furthest from the root first.
+*/
+static int landmarksCompareOrder(const void* item1, const void* item2)
+{
+    const struct LandmarkOrder* order1 = item1;
+    const struct LandmarkOrder* order2 = item2;
+
+    if (order1->distance != order2->distance)
+        return (order1->distance < order2->distance) ? 1 : -1;
+
+    return (order1->id > order2->id) ? 1 : (order1->id < order2->id) ? -1 : 0;
+}
+
+/*
+    Landmarks Farthest:
+        - Returns the node furthest from its nearest landmark so far (nodes no landmark reaches first).
+*/
+static int landmarksFarthest(int numNodes, int* nearest)
+{
+    int farthest = 0;
+    int node;
+
+    for (node = 1; node < numNodes; node++)
+        if (nearest[node] > nearest[farthest])
+            farthest = node;
+
+    return farthest;
+}
+
+/*
+    Landmarks Avoid:
+        - Grows the shortest path tree of a random root. Each node is weighted by how much the root's
+            distance to it exceeds the landmarks' bound, and each subtree by the sum of its weights
+            (zero once it holds a landmark). The next landmark is the leaf reached from the root by
+            always stepping into the heaviest child subtree.
+        - Returns the chosen node id, or '-1' if every subtree already holds a landmark.
+*/
+static int landmarksAvoid(struct Search* search, struct Landmarks* landmarks, int numChosen, unsigned int* seed,
+                          int* isLandmark, long long* size, struct LandmarkOrder* order)
+{
+    struct Graph* graph = search->graph;
+    int numNodes = graph->numNodes;
+    int root = landmarksRandom(seed) % numNodes;
+    int numReached = 0;
+    int index, node;
+
+    searchShortestPath(search, root, -1);
+
+    const int* rootRow = &landmarks->distance[(size_t) root * landmarks->numLandmarks];
+
+    for (node = 0; node < numNodes; node++)
+    {
+        if (searchDistance(search, node) == INT_MAX)
+            continue;
+
+        const int* nodeRow = &landmarks->distance[(size_t) node * landmarks->numLandmarks];
+
+        size[node] = search->distance[node] - landmarksBound(rootRow, nodeRow, numChosen);
+        order[numReached].distance = search->distance[node];
+        order[numReached].id = node;
+        numReached++;
+    }
+
+    // Sum the subtrees, children before parents. A landmark empties every subtree above it.
+    qsort(order, numReached, sizeof(struct LandmarkOrder), landmarksCompareOrder);
+
+    for (index = 0; index < numReached; index++)
+    {
+        node = order[index].id;
+
+        if (isLandmark[node] != 0)
+            size[node] = -1;
+
+        int parent = search->back[node];
+
+        if (parent < 0)
+            continue;
+
+        if (size[node] < 0)
+            size[parent] = -1;
+
+        else if (size[parent] >= 0)
+            size[parent] += size[node];
+    }
+
+    if (size[root] <= 0)
+        return -1;
+
+    // Step down into the heaviest subtree until a leaf.
+    node = root;
+
+    while (1)
+    {
+        int heaviest = -1;
+        int edge;
+
+        for (edge = graph->rowStart[node]; edge < graph->rowStart[node + 1]; edge++)
+        {
+            int child = graph->targets[edge];
+
+            if (search->back[child] == node && searchDistance(search, child) != INT_MAX && size[child] > 0
+                && (heaviest < 0 || size[child] > size[heaviest]))
+                heaviest = child;
+        }
+
+        if (heaviest < 0)
+            return node;
+
+        node = heaviest;
+    }
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        LANDMARKS CONSTRUCTORS/DESTRUCTORS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Landmarks Constructor:
+        - Chooses a given number of landmarks on a graph (at most one per node) with a given method
+            and records the distance of each landmark to every node.
+        - The first landmark is the node furthest from a random node. A node no landmark reaches
+            (another part of the graph) always becomes the next landmark.
+        - Returns pointer to new landmark tables, or 'NULL' if the count or method is invalid.
+*/
+struct Landmarks* landmarksConstructor(struct Graph* graph, int numLandmarks, int method)
+{
+    double timeStart = timerNow();
+    int numNodes = graph->numNodes;
+    int index, node;
+
+    // Error flagging system:
+
+    if (numLandmarks <= 0)
+    {
+        printf("Failure: %d = Invalid number of landmarks! - (landmarksConstructor - landmarkSearch.c)\n", numLandmarks);
+        return NULL;
+    }
+    else if (method != LANDMARKS_FARTHEST && method != LANDMARKS_AVOID)
+    {
+        printf("Failure: %d = Invalid landmark method! - (landmarksConstructor - landmarkSearch.c)\n", method);
+        return NULL;
+    }
+    else if (numNodes == 0)
+    {
+        printf("Failure: Graph must contain at least 1 city! - (landmarksConstructor - landmarkSearch.c)\n");
+        return NULL;
+    }
+
+    if (numLandmarks > numNodes)
+        numLandmarks = numNodes;
+
+    struct Landmarks* landmarks = landmarksAllocate(numNodes, numLandmarks);
+    struct Search* search = searchConstructor(graph);
+    unsigned int seed = LANDMARKS_SEED;
+
+    landmarks->method = method;
+
+    int* nearest = malloc(numNodes * sizeof(int));
+    int* isLandmark = calloc(numNodes, sizeof(int));
+    long long* size = malloc(numNodes * sizeof(long long));
+    struct LandmarkOrder* order = malloc(numNodes * sizeof(struct LandmarkOrder));
+
+    for (node = 0; node < numNodes; node++)
+        nearest[node] = LANDMARKS_UNREACHABLE;
+
+    // First landmark, furthest from a random node.
+    searchShortestPath(search, landmarksRandom(&seed) % numNodes, -1);
+
+    int landmark = search->start;
+    for (node = 0; node < numNodes; node++)
+        if (searchDistance(search, node) != INT_MAX && search->distance[node] > search->distance[landmark])
+            landmark = node;
+
+    for (index = 0; index < numLandmarks; index++)
+    {
+        // Choose the next landmark (the first is already chosen).
+        if (index > 0)
+        {
+            landmark = landmarksFarthest(numNodes, nearest);
+
+            if (nearest[landmark] != LANDMARKS_UNREACHABLE && method == LANDMARKS_AVOID)
+            {
+                int avoided = landmarksAvoid(search, landmarks, index, &seed, isLandmark, size, order);
+
+                if (avoided >= 0 && isLandmark[avoided] == 0)
+                    landmark = avoided;
+            }
+
+            // Every node is already a landmark.
+            if (isLandmark[landmark] != 0)
+                break;
+        }
+
+        landmarks->ids[index] = landmark;
+        isLandmark[landmark] = 1;
+
+        // Record the landmark's distance to every node within column 'index'.
+        searchShortestPath(search, landmark, -1);
+
+        for (node = 0; node < numNodes; node++)
+        {
+            int distance = searchDistance(search, node);
+
+            landmarks->distance[(size_t) node * numLandmarks + index] = distance;
+
+            if (distance < nearest[node])
+                nearest[node] = distance;
+        }
+    }
+
+    // Every node is already a landmark, the remaining columns give no bound.
+    for (; index < numLandmarks; index++)
+    {
+        landmarks->ids[index] = landmarks->ids[0];
+
+        for (node = 0; node < numNodes; node++)
+            landmarks->distance[(size_t) node * numLandmarks + index] = LANDMARKS_UNREACHABLE;
+    }
+
+    landmarks->checksum = landmarksChecksum(graph);
+
+    free(nearest);
+    free(isLandmark);
+    free(size);
+    free(order);
+    searchDestructor(search);
+
+    landmarks->buildTime = timerNow() - timeStart;
+
+    // Return new landmark tables.
+    return landmarks;
+}
+
+/*
+    Landmarks Destructor:
+        - Free memory associated with landmark tables.
+*/
+void landmarksDestructor(struct Landmarks* landmarks)
+{
+    if (landmarks == NULL)
+        return;
+
+    free(landmarks->ids);
+    free(landmarks->distance);
+    free(landmarks);
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            LANDMARKS FILE FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Landmarks Save:
+        - Writes landmark tables to a binary file (native byte order): tag, numNodes, numLandmarks,
+            method, checksum, then the landmark ids and the distance table.
+        - Returns indication if function was successful.
+            '1' -> File written.
+            '0' -> File could not be written.
+*/
+int landmarksSave(struct Landmarks* landmarks, const char* fileName)
+{
+    FILE* file = fopen(fileName, "wb");
+
+    if (file == NULL)
+    {
+        printf("Failure: Unable to open '%s'! - (landmarksSave - landmarkSearch.c)\n", fileName);
+        return 0;
+    }
+
+    size_t numEntries = (size_t) landmarks->numNodes * landmarks->numLandmarks;
+    int header[5] = { LANDMARKS_FILE_TAG, landmarks->numNodes, landmarks->numLandmarks, landmarks->method,
+                      (int) landmarks->checksum };
+
+    int written = (fwrite(header, sizeof(int), 5, file) == 5);
+    written &= (fwrite(landmarks->ids, sizeof(int), landmarks->numLandmarks, file) == (size_t) landmarks->numLandmarks);
+    written &= (fwrite(landmarks->distance, sizeof(int), numEntries, file) == numEntries);
+
+    if (fclose(file) != 0 || written == 0)
+    {
+        printf("Failure: Unable to write '%s'! - (landmarksSave - landmarkSearch.c)\n", fileName);
+        return 0;
+    }
+
+    return 1;
+}
+
+/*
+    Landmarks Load:
+        - Reads landmark tables written by landmarksSave(), for use on a given graph.
+        - Returns pointer to new landmark tables, or 'NULL' if the file is missing, invalid, or was
+            built for a different graph (checksum mismatch).
+*/
+struct Landmarks* landmarksLoad(const char* fileName, struct Graph* graph)
+{
+    FILE* file = fopen(fileName, "rb");
+
+    if (file == NULL)
+    {
+        printf("Failure: Unable to open '%s'! - (landmarksLoad - landmarkSearch.c)\n", fileName);
+        return NULL;
+    }
+
+    int header[5];
+
+    if (fread(header, sizeof(int), 5, file) != 5 || header[0] != LANDMARKS_FILE_TAG || header[1] < 0 || header[2] <= 0)
+    {
+        printf("Failure: '%s' is not a landmarks file! - (landmarksLoad - landmarkSearch.c)\n", fileName);
+        fclose(file);
+        return NULL;
+    }
+
+    if (header[1] != graph->numNodes || (unsigned int) header[4] != landmarksChecksum(graph))
+    {
+        printf("Failure: '%s' was built for a different graph! - (landmarksLoad - landmarkSearch.c)\n", fileName);
+        fclose(file);
+        return NULL;
+    }
+
+    struct Landmarks* landmarks = landmarksAllocate(header[1], header[2]);
+    size_t numEntries = (size_t) header[1] * header[2];
+
+    landmarks->method = header[3];
+    landmarks->checksum = (unsigned int) header[4];
+
+    int valid = (fread(landmarks->ids, sizeof(int), header[2], file) == (size_t) header[2]);
+    valid &= (fread(landmarks->distance, sizeof(int), numEntries, file) == numEntries);
+
+    fclose(file);
+
+    if (valid == 0)
+    {
+        printf("Failure: '%s' is incomplete! - (landmarksLoad - landmarkSearch.c)\n", fileName);
+        landmarksDestructor(landmarks);
+        return NULL;
+    }
+
+    // Return new landmark tables.
+    return landmarks;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            LANDMARKS SEARCH FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Landmarks Attach:
+        - Directs a workspace's searches with landmark tables already checked against its graph.
+*/
+static void landmarksAttach(struct Search* search, struct Landmarks* landmarks)
+{
+    if (search->potential == NULL)
+        search->potential = malloc((search->graph->numNodes > 0 ? search->graph->numNodes : 1) * sizeof(int));
+
+    search->landmarks = landmarks;
+}
+
+/*
+    Search Set Landmarks:
+        - Directs every later search with an end node within a workspace by given landmark tables,
+            after checking they were built for the workspace's graph ('NULL' returns to plain Dijkstra).
+        - Returns indication if function was successful.
+            '1' -> Landmarks set.
+            '0' -> Landmarks belong to a different graph (workspace left unchanged).
+*/
+int searchSetLandmarks(struct Search* search, struct Landmarks* landmarks)
+{
+    if (landmarks == NULL)
+    {
+        search->landmarks = NULL;
+        return 1;
+    }
+
+    if (landmarks->numNodes != search->graph->numNodes || landmarks->checksum != landmarksChecksum(search->graph))
+    {
+        printf("Failure: Landmarks were built for a different graph! - (searchSetLandmarks - landmarkSearch.c)\n");
+        return 0;
+    }
+
+    landmarksAttach(search, landmarks);
+    return 1;
+}
+
+/*
+    Search Shortest Path Landmarks:
+        - Performs A* between two node ids, skipping blocked edges and nodes: reached nodes are queued
+            by distance plus the landmarks' lower bound on their remaining distance to the end.
+        - Stops as soon as the end node is settled, and gives up once every queued node's bound is
+            further than 'maxDistance'. Settled nodes hold their exact shortest distance and route.
+        - Called by searchShortestPathWithin() for workspaces with landmarks.
+        - Returns indication if the end node was reached.
+            '1' -> End node settled.
+            '0' -> Cities are unreachable, further apart than 'maxDistance' or a limit expired.
+*/
+int searchShortestPathLandmarks(struct Search* search, int startId, int endId, int maxDistance)
+{
+    struct Graph* graph = search->graph;
+    struct Landmarks* landmarks = search->landmarks;
+    int numLandmarks = landmarks->numLandmarks;
+    const int* endRow = &landmarks->distance[(size_t) endId * numLandmarks];
+    int key;
+
+    searchReset(search, startId);
+
+    while (heapIsEmpty(search->heap) == 0)
+    {
+        // Stop once no remaining node can lead to the end within range.
+        if (heapTopKey(search->heap) > maxDistance)
+            break;
+
+        // Stop once the query has used up its time or budget.
+        if (search->hasLimits == 1 && searchLimitsExpired(search) == 1)
+            return 0;
+
+        int currentCity = heapPop(search->heap, &key);
+        int currentDistance = search->distance[currentCity];
+
+        // Current city is now fully explored.
+        search->settledStamp[currentCity] = search->epoch;
+        search->settledCount++;
+
+        if (currentCity == endId)
+            return 1;
+
+        int edge;
+        for (edge = graph->rowStart[currentCity]; edge < graph->rowStart[currentCity + 1]; edge++)
+        {
+            int connectedCity = graph->targets[edge];
+            int newDistance = currentDistance + graph->weights[edge];
+
+            // Skip cities whose shortest distance is already final.
+            if (search->settledStamp[connectedCity] == search->epoch)
+                continue;
+
+            // Skip edges and cities that are temporarily removed.
+            if (search->hasBlocks == 1 && (search->edgeBlocked[edge] == search->blockEpoch
+                                           || search->nodeBlocked[connectedCity] == search->blockEpoch))
+                continue;
+
+            if (search->stamp[connectedCity] == search->epoch)
+            {
+                if (newDistance >= search->distance[connectedCity])
+                    continue;
+            }
+
+            // First time reached, its bound never changes within this search.
+            else search->potential[connectedCity] = landmarksBound(&landmarks->distance[(size_t) connectedCity * numLandmarks],
+                                                                   endRow, numLandmarks);
+
+            search->stamp[connectedCity] = search->epoch;
+            search->distance[connectedCity] = newDistance;
+            search->back[connectedCity] = currentCity;
+            heapPush(search->heap, connectedCity, newDistance + search->potential[connectedCity]);
+        }
+    }
+
+    return 0;
+}
+
+/*
+    Dijkstra Landmarks:
+        - Performs dijkstra() between two given city names as an A* search directed by landmark tables,
+            printing and writing exactly the same results.
+        - The tables are checked against the network's frozen graph once per network version.
+        - Returns indication if function was successful.
+            '1' -> Network scanned - Path found or cities are unreachable.
+            '0' -> City names invalid / Network is too small / Landmarks built for a different network.
+*/
+int dijkstraLandmarks(FILE* dijkstraresults_file, double* algorithmTime, struct Network* cityNetwork,
+                      struct Landmarks* landmarks, const char* cityStartName, const char* cityEndName)
+{
+    struct Search* search = networkSearch(cityNetwork);
+    int version = networkVersion(cityNetwork);
+
+    *algorithmTime = 0;
+
+    // Check the tables only when the network has changed since they were last found to match.
+    if (landmarks->checkedGraph != search->graph || landmarks->checkedVersion != version)
+    {
+        if (searchSetLandmarks(search, landmarks) == 0)
+            return 0;
+
+        landmarks->checkedGraph = search->graph;
+        landmarks->checkedVersion = version;
+    }
+
+    else landmarksAttach(search, landmarks);
+
+    // Run the search and format its results, the network's workspace returns to plain Dijkstra after.
+    char* text = NULL;
+    int textCapacity = 0;
+    int isSuccessful = searchQuery(search, cityStartName, cityEndName, &text, &textCapacity, algorithmTime);
+
+    search->landmarks = NULL;
+
+    // Failures are only printed to the terminal.
+    printf("%s", text);
+
+    if (isSuccessful == 1)
+        fprintf(dijkstraresults_file, "%s", text);
+
+    free(text);
+
+    return isSuccessful;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            LANDMARKS DISPLAY FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Landmarks Report:
+        - Runs every pair of a 'dijkstrapairs.txt' file through plain Dijkstra and through A* with
+            given landmark tables on the same workspace, then prints the mean settled nodes and time
+            per query of each and how many distances differ (always '0').
+        - Pairs with unknown city names are skipped, the file is rewound afterwards.
+*/
+void landmarksReport(struct Search* search, struct Landmarks* landmarks, FILE* dijkstrapairs_file)
+{
+    struct Landmarks* previous = search->landmarks;
+    char cityStartName[127], cityEndName[127];
+    long long dijkstraSettled = 0, landmarkSettled = 0;
+    double dijkstraTime = 0, landmarkTime = 0;
+    int numPairs = 0, numMismatches = 0;
+
+    if (searchSetLandmarks(search, landmarks) == 0)
+        return;
+
+    rewind(dijkstrapairs_file);
+
+    while (2 == fscanf(dijkstrapairs_file, " %126s %126s", cityStartName, cityEndName))
+    {
+        int startId = graphCityIndex(search->graph, cityStartName);
+        int endId = graphCityIndex(search->graph, cityEndName);
+
+        if (startId < 0 || endId < 0)
+            continue;
+
+        // Plain Dijkstra.
+        search->landmarks = NULL;
+
+        double timeStart = timerNow();
+        searchShortestPath(search, startId, endId);
+        dijkstraTime += timerNow() - timeStart;
+
+        int distance = searchDistance(search, endId);
+        dijkstraSettled += search->settledCount;
+
+        // A* with the landmarks.
+        search->landmarks = landmarks;
+
+        timeStart = timerNow();
+        searchShortestPath(search, startId, endId);
+        landmarkTime += timerNow() - timeStart;
+
+        landmarkSettled += search->settledCount;
+
+        if (searchIsSettled(search, endId) == 1 ? searchDistance(search, endId) != distance : distance != INT_MAX)
+            numMismatches++;
+
+        numPairs++;
+    }
+
+    rewind(dijkstrapairs_file);
+    search->landmarks = previous;
+
+    if (numPairs == 0)
+    {
+        printf("Failure: No known city pairs to compare! - (landmarksReport - landmarkSearch.c)\n");
+        return;
+    }
+
+    printf("\nLANDMARKS - (%d landmarks, %s, %.3fs preprocessing, %d pairs)\n", landmarks->numLandmarks,
+           landmarks->method == LANDMARKS_AVOID ? "avoid" : "farthest", landmarks->buildTime, numPairs);
+    printf("\tDijkstra : %10.1f settled nodes, %8.2fus per query\n",
+           (double) dijkstraSettled / numPairs, dijkstraTime / numPairs * 1e6);
+    printf("\tA*       : %10.1f settled nodes, %8.2fus per query\n",
+           (double) landmarkSettled / numPairs, landmarkTime / numPairs * 1e6);
+    printf("\tReduction: %10.2fx fewer nodes, %8.2fx faster, %d distances differ.\n",
+           landmarkSettled > 0 ? (double) dijkstraSettled / landmarkSettled : 0.0,
+           landmarkTime > 0 ? dijkstraTime / landmarkTime : 0.0, numMismatches);
+}
@@ -0,0 +1,120 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    landmarks.h:
+        - Header file for the 'landmarkSearch.c' source file.
+        - Defines the public functions to choose landmarks on a frozen graph, store their distance tables,
+            and direct Dijkstra's algorithm towards the end city with them (A*, landmarks and the triangle
+            inequality - 'ALT'). The city files hold no coordinates, landmark bounds work on any graph.
+        - Contains the 'Landmarks' structure.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+#ifndef LANDMARKS_H_INCLUDED
+#define LANDMARKS_H_INCLUDED
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        LANDMARKS LIBRARIES/DEFINITIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// User Created Search Library:
+#include "search.h"
+
+/*
+    LANDMARKS_METHOD:
+        - Methods understood by landmarksConstructor() to choose the landmarks.
+                LANDMARKS_FARTHEST  -> Each landmark is the node furthest from every landmark chosen so far.
+                LANDMARKS_AVOID     -> Each landmark is a leaf of the shortest path tree of a random node,
+                                        below the subtree the current landmarks bound worst.
+*/
+#define LANDMARKS_FARTHEST 0
+#define LANDMARKS_AVOID 1
+
+/*
+    LANDMARKS_COUNT:
+        - Default number of landmarks. Each adds one distance per node to the tables and one bound
+            to check per reached node, in exchange for tighter bounds.
+*/
+#define LANDMARKS_COUNT 16
+
+/*
+    LANDMARKS_UNREACHABLE:
+        - Table entry of a node the landmark cannot reach (the node gives no bound from that landmark).
+*/
+#define LANDMARKS_UNREACHABLE INT_MAX
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        PUBLIC LANDMARKS STRUCTURES
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Landmarks Structure:
+        - Row 'node' of the table holds the distance of every landmark to that node, so the bounds of
+            one node are read from one cache line or two.
+        - Paths are undirected, so |d(L, end) - d(L, node)| is a lower bound on the distance between
+            a node and the end for every landmark 'L'.
+
+        numNodes        - Number of nodes of the graph the tables were built for.
+        numLandmarks    - Number of landmarks.
+        method          - Method used to choose the landmarks (see LANDMARKS_METHOD).
+        checksum        - Checksum of the graph's rows, tables are only used on a graph with the same checksum.
+        ids             - Node id of each landmark.
+        distance        - Distance of each landmark to each node (numNodes rows of numLandmarks entries).
+        buildTime       - Preprocessing time in seconds.
+
+        (Cache used by dijkstraLandmarks())
+        checkedGraph    - Frozen graph last found to match the tables.
+        checkedVersion  - Network version of that frozen graph.
+*/
+struct Landmarks
+{
+    int numNodes;
+    int numLandmarks;
+    int method;
+    unsigned int checksum;
+
+    int* ids;
+    int* distance;
+    double buildTime;
+
+    // Cache used by dijkstraLandmarks().
+    struct Graph* checkedGraph;
+    int checkedVersion;
+};
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                    PUBLIC LANDMARKS FUNCTION DECLARATIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Chooses a given number of landmarks on a graph with a given method and builds their distance tables.
+struct Landmarks* landmarksConstructor(struct Graph* graph, int numLandmarks, int method);
+
+// Frees memory associated with given landmark tables.
+void landmarksDestructor(struct Landmarks* landmarks);
+
+// Writes landmark tables to a binary file.
+int landmarksSave(struct Landmarks* landmarks, const char* fileName);
+
+// Reads landmark tables written by landmarksSave(), checking they belong to a given graph.
+struct Landmarks* landmarksLoad(const char* fileName, struct Graph* graph);
+
+// Returns the checksum of a graph's rows, as stored within landmark tables.
+unsigned int landmarksChecksum(struct Graph* graph);
+
+// Directs the searches of a workspace with given landmark tables ('NULL' returns to plain Dijkstra).
+int searchSetLandmarks(struct Search* search, struct Landmarks* landmarks);
+
+// Runs A* between two node ids with the workspace's landmarks, giving up beyond a maximum distance.
+int searchShortestPathLandmarks(struct Search* search, int startId, int endId, int maxDistance);
+
+// Performs dijkstra() between two city names as an A* search directed by given landmark tables.
+int dijkstraLandmarks(FILE* dijkstraresults_file, double* algorithmTime, struct Network* cityNetwork,
+                      struct Landmarks* landmarks, const char* cityStartName, const char* cityEndName);
+
+// Prints the settled nodes and time per query of Dijkstra's algorithm and of A* over a file of city pairs.
+void landmarksReport(struct Search* search, struct Landmarks* landmarks, FILE* dijkstrapairs_file);
+
+#endif // LANDMARKS_H_INCLUDED
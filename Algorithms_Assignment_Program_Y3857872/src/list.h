@@ -27,6 +27,19 @@
 */
 #define LIST_CAPACITY 16
 
+/*
+    LIST_SIMD_WIDTH:
+        - Number of 32-bit distances held by one SIMD register (8 for AVX2).
+        - List arrays are aligned to and padded to a multiple of this number of entries.
+*/
+#define LIST_SIMD_WIDTH 8
+
+/*
+    LIST_PAD_DISTANCE:
+        - Distance held in the unused (padding) slots of a list, large enough to never be a shortest path.
+*/
+#define LIST_PAD_DISTANCE INT_MAX
+
 
 /** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
                                         PUBLIC LIST STRUCTURES
@@ -58,18 +71,27 @@ void listDestructor(struct List* list);
 // Returns the size of a given list.
 int listSize(struct List* list);
 
-// Adds a vertex/node into a list with a given relative distance.
-int listAdd(struct List* list, struct Node* city, int distance);
+// Adds a path with a given distance into the connection lists of both given nodes.
+int listAddPath(struct Node* city1, struct Node* city2, int distance);
 
-// Removes an present vertex/node from a list with a given index.
-int listRemove(struct List* list, int index);
+// Removes the path at a given index of a list from both connection lists it is stored in.
+int listRemovePath(struct List* list, int index);
 
 // Searches a list for a given city name and returns its index if found.
-int listSearch(struct List* list, char cityName[127]);
+int listSearch(struct List* list, const char* cityName);
+
+// Searches a list for a given node and returns its index if found.
+int listFind(struct List* list, struct Node* city);
 
 // Returns pointer to a node and distance a given list and index.
 struct Node* getListEntity(struct List* list, int index, int* pathDistance);
 
+// Returns the contiguous array of connected nodes within a given list.
+struct Node** listCities(struct List* list);
+
+// Returns the contiguous (SIMD padded) array of distances within a given list.
+int* listDistances(struct List* list);
+
 // Displays the current nodes and respective distances within a list.
 void listDisplay(struct List* list);
 
@@ -10,9 +10,30 @@
             - networkConstructor / networkDestructor
             - addCity / removeCity
             - addPath / removePath
+            - batchApply
             - displayNetwork
             - displayConnections
+            - networkComponentCount / displayComponents
             - dijkstra
+            - dijkstraPipeline / dijkstraPipelineIds
+            - kShortestPaths / displayRoutes
+            - deltaShortestPaths
+            - citiesWithin / citiesWithinBatch / displayArea
+            - oneToMany / displayTargets
+            - nearestCities / nearestFacilities / displayNearest / displayVoronoi
+            - dijkstraBegin / searchNext / searchIteratorAddTarget / searchEnd
+            - searchSetLimits
+            - cityHandle / cityHandles / dijkstraHandles / handleDistance / handlesWritePairs
+            - sourceCacheConstructor / sourceCacheDistance / sourceCachePath / sourceCacheReport
+            - compressedShortestPath / compressedReport
+            - allPairsConstructor / allPairsDistance / allPairsSave / allPairsLoad
+            - hierarchyConstructor / hierarchyShortestPath / hierarchyDisplayPath / hierarchySave / hierarchyLoad
+            - tableConstructor / tableDistance / tableReport
+            - landmarksConstructor / dijkstraLandmarks / landmarksSave / landmarksLoad / landmarksReport
+            - labelsConstructor / labelsDistance / labelsSave / labelsLoad / labelsReport
+            - arcFlagsConstructor / arcFlagsUpdate / dijkstraArcFlags / arcFlagsReport
+            - overlayConstructor / overlayCustomize / overlayShortestPath / overlayReport
+            - versionedConstructor / snapshotAcquire / snapshotRelease
 
         - Scans two tab-delimited data input files in the text format:
             - 'ukcitypaths.txt'        -> 'city1Name    city2Name   distanceBetweenCities'
@@ -37,8 +58,27 @@
 
 * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
 
-// Include network header file:
+// Include network, pipeline, paths, delta-stepping, area, targets, nearest, iterator, handle, cache, compressed graph, all-pairs, hierarchy, distance table,
+// landmarks, labels, arc flags, overlay and snapshot header files:
 #include "network.h"
+#include "pipeline.h"
+#include "paths.h"
+#include "delta.h"
+#include "area.h"
+#include "targets.h"
+#include "nearest.h"
+#include "iterator.h"
+#include "handle.h"
+#include "cache.h"
+#include "compressed.h"
+#include "allPairs.h"
+#include "hierarchy.h"
+#include "table.h"
+#include "landmarks.h"
+#include "labels.h"
+#include "arcFlags.h"
+#include "overlay.h"
+#include "snapshot.h"
 
 
 /** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
@@ -227,10 +267,739 @@ int main(void)
         addCity(cityNetwork, "Coventry");
         displayConnections(cityNetwork, "Coventry");                                      // Test display city with no connections.
         dijkstra(dijkstraresults_file, &algorithmTime, cityNetwork, "Edinburgh", "Coventry");             // Test unreachable path.
+        printf("Settled %d cities searching for Coventry.\n", networkSearch(cityNetwork)->settledCount);    // None if components differ.
+        displayComponents(cityNetwork, 5);
+
+        // The pipeline's workers are given the same component labels.
+        FILE* unreachablePairs_file = tmpfile();
+        FILE* unreachableResults_file = tmpfile();                                                     // Keeps the results file unchanged.
+
+            // Flag error at exit point '1' if failure to create the temporary files.
+            if (unreachablePairs_file == NULL || unreachableResults_file == NULL)
+            {
+                printf("Error: cannot create a temporary file! - (main.c)\n");
+                exit(1);
+            }
+
+        fprintf(unreachablePairs_file, "Edinburgh\tCoventry\n");
+        rewind(unreachablePairs_file);
+        dijkstraPipeline(unreachablePairs_file, unreachableResults_file, cityNetwork, 1, &algorithmTime);  // None settled if components differ.
+        fclose(unreachablePairs_file);
+        fclose(unreachableResults_file);
         printf("\n");
 
         removeCity(cityNetwork, "Coventry");
 
+        // Testing 'batchApply', a batch is applied whole or not at all.
+        printf("\nTesting 'batchApply' function:\n");
+        struct Batch* batch = batchConstructor();
+        batchAddCity(batch, "Coventry");
+        batchAddPath(batch, "Coventry", "York", 10);
+        batchRemovePath(batch, "York", "Hull");
+        batchRemovePath(batch, "Coventry", "Leeds");                                                  // Path not present, batch undone.
+        batchApply(cityNetwork, batch);
+        displayConnections(cityNetwork, "York");                                                      // Hull still connected.
+
+        batchDestructor(batch);
+        batch = batchConstructor();
+        batchAddCity(batch, "Coventry");
+        batchAddPath(batch, "Coventry", "York", 10);
+        batchRemoveCity(batch, "Coventry");                                                           // Test add and remove within one batch.
+        batchApply(cityNetwork, batch);
+        batchDestructor(batch);
+
+        // Testing 'kShortestPaths' error flags.
+        printf("\nTesting 'kShortestPaths' function:\n");
+        kShortestPaths(cityNetwork, "Winchester", "York", 3);                                         // City1 not present.
+        kShortestPaths(cityNetwork, "Edinburgh", "York", 0);                                          // Invalid number of paths.
+
+        struct Routes* routes = kShortestPaths(cityNetwork, "Edinburgh", "York", 3);                  // Test display alternative routes.
+        displayRoutes(routes);
+        routesDestructor(routes);
+
+        // Testing 'deltaShortestPaths' against the sequential search (one-to-all from the same city).
+        printf("\nTesting 'deltaShortestPaths' function:\n");
+        struct Search* search = networkSearch(cityNetwork);
+        struct DeltaSearch* deltaSearch = deltaConstructor(search->graph, DELTA_THREADS, DELTA_AUTO);
+        int cityId, deltaMismatches = 0;
+
+        deltaShortestPaths(deltaSearch, -1);                                                          // Invalid start id.
+        deltaShortestPaths(deltaSearch, graphCityIndex(search->graph, "Edinburgh"));
+        searchShortestPath(search, graphCityIndex(search->graph, "Edinburgh"), -1);
+
+        for (cityId = 0; cityId < search->graph->numNodes; cityId++)
+            if (deltaDistance(deltaSearch, cityId) != searchDistance(search, cityId))
+                deltaMismatches++;
+
+        printf("%s: %d distances from Edinburgh differ from the sequential search (delta %dkm, %d threads).\n",
+               deltaMismatches == 0 ? "Success" : "Failure", deltaMismatches, deltaWidth(deltaSearch), DELTA_THREADS);
+        deltaDestructor(deltaSearch);
+
+        // Testing 'citiesWithin', areas against the sequential search (every city it finds within range).
+        printf("\nTesting 'citiesWithin' function:\n");
+        citiesWithin(cityNetwork, "Winchester", 100, AREA_ORDER_DISTANCE);                           // City not present.
+        citiesWithin(cityNetwork, "Edinburgh", -1, AREA_ORDER_DISTANCE);                             // Invalid distance.
+
+        struct Area* area = citiesWithin(cityNetwork, "Edinburgh", 200, AREA_ORDER_NAME);            // Test display area.
+        displayArea(area);
+        areaDestructor(area);
+
+        char areaStartNames[3][127] = {"Edinburgh", "York", "Winchester"};
+        struct Area** areas = citiesWithinBatch(cityNetwork, areaStartNames, 3, 300, AREA_ORDER_DISTANCE, AREA_THREADS);
+        int areaMismatches = 0, areaCount = 0;
+
+        for (cityId = 0; cityId < 2; cityId++)
+        {
+            int areaCity;
+            searchShortestPath(search, graphCityIndex(search->graph, areaStartNames[cityId]), -1);
+
+            for (areaCity = 0; areaCity < search->graph->numNodes; areaCity++)
+                if (searchDistance(search, areaCity) <= 300)
+                    areaCount++;
+
+            for (areaCity = 0; areas[cityId] != NULL && areaCity < areas[cityId]->count; areaCity++)
+                if (areas[cityId]->distances[areaCity] != searchDistance(search, areas[cityId]->nodes[areaCity]))
+                    areaMismatches++;
+
+            areaCount -= (areas[cityId] != NULL ? areas[cityId]->count : 0);
+        }
+
+        printf("%s: %d distances and %d cities within 300km of Edinburgh and York differ from the sequential search.\n",
+               areaMismatches == 0 && areaCount == 0 ? "Success" : "Failure", areaMismatches, areaCount);
+        areasDestructor(areas, 3);
+
+        // Testing 'oneToMany', one search against a separate sequential search per target.
+        printf("\nTesting 'oneToMany' function:\n");
+        char targetNames[5][127] = {"York", "Glasgow", "Winchester", "Leeds", "Edinburgh"};
+        oneToMany(cityNetwork, "Winchester", targetNames, 5);                                          // Start city not present.
+
+        struct Targets* targets = oneToMany(cityNetwork, "Edinburgh", targetNames, 5);                 // Test display targets.
+        displayTargets(targets);
+
+        int targetMismatches = 0, targetSettled = 0, target;
+
+        for (target = 0; targets != NULL && target < targets->count; target++)
+        {
+            if (targets->nodes[target] < 0)
+                continue;
+
+            searchShortestPath(search, graphCityIndex(search->graph, "Edinburgh"), targets->nodes[target]);
+            targetSettled += search->settledCount;
+
+            if (searchDistance(search, targets->nodes[target]) != targets->distances[target])
+                targetMismatches++;
+        }
+
+        printf("%s: %d distances from Edinburgh differ from the sequential search (%d cities settled by separate searches).\n",
+               targetMismatches == 0 && targets != NULL ? "Success" : "Failure", targetMismatches, targetSettled);
+        targetsDestructor(targets);
+
+        // Testing 'nearestCities', the k closest cities against a full sequential search.
+        printf("\nTesting 'nearestCities' function:\n");
+        nearestCities(cityNetwork, "Edinburgh", -1);                                                   // Negative number of cities.
+
+        struct Nearest* nearest = nearestCities(cityNetwork, "Edinburgh", 5);                          // Test display nearest.
+        displayNearest(nearest);
+
+        int nearestMismatches = 0, nearestCloser = 0;
+        searchShortestPath(search, graphCityIndex(search->graph, "Edinburgh"), -1);
+
+        for (target = 0; nearest != NULL && target < nearest->count; target++)
+        {
+            if (searchDistance(search, nearest->nodes[target]) != nearest->distances[target])
+                nearestMismatches++;
+
+            if (nearest->distances[target] < nearest->distances[nearest->count - 1])
+                nearestCloser--;
+        }
+
+        // No city left out may be closer than the furthest city found.
+        for (cityId = 0; nearest != NULL && nearest->count > 0 && cityId < search->graph->numNodes; cityId++)
+            if (cityId != search->start && searchIsSettled(search, cityId) == 1
+                && searchDistance(search, cityId) < nearest->distances[nearest->count - 1])
+                nearestCloser++;
+
+        printf("%s: %d distances differ and %d closer cities left out of the nearest %d found.\n",
+               nearest != NULL && nearestMismatches == 0 && nearestCloser == 0 ? "Success" : "Failure",
+               nearestMismatches, nearestCloser, nearest != NULL ? nearest->count : 0);
+        nearestDestructor(nearest);
+
+        // Testing 'nearestFacilities', one search from every facility against a separate search per facility.
+        printf("\nTesting 'nearestFacilities' function:\n");
+        char facilityNames[3][127] = {"Bristol", "Leeds", "Glasgow"};
+        struct Voronoi* voronoi = nearestFacilities(cityNetwork, facilityNames, 3);                     // Test display regions.
+        displayVoronoi(voronoi);
+
+        int voronoiMismatches = 0, voronoiSettled = 0, facility;
+        int* closestDistance = malloc(search->graph->numNodes * sizeof(int));
+
+        for (cityId = 0; cityId < search->graph->numNodes; cityId++)
+            closestDistance[cityId] = INT_MAX;
+
+        for (facility = 0; voronoi != NULL && facility < voronoi->numFacilities; facility++)
+        {
+            if (voronoi->facilities[facility] < 0)
+                continue;
+
+            searchShortestPath(search, voronoi->facilities[facility], -1);
+            voronoiSettled += search->settledCount;
+
+            for (cityId = 0; cityId < search->graph->numNodes; cityId++)
+                if (searchIsSettled(search, cityId) == 1 && searchDistance(search, cityId) < closestDistance[cityId])
+                    closestDistance[cityId] = searchDistance(search, cityId);
+        }
+
+        for (cityId = 0; voronoi != NULL && cityId < search->graph->numNodes; cityId++)
+            if (voronoi->distances[cityId] != closestDistance[cityId])
+                voronoiMismatches++;
+
+        printf("%s: %d nearest facility distances differ from the sequential search (%d cities settled by separate searches).\n",
+               voronoiMismatches == 0 && voronoi != NULL ? "Success" : "Failure", voronoiMismatches, voronoiSettled);
+        free(closestDistance);
+        voronoiDestructor(voronoi);
+
+        // Testing 'dijkstraBegin', pulling cities until the first depot against a full sequential search.
+        printf("\nTesting 'dijkstraBegin' function:\n");
+        dijkstraBegin(cityNetwork, "Winchester");                                                      // Start city not present.
+
+        char depotNames[3][127] = {"Leeds", "Hull", "Oxford"};
+        int* pulledCities = malloc(search->graph->numNodes * sizeof(int));
+        int* pulledDistances = malloc(search->graph->numNodes * sizeof(int));
+        int numPulled = 0, iteratorMismatches = 0, depot, isDepot = 0;
+
+        struct SearchIterator* iterator = dijkstraBegin(cityNetwork, "Edinburgh");
+
+        while (isDepot == 0 && (cityId = searchNext(iterator, &pulledDistances[numPulled])) >= 0)
+        {
+            pulledCities[numPulled++] = cityId;
+
+            for (depot = 0; depot < 3; depot++)
+                if (strcmp(graphCityName(search->graph, cityId), depotNames[depot]) == 0)
+                    isDepot = 1;
+        }
+
+        if (numPulled > 0)
+            printf("\tFirst depot: %s - %dkm (%d cities pulled)\n", graphCityName(search->graph, pulledCities[numPulled - 1]),
+                   pulledDistances[numPulled - 1], numPulled);
+
+        // Add a target while running, the iterator must finish on it.
+        struct SearchIterator* targetIterator = searchBegin(search, graphCityIndex(search->graph, "Edinburgh"));
+        int lastCity = searchNext(targetIterator, NULL);
+        searchIteratorAddTarget(targetIterator, graphCityIndex(search->graph, "York"));
+
+        while ((cityId = searchNext(targetIterator, NULL)) >= 0)
+            lastCity = cityId;
+
+        int iteratorSettled = search->settledCount;
+        searchEnd(targetIterator);
+
+        searchShortestPath(search, graphCityIndex(search->graph, "Edinburgh"), -1);
+        searchNext(iterator, NULL);                                                                     // Workspace reused by another search.
+        searchEnd(iterator);
+
+        for (target = 0; target < numPulled; target++)
+            if (searchDistance(search, pulledCities[target]) != pulledDistances[target]
+                || (target > 0 && pulledDistances[target] < pulledDistances[target - 1]))
+                iteratorMismatches++;
+
+        printf("%s: %d pulled distances differ or are out of order, last city with target York was '%s' (%d of %d cities settled).\n",
+               iteratorMismatches == 0 && numPulled > 0 ? "Success" : "Failure", iteratorMismatches,
+               lastCity >= 0 ? graphCityName(search->graph, lastCity) : "none", iteratorSettled, search->settledCount);
+        free(pulledCities);
+        free(pulledDistances);
+
+        // Testing 'searchSetLimits', a settled city budget and a cancellation token against an unlimited query.
+        printf("\nTesting 'searchSetLimits' function:\n");
+        char* limitText = NULL;
+        int limitTextCapacity = 0, limitSettled;
+        atomic_int cancelToken;
+        atomic_init(&cancelToken, 0);
+
+        struct SearchLimits limits = { 0, 3, NULL };
+        searchSetLimits(search, &limits);
+        searchQuery(search, "Edinburgh", "York", &limitText, &limitTextCapacity, &algorithmTime);      // Budget of 3 cities.
+        printf("%s", limitText);
+        limitSettled = search->settledCount;
+
+        limits.maxSettled = 0;
+        limits.timeLimit = 1.0;
+        limits.cancel = &cancelToken;
+        atomic_store(&cancelToken, 1);
+        searchSetLimits(search, &limits);
+        searchQuery(search, "Edinburgh", "York", &limitText, &limitTextCapacity, &algorithmTime);      // Cancelled before starting.
+        printf("%s", limitText);
+
+        int limitStatus = search->status;
+        searchSetLimits(search, NULL);
+        searchQuery(search, "Edinburgh", "York", &limitText, &limitTextCapacity, &algorithmTime);
+
+        printf("%s: Budget stopped after %d cities, cancelled with status %d and complete with status %d once cleared.\n",
+               limitSettled <= 3 && limitStatus == SEARCH_STATUS_CANCELLED && search->status == SEARCH_STATUS_COMPLETE
+               ? "Success" : "Failure", limitSettled, limitStatus, search->status);
+        free(limitText);
+
+        // Testing 'cityHandles', handle queries against name queries and a handle outliving its network version.
+        printf("\nTesting 'cityHandles' function:\n");
+        char handleNames[3][127] = {"Edinburgh", "York", "Winchester"};
+        struct CityHandle handles[3];
+        int numHandles = cityHandles(cityNetwork, handleNames, 3, handles);                            // Third city not present.
+
+        FILE* idPairs_file = tmpfile();                                                                 // Keeps the results file unchanged.
+
+            // Flag error at exit point '1' if failure to create the temporary file.
+            if (idPairs_file == NULL)
+            {
+                printf("Error: cannot create a temporary file! - (main.c)\n");
+                exit(1);
+            }
+
+        dijkstraHandles(idPairs_file, &algorithmTime, cityNetwork, handles[0], handles[2]);            // Handle not found.
+        dijkstraHandles(idPairs_file, &algorithmTime, cityNetwork, handles[0], handles[1]);
+        rewind(idPairs_file);
+
+        int handleResult = handleDistance(cityNetwork, handles[0], handles[1]);
+        searchShortestPath(search, graphCityIndex(search->graph, "Edinburgh"), graphCityIndex(search->graph, "York"));
+        int nameResult = searchDistance(search, graphCityIndex(search->graph, "York"));
+
+        addCity(cityNetwork, "Coventry");                                                              // New version, handles out of date.
+        int staleResult = handleDistance(cityNetwork, handles[0], handles[1]);
+        removeCity(cityNetwork, "Coventry");
+        search = networkSearch(cityNetwork);
+
+        int numIdPairs = handlesWritePairs(dijkstrapairs_file, idPairs_file, cityNetwork);
+        rewind(dijkstrapairs_file);
+        fclose(idPairs_file);
+
+        printf("%s: %d of 3 handles found, %dkm by handle and %dkm by name, %d once out of date, %d pairs written as ids.\n",
+               numHandles == 2 && handleResult == nameResult && staleResult == -1 && numIdPairs == dijkstrapairs_lines
+               ? "Success" : "Failure", numHandles, handleResult, nameResult, staleResult, numIdPairs);
+
+        // Testing 'sourceCacheDistance', a hub heavy workload within 3 trees of memory against the sequential search.
+        printf("\nTesting 'sourceCacheDistance' function:\n");
+        struct SourceCache* cache = sourceCacheConstructor(search->graph, 3 * 2 * search->graph->numNodes * sizeof(int));
+        char hubNames[4][127] = {"Edinburgh", "Leeds", "Manchester", "Birmingham"};
+        int cacheMismatches = 0, query;
+
+        for (query = 0; query < 1000; query++)
+        {
+            // Four in five queries touch a hub, half of them as the end city.
+            int hubId = graphCityIndex(search->graph, hubNames[query % 4]);
+            int otherId = (query * 13) % search->graph->numNodes;
+            int startId = (query % 5 == 4 || hubId < 0) ? (query * 17) % search->graph->numNodes : hubId;
+            int endId = otherId;
+
+            if (query % 2 == 1)
+            {
+                endId = startId;
+                startId = otherId;
+            }
+
+            int cacheResult = sourceCacheDistance(cache, startId, endId);
+            int searchResult = searchShortestPath(search, startId, endId) == 1 ? searchDistance(search, endId) : INT_MAX;
+
+            if (cacheResult != searchResult)
+                cacheMismatches++;
+        }
+
+        // Walk a cached path and add up its edges.
+        int* cachePath = malloc(search->graph->numNodes * sizeof(int));
+        int cacheStart = graphCityIndex(search->graph, "Edinburgh"), cacheEnd = search->graph->numNodes - 1;
+        int cachePathLength = sourceCachePath(cache, cacheEnd, cacheStart, cachePath), cachePathDistance = 0;
+
+        for (target = 1; target < cachePathLength; target++)
+            cachePathDistance += graphEdgeWeight(search->graph, cachePath[target - 1], cachePath[target]);
+
+        if (cachePathLength > 0 && cachePathDistance != sourceCacheDistance(cache, cacheEnd, cacheStart))
+            cacheMismatches++;
+
+        sourceCacheReport(cache);
+        printf("%s: %d cached distances differ from the sequential search.\n", cacheMismatches == 0 ? "Success" : "Failure",
+               cacheMismatches);
+        free(cachePath);
+        sourceCacheDestructor(cache);
+
+        // Testing 'compressedShortestPath' against the sequential search (same query on the compressed graph).
+        printf("\nTesting 'compressedShortestPath' function:\n");
+        struct CompressedGraph* compressed = compressedConstructor(search->graph);
+        struct Search* compressedSearch = compressedSearchConstructor(compressed);
+
+        compressedShortestPath(compressedSearch, compressed, graphCityIndex(compressed->names, "Edinburgh"),
+                               graphCityIndex(compressed->names, "York"));
+        searchShortestPath(search, graphCityIndex(search->graph, "Edinburgh"), graphCityIndex(search->graph, "York"));
+
+        printf("%s: Edinburgh -> York is %dkm on the compressed graph and %dkm on the frozen graph.\n",
+               searchDistance(compressedSearch, graphCityIndex(compressed->names, "York"))
+                   == searchDistance(search, graphCityIndex(search->graph, "York")) ? "Success" : "Failure",
+               searchDistance(compressedSearch, graphCityIndex(compressed->names, "York")),
+               searchDistance(search, graphCityIndex(search->graph, "York")));
+
+        compressedReport(search->graph, compressed);
+        searchDestructor(compressedSearch);
+        compressedDestructor(compressed);
+
+        // Testing 'allPairsConstructor', both builders against the sequential search, and a saved copy against the original.
+        printf("\nTesting 'allPairsConstructor' function:\n");
+        allPairsConstructor(search->graph, 2, ALLPAIRS_THREADS);                                      // Invalid method.
+        struct AllPairs* floydMatrix = allPairsConstructor(search->graph, ALLPAIRS_FLOYD, ALLPAIRS_THREADS);
+        struct AllPairs* dijkstraMatrix = allPairsConstructor(search->graph, ALLPAIRS_DIJKSTRA, ALLPAIRS_THREADS);
+        int pairMismatches = 0;
+
+        allPairsSave(floydMatrix, "allpairs.bin");
+        struct AllPairs* loadedMatrix = allPairsLoad("allpairs.bin");
+        remove("allpairs.bin");
+
+        searchShortestPath(search, graphCityIndex(search->graph, "Edinburgh"), -1);
+
+        for (cityId = 0; cityId < search->graph->numNodes; cityId++)
+        {
+            int startId = graphCityIndex(search->graph, "Edinburgh");
+
+            if (allPairsDistance(floydMatrix, startId, cityId) != searchDistance(search, cityId)
+                || allPairsDistance(dijkstraMatrix, startId, cityId) != searchDistance(search, cityId)
+                || (loadedMatrix != NULL && allPairsDistance(loadedMatrix, startId, cityId) != searchDistance(search, cityId)))
+                pairMismatches++;
+        }
+
+        printf("%s: %d distances from Edinburgh differ between the matrices and the sequential search.\n",
+               pairMismatches == 0 && loadedMatrix != NULL ? "Success" : "Failure", pairMismatches);
+
+        allPairsDestructor(floydMatrix);
+        allPairsDestructor(dijkstraMatrix);
+        allPairsDestructor(loadedMatrix);
+
+        // Testing 'hierarchyConstructor', queries against the sequential search, and a saved copy against the original.
+        printf("\nTesting 'hierarchyConstructor' function:\n");
+        struct Hierarchy* hierarchy = hierarchyConstructor(search->graph, HIERARCHY_THREADS);
+        struct HierarchySearch* hierarchySearch = hierarchySearchConstructor(hierarchy);
+        int hierarchyMismatches = 0;
+
+        hierarchySave(hierarchy, "hierarchy.bin");
+        struct Hierarchy* loadedHierarchy = hierarchyLoad("hierarchy.bin");
+        struct HierarchySearch* loadedSearch = (loadedHierarchy != NULL) ? hierarchySearchConstructor(loadedHierarchy) : NULL;
+        remove("hierarchy.bin");
+
+        hierarchyShortestPath(hierarchySearch, -1, 0);                                                  // Invalid id.
+        searchShortestPath(search, graphCityIndex(search->graph, "Edinburgh"), -1);
+
+        for (cityId = 0; cityId < search->graph->numNodes; cityId++)
+        {
+            int startId = graphCityIndex(search->graph, "Edinburgh");
+
+            if (hierarchyShortestPath(hierarchySearch, startId, cityId) != searchDistance(search, cityId)
+                || (loadedSearch != NULL && hierarchyShortestPath(loadedSearch, startId, cityId) != searchDistance(search, cityId)))
+                hierarchyMismatches++;
+        }
+
+        printf("%s: %d distances from Edinburgh differ between the hierarchies and the sequential search.\n",
+               hierarchyMismatches == 0 && loadedSearch != NULL ? "Success" : "Failure", hierarchyMismatches);
+
+        hierarchyShortestPath(hierarchySearch, graphCityIndex(search->graph, "Edinburgh"), graphCityIndex(search->graph, "York"));
+        hierarchyDisplayPath(hierarchySearch);
+        hierarchyReport(hierarchy);
+
+        // Testing 'hierarchyShortestPath' on a generated graph, timed against the sequential search.
+        printf("\nTesting 'hierarchyShortestPath' function:\n");
+        struct Graph* generatedGraph = graphGenerate(10000, 4, 100, 7);
+        struct Hierarchy* generatedHierarchy = hierarchyConstructor(generatedGraph, HIERARCHY_THREADS);
+        struct HierarchySearch* generatedSearch = hierarchySearchConstructor(generatedHierarchy);
+        struct Search* generatedDijkstra = searchConstructor(generatedGraph);
+        double hierarchyQueryTime = 0, sequentialQueryTime = 0, queryStart;
+        int numGeneratedQueries = 200;
+
+        hierarchyMismatches = 0;
+
+        for (query = 0; query < numGeneratedQueries; query++)
+        {
+            int startId = (query * 7919) % generatedGraph->numNodes;
+            int endId = (query * 104729 + 1) % generatedGraph->numNodes;
+
+            queryStart = timerNow();
+            int generatedDistance = hierarchyShortestPath(generatedSearch, startId, endId);
+            hierarchyQueryTime += timerNow() - queryStart;
+
+            queryStart = timerNow();
+            searchShortestPath(generatedDijkstra, startId, endId);
+            sequentialQueryTime += timerNow() - queryStart;
+
+            if (generatedDistance != searchDistance(generatedDijkstra, endId))
+                hierarchyMismatches++;
+        }
+
+        hierarchyReport(generatedHierarchy);
+        printf("%s: Hierarchy queries averaged %.3fms against %.3fms for the sequential search (%d distances differ).\n",
+               hierarchyMismatches == 0 && hierarchyQueryTime < sequentialQueryTime ? "Success" : "Failure",
+               hierarchyQueryTime * 1000 / numGeneratedQueries, sequentialQueryTime * 1000 / numGeneratedQueries, hierarchyMismatches);
+
+        searchDestructor(generatedDijkstra);
+        hierarchySearchDestructor(generatedSearch);
+        hierarchyDestructor(generatedHierarchy);
+        graphDestructor(generatedGraph);
+
+        // Testing 'tableConstructor', a many-to-many table on the hierarchy against one sequential search per source.
+        printf("\nTesting 'tableConstructor' function:\n");
+        int tableSources[8], tableTargets[search->graph->numNodes];
+        int numTableSources = 0;
+
+        for (cityId = 0; cityId < search->graph->numNodes; cityId++)
+        {
+            tableTargets[cityId] = cityId;
+
+            if (cityId % 3 == 0 && numTableSources < 8)
+                tableSources[numTableSources++] = cityId;
+        }
+
+        tableConstructor(hierarchy, tableSources, numTableSources, tableTargets, 0, TABLE_THREADS);             // No targets.
+        struct DistanceTable* table = tableConstructor(hierarchy, tableSources, numTableSources, tableTargets,
+                                                       search->graph->numNodes, TABLE_THREADS);
+        tableDistance(table, 0, -1);                                                                    // Invalid index.
+        int tableMismatches = tableReport(table, search);
+
+        printf("%s: %d table distances differ from the sequential search.\n",
+               tableMismatches == 0 ? "Success" : "Failure", tableMismatches);
+        tableDestructor(table);
+
+        hierarchySearchDestructor(hierarchySearch);
+        hierarchySearchDestructor(loadedSearch);
+        hierarchyDestructor(hierarchy);
+        hierarchyDestructor(loadedHierarchy);
+
+        // Testing 'landmarksConstructor', A* against the sequential search, a saved copy, and the settled nodes saved on the pairs.
+        printf("\nTesting 'landmarksConstructor' function:\n");
+        landmarksConstructor(search->graph, 0, LANDMARKS_AVOID);                                        // Invalid count.
+        struct Landmarks* landmarks = landmarksConstructor(search->graph, LANDMARKS_COUNT, LANDMARKS_AVOID);
+        struct Search* landmarkSearch = searchConstructor(search->graph);
+        int landmarkMismatches = 0;
+
+        landmarksSave(landmarks, "landmarks.bin");
+        struct Landmarks* loadedLandmarks = landmarksLoad("landmarks.bin", search->graph);
+        remove("landmarks.bin");
+
+        searchSetLandmarks(landmarkSearch, loadedLandmarks != NULL ? loadedLandmarks : landmarks);
+        searchShortestPath(search, graphCityIndex(search->graph, "Edinburgh"), -1);
+
+        for (cityId = 0; cityId < search->graph->numNodes; cityId++)
+        {
+            searchShortestPath(landmarkSearch, graphCityIndex(search->graph, "Edinburgh"), cityId);
+
+            if (searchDistance(landmarkSearch, cityId) != searchDistance(search, cityId))
+                landmarkMismatches++;
+        }
+
+        printf("%s: %d distances from Edinburgh differ between A* and the sequential search.\n",
+               landmarkMismatches == 0 && loadedLandmarks != NULL ? "Success" : "Failure", landmarkMismatches);
+
+        dijkstraLandmarks(dijkstraresults_file, &algorithmTime, cityNetwork, landmarks, "Edinburgh", "York");
+        dijkstraLandmarks(dijkstraresults_file, &algorithmTime, cityNetwork, landmarks, "Edinburgh", "Winchester");  // City2 not present.
+        landmarksReport(landmarkSearch, landmarks, dijkstrapairs_file);
+
+        searchDestructor(landmarkSearch);
+        landmarksDestructor(landmarks);
+        landmarksDestructor(loadedLandmarks);
+
+        // Testing 'labelsConstructor', label distances against the sequential search, a mapped copy, and the query time on the pairs.
+        printf("\nTesting 'labelsConstructor' function:\n");
+        struct HubLabels* labels = labelsConstructor(search->graph, LABELS_THREADS);
+        int labelMismatches = 0;
+
+        labelsSave(labels, "labels.bin");
+        struct HubLabels* loadedLabels = labelsLoad("labels.bin");
+        remove("labels.bin");
+
+        labelsDistance(labels, 0, -1);                                                                  // Invalid id.
+        searchShortestPath(search, graphCityIndex(search->graph, "Edinburgh"), -1);
+
+        for (cityId = 0; cityId < search->graph->numNodes; cityId++)
+        {
+            int startId = graphCityIndex(search->graph, "Edinburgh");
+
+            if (labelsDistance(labels, startId, cityId) != searchDistance(search, cityId)
+                || (loadedLabels != NULL && labelsDistance(loadedLabels, startId, cityId) != searchDistance(search, cityId)))
+                labelMismatches++;
+        }
+
+        printf("%s: %d distances from Edinburgh differ between the hub labels and the sequential search.\n",
+               labelMismatches == 0 && loadedLabels != NULL ? "Success" : "Failure", labelMismatches);
+
+        labelsReport(labels, search, dijkstrapairs_file);
+
+        labelsDestructor(labels);
+        labelsDestructor(loadedLabels);
+
+        // Testing 'arcFlagsConstructor', flagged searches against the sequential search before and after a path weight changes.
+        printf("\nTesting 'arcFlagsConstructor' function:\n");
+        arcFlagsConstructor(search->graph, 0, ARCFLAGS_THREADS);                                        // Invalid count.
+        struct Graph* flaggedGraph = graphReorder(search->graph, GRAPH_ORDER_NONE, NULL);               // Copy to change.
+        struct ArcFlags* arcFlags = arcFlagsConstructor(flaggedGraph, ARCFLAGS_REGIONS, ARCFLAGS_THREADS);
+        struct Search* flagSearch = searchConstructor(flaggedGraph);
+        struct Search* plainSearch = searchConstructor(flaggedGraph);
+        int flagMismatches = 0;
+        int flagRound, edge;
+
+        int flagStart = graphCityIndex(flaggedGraph, "Edinburgh");
+        int flagNeighbour = flaggedGraph->targets[flaggedGraph->rowStart[flagStart]];
+        int oldWeight = flaggedGraph->weights[flaggedGraph->rowStart[flagStart]];
+
+        for (flagRound = 0; flagRound < 2; flagRound++)
+        {
+            searchSetArcFlags(flagSearch, arcFlags);
+            searchShortestPath(plainSearch, flagStart, -1);
+
+            for (cityId = 0; cityId < flaggedGraph->numNodes; cityId++)
+            {
+                searchShortestPath(flagSearch, flagStart, cityId);
+
+                if (searchDistance(flagSearch, cityId) != searchDistance(plainSearch, cityId))
+                    flagMismatches++;
+            }
+
+            // Shorten Edinburgh's first path (both directions) to a tenth, then add the flags it needs.
+            if (flagRound == 0)
+            {
+                for (edge = flaggedGraph->rowStart[flagStart]; edge < flaggedGraph->rowStart[flagStart + 1]; edge++)
+                    if (flaggedGraph->targets[edge] == flagNeighbour)
+                        flaggedGraph->weights[edge] = oldWeight / 10 + 1;
+
+                for (edge = flaggedGraph->rowStart[flagNeighbour]; edge < flaggedGraph->rowStart[flagNeighbour + 1]; edge++)
+                    if (flaggedGraph->targets[edge] == flagStart)
+                        flaggedGraph->weights[edge] = oldWeight / 10 + 1;
+
+                arcFlagsUpdate(arcFlags, flaggedGraph, flagStart, flagNeighbour, oldWeight);
+            }
+        }
+
+        printf("%s: %d distances from Edinburgh differ between the arc flags and the sequential search.\n",
+               flagMismatches == 0 ? "Success" : "Failure", flagMismatches);
+
+        dijkstraArcFlags(dijkstraresults_file, &algorithmTime, cityNetwork, arcFlags, "Edinburgh", "York");   // Flags of the changed copy.
+        arcFlagsReport(plainSearch, arcFlags, dijkstrapairs_file);
+
+        searchDestructor(flagSearch);
+        searchDestructor(plainSearch);
+        arcFlagsDestructor(arcFlags);
+        graphDestructor(flaggedGraph);
+
+        // Testing 'overlayCustomize', overlay queries against the sequential search before and after a path distance changes.
+        printf("\nTesting 'overlayCustomize' function:\n");
+        struct Overlay* overlay = overlayConstructor(search->graph);
+        struct OverlaySearch* overlaySearch = overlaySearchConstructor(overlay);
+        int overlayMismatches = 0;
+        int overlayRound;
+
+        char overlayNeighbour[127];
+        int overlayStart = graphCityIndex(search->graph, "Edinburgh");
+        int overlayWeight = search->graph->weights[search->graph->rowStart[overlayStart]];
+        strcpy(overlayNeighbour, graphCityName(search->graph, search->graph->targets[search->graph->rowStart[overlayStart]]));
+
+        overlayCustomize(overlay, search->graph, OVERLAY_THREADS);
+        overlayShortestPath(overlaySearch, 0, -1);                                                       // Invalid id.
+
+        for (overlayRound = 0; overlayRound < 2; overlayRound++)
+        {
+            searchShortestPath(search, graphCityIndex(search->graph, "Edinburgh"), -1);
+
+            for (cityId = 0; cityId < search->graph->numNodes; cityId++)
+                if (overlayShortestPath(overlaySearch, graphCityIndex(overlay->names, "Edinburgh"),
+                                        graphCityIndex(overlay->names, graphCityName(search->graph, cityId)))
+                    != searchDistance(search, cityId))
+                    overlayMismatches++;
+
+            // Halve Edinburgh's first path through the network, then customize only the cells holding it.
+            removePath(cityNetwork, "Edinburgh", overlayNeighbour);
+            addPath(cityNetwork, "Edinburgh", overlayNeighbour, overlayRound == 0 ? overlayWeight / 2 + 1 : overlayWeight);
+            search = networkSearch(cityNetwork);
+
+            overlayCustomize(overlay, search->graph, OVERLAY_THREADS);
+        }
+
+        printf("%s: %d distances from Edinburgh differ between the overlay and the sequential search.\n",
+               overlayMismatches == 0 ? "Success" : "Failure", overlayMismatches);
+
+        addCity(cityNetwork, "Coventry");                                                              // New city, new partition.
+        overlayCustomize(overlay, networkSearch(cityNetwork)->graph, OVERLAY_THREADS);
+        removeCity(cityNetwork, "Coventry");
+        search = networkSearch(cityNetwork);
+
+        overlaySearchDestructor(overlaySearch);
+        overlayDestructor(overlay);
+
+        // Testing 'overlayCustomize' on a generated graph, a changed path only customizes the cells holding it again.
+        printf("\nTesting 'overlayCustomize' function:\n");
+        generatedGraph = graphGenerate(2000, 4, 100, 7);
+        overlay = overlayConstructor(generatedGraph);
+        overlaySearch = overlaySearchConstructor(overlay);
+        generatedDijkstra = searchConstructor(generatedGraph);
+        int overlayCells = 0, overlayLevel;
+
+        for (overlayLevel = 0; overlayLevel < OVERLAY_LEVELS; overlayLevel++)
+            overlayCells += overlay->numCells[overlayLevel];
+
+        overlayCustomize(overlay, generatedGraph, OVERLAY_THREADS);
+        double overlayFirstTime = overlay->customizeTime;
+
+        // Halve the first path of node '0' (both directions), then customize again.
+        overlayStart = generatedGraph->targets[generatedGraph->rowStart[0]];
+        overlayWeight = generatedGraph->weights[generatedGraph->rowStart[0]];
+
+        for (edge = generatedGraph->rowStart[0]; edge < generatedGraph->rowStart[1]; edge++)
+            if (generatedGraph->targets[edge] == overlayStart)
+                generatedGraph->weights[edge] = overlayWeight / 2 + 1;
+
+        for (edge = generatedGraph->rowStart[overlayStart]; edge < generatedGraph->rowStart[overlayStart + 1]; edge++)
+            if (generatedGraph->targets[edge] == 0)
+                generatedGraph->weights[edge] = overlayWeight / 2 + 1;
+
+        int overlayCustomized = overlayCustomize(overlay, generatedGraph, OVERLAY_THREADS);
+        overlayMismatches = 0;
+
+        for (query = 0; query < 200; query++)
+        {
+            int startId = (query * 7919) % generatedGraph->numNodes;
+            int endId = (query * 104729 + 1) % generatedGraph->numNodes;
+
+            searchShortestPath(generatedDijkstra, startId, endId);
+
+            if (overlayShortestPath(overlaySearch, startId, endId) != searchDistance(generatedDijkstra, endId))
+                overlayMismatches++;
+        }
+
+        overlayReport(overlay);
+        printf("%s: A changed path customized %d of %d cells in %.3fms against %.3fms for every cell (%d distances differ).\n",
+               overlayMismatches == 0 && overlayCustomized < overlayCells ? "Success" : "Failure", overlayCustomized,
+               overlayCells, overlay->customizeTime * 1000, overlayFirstTime * 1000, overlayMismatches);
+
+        searchDestructor(generatedDijkstra);
+        overlaySearchDestructor(overlaySearch);
+        overlayDestructor(overlay);
+        graphDestructor(generatedGraph);
+
+        // Testing snapshots, a reader pinned before a change keeps searching the version it pinned.
+        printf("\nTesting 'snapshotAcquire' function:\n");
+        struct VersionedNetwork* versioned = versionedConstructor(cityNetwork);
+        struct Snapshot* pinned = snapshotAcquire(versioned);
+
+        struct Network* writing = versionedWriteBegin(versioned);                                     // Publish a new city.
+        addCity(writing, "Coventry");
+        addPath(writing, "Coventry", "York", 10);
+        versionedWriteEnd(versioned);
+
+        struct Snapshot* latest = snapshotAcquire(versioned);
+        struct Search* latestSearch = searchConstructor(latest->graph);
+        searchShortestPath(latestSearch, graphCityIndex(latest->graph, "Edinburgh"), graphCityIndex(latest->graph, "Coventry"));
+
+        printf("%s: Coventry is %s in version %d (pinned) and %dkm from Edinburgh in version %d (%d retired).\n",
+               graphCityIndex(pinned->graph, "Coventry") < 0 && graphCityIndex(latest->graph, "Coventry") >= 0 ? "Success" : "Failure",
+               graphCityIndex(pinned->graph, "Coventry") < 0 ? "absent" : "present", pinned->version,
+               searchDistance(latestSearch, graphCityIndex(latest->graph, "Coventry")), latest->version,
+               versionedRetiredCount(versioned));
+
+        searchDestructor(latestSearch);
+        snapshotRelease(versioned, latest);
+        snapshotRelease(versioned, pinned);                                                            // Frees the retired version.
+
+        removeCity(versionedWriteBegin(versioned), "Coventry");
+        versionedWriteEnd(versioned);
+        versionedDestructor(versioned);
+
         printf("\n*** TESTING ERROR FLAGS - COMPLETE ***\n");
 
 
@@ -251,7 +1020,26 @@ int main(void)
         // Print complete network.
         displayNetwork(cityNetwork);
 
-        for (i = 0; i < dijkstrapairs_lines; i++)
+        // Run the pairs through the staged pipeline (see 'pipeline.h'), so that reading, searching and writing overlap.
+        FILE* dijkstraids_file = (PIPELINE_ENABLED == 1 && PIPELINE_IDS == 1) ? tmpfile() : NULL;
+
+        if (dijkstraids_file != NULL)
+        {
+            // Resolve every city name once (timed with the searches), the workers then only see node ids.
+            double resolveStart = timerNow();
+            handlesWritePairs(dijkstrapairs_file, dijkstraids_file, cityNetwork);
+            rewind(dijkstraids_file);
+            dijkstraTotalTime = dijkstraTotalTime + (timerNow() - resolveStart);
+
+            dijkstraPipelineIds(dijkstraids_file, dijkstraresults_file, cityNetwork, PIPELINE_WORKERS, &dijkstraTotalTime);
+            fclose(dijkstraids_file);
+        }
+
+        // Also used if the node id file could not be created.
+        else if (PIPELINE_ENABLED == 1)
+            dijkstraPipeline(dijkstrapairs_file, dijkstraresults_file, cityNetwork, PIPELINE_WORKERS, &dijkstraTotalTime);
+
+        else for (i = 0; i < dijkstrapairs_lines; i++)
         {
             // Scan each line of 'dijkstrapairs.txt' to dijkstraPairs array.
             while (2 == fscanf(dijkstrapairs_file, " %s %s", dijkstraPairs[i].cityStartName, dijkstraPairs[i].cityEndName))
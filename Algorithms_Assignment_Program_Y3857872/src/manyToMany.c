@@ -0,0 +1,464 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    manyToMany.c:
+        - Source file defining the functions to fill a distance table between many source and many
+            target cities on a contraction hierarchy (bucket based many-to-many).
+        - Two phases, each spread across threads claiming work from a shared counter:
+            - Backward  -> An upward search from each target, every settled node gets a bucket entry
+                            (target, distance). Entries are gathered per thread, then sorted into one
+                            bucket per node with a counting pass.
+            - Forward   -> An upward search from each source, the buckets of every settled node give
+                            candidate distances to their targets. Each source writes only its own row.
+        - Core nodes (left uncontracted by the hierarchy) only get bucket entries where a target's
+            search first reaches the core, the target searches do not expand them. Each source's search
+            carries on through the core instead (Dijkstra's algorithm over the core edges), reaching
+            the core entries of every target.
+        - Upward searches use stall on demand like hierarchyShortestPath(): a node reached more cheaply
+            through a higher neighbour is neither expanded nor given a bucket entry.
+
+        - Functions:
+            - tableUpwardSearch
+            - tableWorkerThread
+            - tableRunPhase
+            - tableConstructor
+            - tableDestructor
+            - tableDistance
+            - tableReport
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Include respective header file:
+#include "table.h"
+
+// Thread and atomic libraries:
+#include <pthread.h>
+#include <stdatomic.h>
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            TABLE STRUCTURES
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    TableBuild Structure:
+        - Shared state while filling a table.
+
+        hierarchy       - Hierarchy searched.
+        table           - Table filled.
+        phase           - '0' for the backward (target) searches, '1' for the forward (source) searches.
+        nextTask        - Next unclaimed target or source index of the current phase.
+        bucketStart     - Index of the first bucket entry of each node (numNodes + 1 entries).
+        bucketTarget    - Target index of each bucket entry.
+        bucketDistance  - Upward distance from the node to the target of each bucket entry.
+*/
+struct TableBuild
+{
+    struct Hierarchy* hierarchy;
+    struct DistanceTable* table;
+
+    int phase;
+    atomic_int nextTask;
+
+    int* bucketStart;
+    int* bucketTarget;
+    int* bucketDistance;
+};
+
+/*
+    TableWorker Structure:
+        - Per-thread search workspace and backward phase entries.
+
+        build           - Shared state.
+        thread          - POSIX thread handle (unused for thread '0').
+        epoch           - Current search number, distances are only valid when stamped with it.
+        stamp           - Search number each node was last reached in.
+        distance        - Tentative upward distance of each node.
+        heap            - Indexed priority queue of reached nodes.
+        settled         - Nodes settled (and not stalled) by the last search.
+        numSettled      - Number of settled nodes.
+        numEntries      - Number of bucket entries found by this thread.
+        entryCapacity   - Capacity of the entry arrays.
+        entryNode       - Node of each entry.
+        entryTarget     - Target index of each entry.
+        entryDistance   - Distance of each entry.
+*/
+struct TableWorker
+{
+    struct TableBuild* build;
+    pthread_t thread;
+
+    int epoch;
+    int* stamp;
+    int* distance;
+    struct Heap* heap;
+    int* settled;
+    int numSettled;
+
+    int numEntries;
+    int entryCapacity;
+    int* entryNode;
+    int* entryTarget;
+    int* entryDistance;
+};
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            TABLE SEARCH FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Table Upward Search:
+        - Settles every node reachable over upward edges from a given node id, listing the nodes that
+            were not stalled in the worker's 'settled' array.
+        - Core nodes are settled but only expanded (over the core edges) when asked for.
+*/
+static void tableUpwardSearch(struct Hierarchy* hierarchy, struct TableWorker* worker, int startId, int expandCore)
+{
+    int coreRank = hierarchy->numNodes - hierarchy->numCore;
+    int currentDistance, edge;
+
+    worker->epoch++;
+    worker->numSettled = 0;
+    worker->stamp[startId] = worker->epoch;
+    worker->distance[startId] = 0;
+    heapClear(worker->heap);
+    heapPush(worker->heap, startId, 0);
+
+    while (heapIsEmpty(worker->heap) == 0)
+    {
+        int current = heapPop(worker->heap, &currentDistance);
+        int isCore = (hierarchy->rank[current] >= coreRank);
+        int stalled = 0;
+
+        // Stall on demand: a higher neighbour already reached gives a shorter way down to this node.
+        // Core edges run both ways, so when the core is expanded a shorter way was already relaxed.
+        for (edge = hierarchy->rowStart[current]; edge < hierarchy->rowStart[current + 1] && stalled == 0
+                                                  && (isCore == 0 || expandCore == 0); edge++)
+        {
+            int target = hierarchy->targets[edge];
+
+            if (worker->stamp[target] == worker->epoch && worker->distance[target] + hierarchy->weights[edge] < currentDistance)
+                stalled = 1;
+        }
+
+        if (stalled == 1)
+            continue;
+
+        worker->settled[worker->numSettled++] = current;
+
+        if (isCore == 1 && expandCore == 0)
+            continue;
+
+        for (edge = hierarchy->rowStart[current]; edge < hierarchy->rowStart[current + 1]; edge++)
+        {
+            int target = hierarchy->targets[edge];
+            int newDistance = currentDistance + hierarchy->weights[edge];
+
+            if (worker->stamp[target] != worker->epoch || newDistance < worker->distance[target])
+            {
+                worker->stamp[target] = worker->epoch;
+                worker->distance[target] = newDistance;
+                heapPush(worker->heap, target, newDistance);
+            }
+        }
+    }
+}
+
+/*
+    Table Worker Thread:
+        - Claims targets (backward phase) or sources (forward phase) until none are left.
+*/
+static void* tableWorkerThread(void* argument)
+{
+    struct TableWorker* worker = argument;
+    struct TableBuild* build = worker->build;
+    struct DistanceTable* table = build->table;
+    int task, index, entry;
+
+    if (build->phase == 0)
+    {
+        // Leave a bucket entry at every node the target's search settles.
+        while ((task = atomic_fetch_add(&build->nextTask, 1)) < table->numTargets)
+        {
+            tableUpwardSearch(build->hierarchy, worker, table->targets[task], 0);
+
+            if (worker->numEntries + worker->numSettled > worker->entryCapacity)
+            {
+                while (worker->numEntries + worker->numSettled > worker->entryCapacity)
+                    worker->entryCapacity *= 2;
+
+                worker->entryNode = realloc(worker->entryNode, worker->entryCapacity * sizeof(int));
+                worker->entryTarget = realloc(worker->entryTarget, worker->entryCapacity * sizeof(int));
+                worker->entryDistance = realloc(worker->entryDistance, worker->entryCapacity * sizeof(int));
+            }
+
+            for (index = 0; index < worker->numSettled; index++)
+            {
+                worker->entryNode[worker->numEntries] = worker->settled[index];
+                worker->entryTarget[worker->numEntries] = task;
+                worker->entryDistance[worker->numEntries] = worker->distance[worker->settled[index]];
+                worker->numEntries++;
+            }
+        }
+    }
+    else
+    {
+        // Read the buckets of every node the source's search settles.
+        while ((task = atomic_fetch_add(&build->nextTask, 1)) < table->numSources)
+        {
+            int* row = &table->distances[(long long) task * table->numTargets];
+
+            for (index = 0; index < table->numTargets; index++)
+                row[index] = INT_MAX;
+
+            tableUpwardSearch(build->hierarchy, worker, table->sources[task], 1);
+
+            for (index = 0; index < worker->numSettled; index++)
+            {
+                int node = worker->settled[index];
+                int nodeDistance = worker->distance[node];
+
+                for (entry = build->bucketStart[node]; entry < build->bucketStart[node + 1]; entry++)
+                    if (nodeDistance + build->bucketDistance[entry] < row[build->bucketTarget[entry]])
+                        row[build->bucketTarget[entry]] = nodeDistance + build->bucketDistance[entry];
+            }
+        }
+    }
+
+    return NULL;
+}
+
+/*
+    Table Run Phase:
+        - Runs one phase across the given workers (worker '0' on the calling thread).
+*/
+static void tableRunPhase(struct TableBuild* build, struct TableWorker* workers, int numThreads, int phase)
+{
+    int index;
+
+    build->phase = phase;
+    atomic_store(&build->nextTask, 0);
+
+    for (index = 1; index < numThreads; index++)
+        pthread_create(&workers[index].thread, NULL, tableWorkerThread, &workers[index]);
+
+    tableWorkerThread(&workers[0]);
+
+    for (index = 1; index < numThreads; index++)
+        pthread_join(workers[index].thread, NULL);
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        TABLE CONSTRUCTORS/DESTRUCTORS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Table Constructor:
+        - Fills the distance table between every source and every target node id of a hierarchy
+            (see top of file), across a given number of threads.
+        - Flags an error if either set is empty or holds an invalid id.
+        - Returns pointer to new table, or NULL on failure.
+*/
+struct DistanceTable* tableConstructor(struct Hierarchy* hierarchy, int* sourceIds, int numSources, int* targetIds,
+                                      int numTargets, int numThreads)
+{
+    double timeStart = timerNow();
+    int numNodes = hierarchy->numNodes;
+    int index, entry;
+
+    if (numSources <= 0 || numTargets <= 0)
+    {
+        printf("Failure: Table must have at least 1 source and 1 target! - (tableConstructor - manyToMany.c)\n");
+        return NULL;
+    }
+
+    for (index = 0; index < numSources + numTargets; index++)
+    {
+        int id = (index < numSources) ? sourceIds[index] : targetIds[index - numSources];
+
+        if (id < 0 || id >= numNodes)
+        {
+            printf("Failure: %d = Invalid node id! - (tableConstructor - manyToMany.c)\n", id);
+            return NULL;
+        }
+    }
+
+    if (numThreads < 1)
+        numThreads = 1;
+
+    struct DistanceTable* table = malloc(sizeof(struct DistanceTable));
+    table->numSources = numSources;
+    table->numTargets = numTargets;
+    table->sources = malloc(numSources * sizeof(int));
+    table->targets = malloc(numTargets * sizeof(int));
+    table->distances = malloc((long long) numSources * numTargets * sizeof(int));
+    memcpy(table->sources, sourceIds, numSources * sizeof(int));
+    memcpy(table->targets, targetIds, numTargets * sizeof(int));
+
+    struct TableBuild build;
+    build.hierarchy = hierarchy;
+    build.table = table;
+
+    struct TableWorker* workers = malloc(numThreads * sizeof(struct TableWorker));
+
+    for (index = 0; index < numThreads; index++)
+    {
+        workers[index].build = &build;
+        workers[index].epoch = 0;
+        workers[index].stamp = calloc(numNodes, sizeof(int));
+        workers[index].distance = malloc(numNodes * sizeof(int));
+        workers[index].heap = heapConstructor(numNodes);
+        workers[index].settled = malloc(numNodes * sizeof(int));
+        workers[index].numSettled = 0;
+        workers[index].numEntries = 0;
+        workers[index].entryCapacity = 1024;
+        workers[index].entryNode = malloc(workers[index].entryCapacity * sizeof(int));
+        workers[index].entryTarget = malloc(workers[index].entryCapacity * sizeof(int));
+        workers[index].entryDistance = malloc(workers[index].entryCapacity * sizeof(int));
+    }
+
+    // Backward phase, then gather the entries into one bucket per node.
+    tableRunPhase(&build, workers, numThreads, 0);
+
+    table->numEntries = 0;
+    build.bucketStart = calloc(numNodes + 1, sizeof(int));
+
+    for (index = 0; index < numThreads; index++)
+    {
+        table->numEntries += workers[index].numEntries;
+
+        for (entry = 0; entry < workers[index].numEntries; entry++)
+            build.bucketStart[workers[index].entryNode[entry] + 1]++;
+    }
+
+    for (index = 0; index < numNodes; index++)
+        build.bucketStart[index + 1] += build.bucketStart[index];
+
+    int* fill = malloc((numNodes > 0 ? numNodes : 1) * sizeof(int));
+    memcpy(fill, build.bucketStart, numNodes * sizeof(int));
+
+    build.bucketTarget = malloc((table->numEntries > 0 ? table->numEntries : 1) * sizeof(int));
+    build.bucketDistance = malloc((table->numEntries > 0 ? table->numEntries : 1) * sizeof(int));
+
+    for (index = 0; index < numThreads; index++)
+    {
+        for (entry = 0; entry < workers[index].numEntries; entry++)
+        {
+            int slot = fill[workers[index].entryNode[entry]]++;
+
+            build.bucketTarget[slot] = workers[index].entryTarget[entry];
+            build.bucketDistance[slot] = workers[index].entryDistance[entry];
+        }
+
+        free(workers[index].entryNode);
+        free(workers[index].entryTarget);
+        free(workers[index].entryDistance);
+    }
+
+    free(fill);
+    table->bucketTime = timerNow() - timeStart;
+
+    // Forward phase, each source fills its own row.
+    tableRunPhase(&build, workers, numThreads, 1);
+
+    for (index = 0; index < numThreads; index++)
+    {
+        free(workers[index].stamp);
+        free(workers[index].distance);
+        heapDestructor(workers[index].heap);
+        free(workers[index].settled);
+    }
+
+    free(workers);
+    free(build.bucketStart);
+    free(build.bucketTarget);
+    free(build.bucketDistance);
+
+    table->buildTime = timerNow() - timeStart;
+
+    // Return new table.
+    return table;
+}
+
+/*
+    Table Destructor:
+        - Free memory associated with a distance table.
+*/
+void tableDestructor(struct DistanceTable* table)
+{
+    if (table == NULL)
+        return;
+
+    free(table->sources);
+    free(table->targets);
+    free(table->distances);
+    free(table);
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            TABLE QUERY FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Table Distance:
+        - Returns the shortest distance from a source index to a target index of a table.
+        - Returns 'INT_MAX' if unreachable or an index is invalid.
+*/
+int tableDistance(struct DistanceTable* table, int sourceIndex, int targetIndex)
+{
+    if (sourceIndex < 0 || sourceIndex >= table->numSources || targetIndex < 0 || targetIndex >= table->numTargets)
+    {
+        printf("Failure: Invalid table index! - (tableDistance - manyToMany.c)\n");
+        return INT_MAX;
+    }
+
+    return table->distances[(long long) sourceIndex * table->numTargets + targetIndex];
+}
+
+/*
+    Table Report:
+        - Runs Dijkstra's algorithm one-to-all from every source of a table on the graph the hierarchy
+            was built from, printing its time against the table's.
+        - Returns the number of table distances that differ from Dijkstra's algorithm ('-1' if the graph
+            is too small for the table's ids).
+*/
+int tableReport(struct DistanceTable* table, struct Search* search)
+{
+    int numMismatches = 0;
+    int source, target;
+
+    for (source = 0; source < table->numSources + table->numTargets; source++)
+    {
+        int id = (source < table->numSources) ? table->sources[source] : table->targets[source - table->numSources];
+
+        if (id >= search->graph->numNodes)
+        {
+            printf("Failure: Table was built for a different graph! - (tableReport - manyToMany.c)\n");
+            return -1;
+        }
+    }
+
+    double timeStart = timerNow();
+
+    for (source = 0; source < table->numSources; source++)
+    {
+        searchShortestPath(search, table->sources[source], -1);
+
+        for (target = 0; target < table->numTargets; target++)
+            if (searchDistance(search, table->targets[target]) != table->distances[(long long) source * table->numTargets + target])
+                numMismatches++;
+    }
+
+    double dijkstraTime = timerNow() - timeStart;
+
+    printf("\nDISTANCE TABLE - (%d sources x %d targets, %lld bucket entries)\n", table->numSources, table->numTargets,
+           table->numEntries);
+    printf("\tBuckets  : %10.3fms\n", table->bucketTime * 1e3);
+    printf("\tTable    : %10.3fms\n", table->buildTime * 1e3);
+    printf("\tDijkstra : %10.3fms (one-to-all per source, single thread)\n", dijkstraTime * 1e3);
+
+    return numMismatches;
+}
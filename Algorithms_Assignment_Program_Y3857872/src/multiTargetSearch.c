@@ -0,0 +1,251 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    multiTargetSearch.c:
+        - Source file defining the functions to find the shortest paths from one start city to many end
+            cities (targets) with a single run of Dijkstra's algorithm.
+        - The search settles cities closest first and stops once the last target is settled, instead of
+            one search per target each settling the cities closer than it again.
+        - Targets within another component than the start (when the workspace has component labels,
+            see networkSearch()) are unreachable and never waited for.
+
+        - Functions:
+            - targetsCompareIds
+            - searchOneToMany
+            - oneToMany
+            - targetsDestructor
+            - displayTargets
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Include respective header file:
+#include "targets.h"
+
+// Edge relaxation kernels:
+#include "relax.h"
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            TARGETS SEARCH FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Targets Compare Ids:
+        - qsort() and bsearch() comparison of two node ids, lowest first.
+*/
+static int targetsCompareIds(const void* id1, const void* id2)
+{
+    return (*(const int*) id1 > *(const int*) id2) - (*(const int*) id1 < *(const int*) id2);
+}
+
+/*
+    Search One To Many:
+        - Runs Dijkstra's algorithm from a start node id until every given end node id is settled (or
+            every reachable node is settled), skipping blocked edges and nodes of the workspace.
+        - End ids of '-1' are kept as unreachable targets (cities that were not found).
+        - Returns the distance and path to every target, or 'NULL' if the start id is invalid.
+*/
+struct Targets* searchOneToMany(struct Search* search, int startId, int* endIds, int numTargets)
+{
+    struct Graph* graph = search->graph;
+    int numPending = 0, remaining;
+    int currentDistance;
+    int index;
+
+    if (startId < 0 || startId >= graph->numNodes || numTargets < 0)
+        return NULL;
+
+    // Sorted distinct targets the search has to settle.
+    int* pending = malloc((numTargets > 0 ? numTargets : 1) * sizeof(int));
+
+    for (index = 0; index < numTargets; index++)
+    {
+        int endId = endIds[index];
+
+        if (endId < 0 || endId >= graph->numNodes)
+            continue;
+
+        if (search->component != NULL && search->component[endId] != search->component[startId])
+            continue;
+
+        pending[numPending++] = endId;
+    }
+
+    qsort(pending, numPending, sizeof(int), targetsCompareIds);
+
+    remaining = 0;
+
+    for (index = 0; index < numPending; index++)
+        if (index == 0 || pending[index] != pending[index - 1])
+            pending[remaining++] = pending[index];
+
+    numPending = remaining;
+
+    struct Targets* targets = malloc(sizeof(struct Targets));
+    targets->graph = graph;
+    targets->start = startId;
+    targets->count = numTargets;
+    targets->radius = 0;
+
+    // Settle closest first until the last target is settled.
+    searchReset(search, startId);
+
+    while (remaining > 0 && heapIsEmpty(search->heap) == 0)
+    {
+        int currentCity = heapPop(search->heap, &currentDistance);
+
+        search->settledStamp[currentCity] = search->epoch;
+        search->settledCount++;
+        targets->radius = currentDistance;
+
+        if (bsearch(&currentCity, pending, numPending, sizeof(int), targetsCompareIds) != NULL)
+            remaining--;
+
+        if (remaining > 0)
+            relaxRow(search, currentCity, currentDistance);
+    }
+
+    free(pending);
+
+    targets->settledCount = search->settledCount;
+
+    // Record each target's distance and path.
+    targets->nodes = malloc((numTargets > 0 ? numTargets : 1) * sizeof(int));
+    targets->distances = malloc((numTargets > 0 ? numTargets : 1) * sizeof(int));
+    targets->pathStart = malloc((numTargets + 1) * sizeof(int));
+    targets->numReached = 0;
+    targets->pathStart[0] = 0;
+
+    for (index = 0; index < numTargets; index++)
+    {
+        int endId = (endIds[index] >= 0 && endIds[index] < graph->numNodes) ? endIds[index] : -1;
+        int isReached = (endId >= 0 && searchIsSettled(search, endId) == 1);
+
+        targets->nodes[index] = endId;
+        targets->distances[index] = isReached ? search->distance[endId] : INT_MAX;
+        targets->pathStart[index + 1] = targets->pathStart[index] + (isReached ? searchPath(search, endId, NULL) : 0);
+        targets->numReached += isReached;
+    }
+
+    int numPathNodes = targets->pathStart[numTargets];
+
+    targets->pathNodes = malloc((numPathNodes > 0 ? numPathNodes : 1) * sizeof(int));
+    targets->pathDistances = malloc((numPathNodes > 0 ? numPathNodes : 1) * sizeof(int));
+
+    for (index = 0; index < numTargets; index++)
+        if (targets->distances[index] != INT_MAX)
+            searchPath(search, targets->nodes[index], &targets->pathNodes[targets->pathStart[index]]);
+
+    for (index = 0; index < numPathNodes; index++)
+        targets->pathDistances[index] = search->distance[targets->pathNodes[index]];
+
+    return targets;
+}
+
+/*
+    One To Many:
+        - Finds the shortest paths from a given city name to every given end city name with one search.
+        - Uses the network's frozen graph and search workspace, the network itself is not changed.
+        - Flags an error if the start city isn't present within the network, and for each end city
+            that isn't (kept as an unreachable target).
+        - Returns the targets found, or NULL on failure.
+*/
+struct Targets* oneToMany(struct Network* cityNetwork, const char* cityStartName, char cityEndNames[][127], int numTargets)
+{
+    struct Search* search = networkSearch(cityNetwork);
+    int index;
+
+    // Find city ids.
+    int cityStartId = graphCityIndex(search->graph, cityStartName);
+
+    // Error flagging system:
+
+    if (cityStartId < 0)
+    {
+        printf("Failure: City '%s' not found in network! - (oneToMany - multiTargetSearch.c)\n", cityStartName);
+        return NULL;
+    }
+    else if (numTargets <= 0)
+    {
+        printf("Failure: Number of end cities must be greater than 0! - (oneToMany - multiTargetSearch.c)\n");
+        return NULL;
+    }
+
+    int* cityEndIds = malloc(numTargets * sizeof(int));
+
+    for (index = 0; index < numTargets; index++)
+    {
+        cityEndIds[index] = graphCityIndex(search->graph, cityEndNames[index]);
+
+        if (cityEndIds[index] < 0)
+            printf("Failure: City '%s' not found in network! - (oneToMany - multiTargetSearch.c)\n", cityEndNames[index]);
+    }
+
+    struct Targets* targets = searchOneToMany(search, cityStartId, cityEndIds, numTargets);
+    free(cityEndIds);
+
+    return targets;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                    TARGETS DESTRUCTORS/DISPLAY FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Targets Destructor:
+        - Free memory associated with a set of targets.
+*/
+void targetsDestructor(struct Targets* targets)
+{
+    if (targets == NULL)
+        return;
+
+    free(targets->nodes);
+    free(targets->distances);
+    free(targets->pathStart);
+    free(targets->pathNodes);
+    free(targets->pathDistances);
+    free(targets);
+}
+
+/*
+    Display Targets:
+        - Prints the path to every target in the same path format as dijkstra(), then how far the
+            search had to go.
+*/
+void displayTargets(struct Targets* targets)
+{
+    int index, city;
+
+    if (targets == NULL)
+    {
+        printf("\tNo targets searched!\n");
+        return;
+    }
+
+    for (index = 0; index < targets->count; index++)
+    {
+        if (targets->distances[index] == INT_MAX)
+        {
+            printf("\tTarget %d: Path not found! - Cities are unreachable.\n", index + 1);
+            continue;
+        }
+
+        printf("\tTarget %d: [ ", index + 1);
+
+        for (city = targets->pathStart[index]; city < targets->pathStart[index + 1]; city++)
+        {
+            // Print edge distance between cities.
+            if (city > targets->pathStart[index])
+                printf(" -(%dkm)-> ", targets->pathDistances[city] - targets->pathDistances[city - 1]);
+
+            printf("%s", graphCityName(targets->graph, targets->pathNodes[city]));
+        }
+
+        printf(" ] - %dkm\n", targets->distances[index]);
+    }
+
+    printf("\t%d of %d targets reached, %d of %d cities settled out to %dkm.\n", targets->numReached, targets->count,
+           targets->settledCount, targets->graph->numNodes, targets->radius);
+}
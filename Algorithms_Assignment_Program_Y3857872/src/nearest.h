@@ -0,0 +1,113 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    nearest.h:
+        - Header file for the 'nearestSearch.c' source file.
+        - Defines the public functions to find the k closest cities to one or more start cities, and to
+            label every city with its nearest facility (Voronoi regions) with a single search.
+        - Contains the 'Nearest' and 'Voronoi' structures.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+#ifndef NEAREST_H_INCLUDED
+#define NEAREST_H_INCLUDED
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        NEAREST LIBRARIES/DEFINITIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// User Created Network Library:
+#include "network.h"
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        PUBLIC NEAREST STRUCTURES
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Nearest Structure:
+        - The closest cities to a set of start cities, closest first. The start cities themselves are
+            not counted, every other city is measured from whichever start city is closest to it.
+        - Fewer than 'k' cities are found when fewer are reachable.
+
+        graph           - Graph the cities were searched on (used to print city names).
+        k               - Number of cities asked for.
+        count           - Number of cities found (at most 'k').
+        nodes           - Node id of each city found, closest first.
+        distances       - Distance of each city found from the closest start city.
+        settledCount    - Number of nodes settled by the search (start cities included).
+*/
+struct Nearest
+{
+    struct Graph* graph;
+
+    int k;
+    int count;
+    int* nodes;
+    int* distances;
+
+    int settledCount;
+};
+
+/*
+    Voronoi Structure:
+        - Every facility is seeded at distance '0' within the same search, so each city is settled once
+            by whichever facility reaches it first: its nearest facility. A city inherits the facility
+            of the city it was reached from, so no extra state is carried through the heap.
+        - Ties between facilities go to whichever reaches the city first.
+
+        graph           - Graph the regions were searched on (used to print city names).
+        numFacilities   - Number of facilities.
+        facilities      - Node id of each facility ('-1' if the city was not found).
+        owner           - Index of the nearest facility of each node id ('-1' if unreachable).
+        distances       - Distance of each node id from its nearest facility ('INT_MAX' if unreachable).
+        regionSize      - Number of node ids (itself included) owned by each facility.
+        regionRadius    - Distance of the furthest node id owned by each facility.
+        settledCount    - Number of nodes settled by the search.
+*/
+struct Voronoi
+{
+    struct Graph* graph;
+
+    int numFacilities;
+    int* facilities;
+
+    int* owner;
+    int* distances;
+
+    int* regionSize;
+    int* regionRadius;
+    int settledCount;
+};
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                    PUBLIC NEAREST FUNCTION DECLARATIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Finds the k closest cities to a city present within a network.
+struct Nearest* nearestCities(struct Network* cityNetwork, const char* cityStartName, int k);
+
+// Finds the k closest node ids to any of a set of start node ids using a given search workspace.
+struct Nearest* searchNearest(struct Search* search, int* startIds, int numStarts, int k);
+
+// Labels every city of a network with its nearest facility city.
+struct Voronoi* nearestFacilities(struct Network* cityNetwork, char facilityNames[][127], int numFacilities);
+
+// Labels every node id with its nearest facility node id using a given search workspace.
+struct Voronoi* searchVoronoi(struct Search* search, int* facilityIds, int numFacilities);
+
+// Frees memory associated with a given set of nearest cities.
+void nearestDestructor(struct Nearest* nearest);
+
+// Frees memory associated with given Voronoi regions.
+void voronoiDestructor(struct Voronoi* voronoi);
+
+// Displays the nearest cities with their distances.
+void displayNearest(struct Nearest* nearest);
+
+// Displays the size and radius of every facility's region.
+void displayVoronoi(struct Voronoi* voronoi);
+
+#endif // NEAREST_H_INCLUDED
@@ -0,0 +1,332 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    nearestSearch.c:
+        - Source file defining the functions to answer facility location queries with Dijkstra's algorithm.
+        - Nearest cities: settles cities closest first from one or more start cities and stops after the
+            k-th city is settled, so the cost depends on k rather than the size of the network.
+        - Voronoi regions: seeds every facility at distance '0' within one search and labels each city
+            with the facility it is settled from, one pass over the graph rather than a search per facility.
+
+        - Functions:
+            - nearestSeed
+            - searchNearest
+            - nearestCities
+            - searchVoronoi
+            - nearestFacilities
+            - nearestDestructor
+            - voronoiDestructor
+            - displayNearest
+            - displayVoronoi
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Include respective header file:
+#include "nearest.h"
+
+// Edge relaxation kernels:
+#include "relax.h"
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            NEAREST SEARCH FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Nearest Seed:
+        - Starts a new search with every valid node id of a set queued at distance '0' (duplicate and
+            '-1' ids are skipped), each being the start of its own shortest path tree.
+        - Returns the number of node ids seeded.
+*/
+static int nearestSeed(struct Search* search, int* startIds, int numStarts)
+{
+    int numSeeded = 0;
+    int index;
+
+    searchReset(search, -1);
+
+    for (index = 0; index < numStarts; index++)
+    {
+        int startId = startIds[index];
+
+        if (startId < 0 || startId >= search->graph->numNodes || search->stamp[startId] == search->epoch)
+            continue;
+
+        search->stamp[startId] = search->epoch;
+        search->distance[startId] = 0;
+        search->back[startId] = -1;
+        heapPush(search->heap, startId, 0);
+        numSeeded++;
+    }
+
+    if (numSeeded > 0)
+        search->start = startIds[0];
+
+    return numSeeded;
+}
+
+/*
+    Search Nearest:
+        - Runs Dijkstra's algorithm from every given start node id at once, stopping after 'k' other
+            node ids are settled. Blocked edges and nodes of the workspace are skipped.
+        - Paths to the cities found can be read back with searchPath() until the workspace is reused.
+        - Returns the nearest cities, or 'NULL' if no start id is valid or 'k' is negative.
+*/
+struct Nearest* searchNearest(struct Search* search, int* startIds, int numStarts, int k)
+{
+    int currentDistance;
+
+    if (k < 0 || nearestSeed(search, startIds, numStarts) == 0)
+        return NULL;
+
+    struct Nearest* nearest = malloc(sizeof(struct Nearest));
+    nearest->graph = search->graph;
+    nearest->k = k;
+    nearest->count = 0;
+    nearest->nodes = malloc((k > 0 ? k : 1) * sizeof(int));
+    nearest->distances = malloc((k > 0 ? k : 1) * sizeof(int));
+
+    // Settle closest first until k cities (other than the start cities) are settled.
+    while (nearest->count < k && heapIsEmpty(search->heap) == 0)
+    {
+        int currentCity = heapPop(search->heap, &currentDistance);
+
+        search->settledStamp[currentCity] = search->epoch;
+        search->settledCount++;
+
+        if (search->back[currentCity] != -1)
+        {
+            nearest->nodes[nearest->count] = currentCity;
+            nearest->distances[nearest->count] = currentDistance;
+            nearest->count++;
+        }
+
+        if (nearest->count < k)
+            relaxRow(search, currentCity, currentDistance);
+    }
+
+    nearest->settledCount = search->settledCount;
+
+    return nearest;
+}
+
+/*
+    Nearest Cities:
+        - Finds the 'k' closest cities to a given city name, closest first.
+        - Uses the network's frozen graph and search workspace, the network itself is not changed.
+        - Flags an error if the city isn't present within the network or 'k' is negative.
+        - Returns the cities found, or NULL on failure.
+*/
+struct Nearest* nearestCities(struct Network* cityNetwork, const char* cityStartName, int k)
+{
+    struct Search* search = networkSearch(cityNetwork);
+
+    // Find city id.
+    int cityStartId = graphCityIndex(search->graph, cityStartName);
+
+    // Error flagging system:
+
+    if (cityStartId < 0)
+    {
+        printf("Failure: City '%s' not found in network! - (nearestCities - nearestSearch.c)\n", cityStartName);
+        return NULL;
+    }
+    else if (k < 0)
+    {
+        printf("Failure: Number of cities must not be negative! - (nearestCities - nearestSearch.c)\n");
+        return NULL;
+    }
+
+    return searchNearest(search, &cityStartId, 1, k);
+}
+
+/*
+    Search Voronoi:
+        - Runs Dijkstra's algorithm from every given facility node id at once until every reachable
+            node id is settled, labelling each with the facility whose shortest path tree it joins.
+        - Facility ids of '-1' are kept as facilities owning no node ids (cities that were not found).
+        - Returns the regions, or 'NULL' if no facility id is valid.
+*/
+struct Voronoi* searchVoronoi(struct Search* search, int* facilityIds, int numFacilities)
+{
+    struct Graph* graph = search->graph;
+    int currentDistance;
+    int index;
+
+    if (numFacilities <= 0 || nearestSeed(search, facilityIds, numFacilities) == 0)
+        return NULL;
+
+    struct Voronoi* voronoi = malloc(sizeof(struct Voronoi));
+    voronoi->graph = graph;
+    voronoi->numFacilities = numFacilities;
+    voronoi->facilities = malloc(numFacilities * sizeof(int));
+    voronoi->owner = malloc((graph->numNodes > 0 ? graph->numNodes : 1) * sizeof(int));
+    voronoi->distances = malloc((graph->numNodes > 0 ? graph->numNodes : 1) * sizeof(int));
+    voronoi->regionSize = calloc(numFacilities, sizeof(int));
+    voronoi->regionRadius = calloc(numFacilities, sizeof(int));
+
+    for (index = 0; index < graph->numNodes; index++)
+    {
+        voronoi->owner[index] = -1;
+        voronoi->distances[index] = INT_MAX;
+    }
+
+    // A facility listed twice is owned by its first listing.
+    for (index = 0; index < numFacilities; index++)
+    {
+        int facilityId = facilityIds[index];
+
+        voronoi->facilities[index] = (facilityId >= 0 && facilityId < graph->numNodes) ? facilityId : -1;
+
+        if (voronoi->facilities[index] >= 0 && voronoi->owner[facilityId] == -1)
+            voronoi->owner[facilityId] = index;
+    }
+
+    // Settle every reachable city, each taking the facility of the city it was reached from.
+    while (heapIsEmpty(search->heap) == 0)
+    {
+        int currentCity = heapPop(search->heap, &currentDistance);
+        int owner;
+
+        search->settledStamp[currentCity] = search->epoch;
+        search->settledCount++;
+
+        if (search->back[currentCity] != -1)
+            voronoi->owner[currentCity] = voronoi->owner[search->back[currentCity]];
+
+        owner = voronoi->owner[currentCity];
+        voronoi->distances[currentCity] = currentDistance;
+        voronoi->regionSize[owner]++;
+
+        if (currentDistance > voronoi->regionRadius[owner])
+            voronoi->regionRadius[owner] = currentDistance;
+
+        relaxRow(search, currentCity, currentDistance);
+    }
+
+    voronoi->settledCount = search->settledCount;
+
+    return voronoi;
+}
+
+/*
+    Nearest Facilities:
+        - Labels every city with its nearest facility out of given city names (Voronoi regions).
+        - Uses the network's frozen graph and search workspace, the network itself is not changed.
+        - Flags an error for each facility city that isn't present within the network (kept as a
+            facility owning no cities).
+        - Returns the regions found, or NULL on failure.
+*/
+struct Voronoi* nearestFacilities(struct Network* cityNetwork, char facilityNames[][127], int numFacilities)
+{
+    struct Search* search = networkSearch(cityNetwork);
+    int index;
+
+    // Error flagging system:
+
+    if (numFacilities <= 0)
+    {
+        printf("Failure: Number of facilities must be greater than 0! - (nearestFacilities - nearestSearch.c)\n");
+        return NULL;
+    }
+
+    int* facilityIds = malloc(numFacilities * sizeof(int));
+
+    for (index = 0; index < numFacilities; index++)
+    {
+        facilityIds[index] = graphCityIndex(search->graph, facilityNames[index]);
+
+        if (facilityIds[index] < 0)
+            printf("Failure: City '%s' not found in network! - (nearestFacilities - nearestSearch.c)\n", facilityNames[index]);
+    }
+
+    struct Voronoi* voronoi = searchVoronoi(search, facilityIds, numFacilities);
+    free(facilityIds);
+
+    return voronoi;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                    NEAREST DESTRUCTORS/DISPLAY FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Nearest Destructor:
+        - Free memory associated with a set of nearest cities.
+*/
+void nearestDestructor(struct Nearest* nearest)
+{
+    if (nearest == NULL)
+        return;
+
+    free(nearest->nodes);
+    free(nearest->distances);
+    free(nearest);
+}
+
+/*
+    Voronoi Destructor:
+        - Free memory associated with Voronoi regions.
+*/
+void voronoiDestructor(struct Voronoi* voronoi)
+{
+    if (voronoi == NULL)
+        return;
+
+    free(voronoi->facilities);
+    free(voronoi->owner);
+    free(voronoi->distances);
+    free(voronoi->regionSize);
+    free(voronoi->regionRadius);
+    free(voronoi);
+}
+
+/*
+    Display Nearest:
+        - Prints every city found with its distance, closest first.
+*/
+void displayNearest(struct Nearest* nearest)
+{
+    int index;
+
+    if (nearest == NULL)
+    {
+        printf("\tNo cities found!\n");
+        return;
+    }
+
+    printf("\t%d of %d nearest cities found (%d cities settled):\n", nearest->count, nearest->k, nearest->settledCount);
+
+    for (index = 0; index < nearest->count; index++)
+        printf("\t\t%d. %s - %dkm\n", index + 1, graphCityName(nearest->graph, nearest->nodes[index]), nearest->distances[index]);
+}
+
+/*
+    Display Voronoi:
+        - Prints the number of cities and the furthest city distance of every facility's region.
+*/
+void displayVoronoi(struct Voronoi* voronoi)
+{
+    int index;
+
+    if (voronoi == NULL)
+    {
+        printf("\tNo regions found!\n");
+        return;
+    }
+
+    for (index = 0; index < voronoi->numFacilities; index++)
+    {
+        if (voronoi->facilities[index] < 0)
+        {
+            printf("\tFacility %d: Not found! - Owns no cities.\n", index + 1);
+            continue;
+        }
+
+        printf("\tFacility %d: %s - %d cities within %dkm\n", index + 1, graphCityName(voronoi->graph, voronoi->facilities[index]),
+               voronoi->regionSize[index], voronoi->regionRadius[index]);
+    }
+
+    printf("\t%d of %d cities settled by one search.\n", voronoi->settledCount, voronoi->graph->numNodes);
+}
@@ -28,6 +28,9 @@
 // User created libraries:
 #include "list.h"
 #include "stack.h"
+#include "heap.h"
+#include "graph.h"
+#include "search.h"
 
 /*
     DYNAMIC_RESIZE:
@@ -38,6 +41,13 @@
 */
 #define DYNAMIC_RESIZE 1
 
+/*
+    FREEZE_ORDER:
+        - Node order of the frozen graph built by networkFreeze() (see GRAPH_ORDER in 'graph.h').
+        - Nodes are renumbered so connected cities sit close together in memory, names move with them.
+*/
+#define FREEZE_ORDER GRAPH_ORDER_BFS
+
 
 /** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
                                         PUBLIC NETWORK STRUCTURES
@@ -55,6 +65,24 @@ struct Node;
 */
 struct Network;
 
+/*
+    Batch Structure:
+        - Public structure defined in 'graphNetwork.c' source file.
+*/
+struct Batch;
+
+/*
+    Graph Structure:
+        - Public structure defined in 'graph.h' header file.
+*/
+struct Graph;
+
+/*
+    Search Structure:
+        - Public structure defined in 'search.h' header file.
+*/
+struct Search;
+
 /*
     Timer Structure Typedef:
         - Custom time variables to calculate time complexity across source files.
@@ -78,27 +106,69 @@ struct Network* networkConstructor();
 void networkDestructor(struct Network* cityNetwork);
 
 // Adds a node/city into a network with a given city name.
-int addCity(struct Network* cityNetwork, char cityName[127]);
+int addCity(struct Network* cityNetwork, const char* cityName);
 
 // Adds a weighted edge/path between two cities present within a network.
-int addPath(struct Network* cityNetwork, char city1Name[127], char city2Name[127], int distance);
+int addPath(struct Network* cityNetwork, const char* city1Name, const char* city2Name, int distance);
 
 // Removes a present node/city from a network with a given city name.
-int removeCity(struct Network* cityNetwork, char cityName[127]);
+int removeCity(struct Network* cityNetwork, const char* cityName);
 
 // Removes a present weighted edge/path between two cities in a network.
-int removePath(struct Network* cityNetwork, char city1Name[127], char city2Name[127]);
+int removePath(struct Network* cityNetwork, const char* city1Name, const char* city2Name);
+
+// Creates an empty batch of network changes.
+struct Batch* batchConstructor(void);
+
+// Frees memory associated with a given batch.
+void batchDestructor(struct Batch* batch);
+
+// Adds a city, path, city removal or path removal to a batch.
+int batchAddCity(struct Batch* batch, const char* cityName);
+int batchAddPath(struct Batch* batch, const char* city1Name, const char* city2Name, int distance);
+int batchRemoveCity(struct Batch* batch, const char* cityName);
+int batchRemovePath(struct Batch* batch, const char* city1Name, const char* city2Name);
+
+// Returns the number of changes within a batch.
+int batchSize(struct Batch* batch);
+
+// Applies every change of a batch to a network, all or nothing.
+int batchApply(struct Network* cityNetwork, struct Batch* batch);
 
 // Displays the current nodes within a network.
 void displayNetwork(struct Network* cityNetwork);
 
 // Displays a given city name's current connection list within a network.
-void displayConnections(struct Network* cityNetwork, char cityName[127]);
+void displayConnections(struct Network* cityNetwork, const char* cityName);
 
 // Returns name of given node.
 char* getNodeName(struct Node* node);
 
+// Returns connection list of given node.
+struct List* getNodeConnections(struct Node* node);
+
+// Returns a monotonic wall clock time in seconds.
+double timerNow(void);
+
+// Returns the number of changes made to a network so far.
+int networkVersion(struct Network* cityNetwork);
+
+// Builds a new compact read-only copy of a network, owned by the caller.
+struct Graph* networkBuildGraph(struct Network* cityNetwork);
+
+// Returns a compact read-only copy of a network, rebuilt only after the network has changed.
+struct Graph* networkFreeze(struct Network* cityNetwork);
+
+// Returns the network's own search workspace on its frozen graph.
+struct Search* networkSearch(struct Network* cityNetwork);
+
+// Returns the number of connected components (groups of cities joined by paths) of a network.
+int networkComponentCount(struct Network* cityNetwork);
+
+// Displays the number of connected components and the sizes of the largest.
+void displayComponents(struct Network* cityNetwork, int maxShown);
+
 // Applies Dijkstra's algorithm between two cities present within a network.
-int dijkstra(FILE* dijkstraresults_file, double *timeInSeconds, struct Network* cityNetwork, char cityStartName[127], char cityEndName[127]);
+int dijkstra(FILE* dijkstraresults_file, double *timeInSeconds, struct Network* cityNetwork, const char* cityStartName, const char* cityEndName);
 
 #endif // NETWORK_H_INCLUDED
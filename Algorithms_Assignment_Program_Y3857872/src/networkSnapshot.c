@@ -0,0 +1,280 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    networkSnapshot.c:
+        - Source file defining the functions to publish and pin versions (snapshots) of a network.
+        - Copy on write: a writer changes the network's node lists as before, then builds a new frozen
+            graph from them and swaps it in as the current snapshot with one atomic exchange. Readers
+            only ever search snapshots, never the node lists, so they never wait for a writer.
+        - A replaced snapshot is retired and freed once no reader holds it (read-copy-update).
+
+        - Functions:
+            - snapshotConstructor
+            - snapshotDestructor
+            - versionedReclaim
+            - versionedConstructor
+            - versionedDestructor
+            - versionedWriteBegin
+            - versionedWriteEnd
+            - versionedRetiredCount
+            - snapshotAcquire
+            - snapshotRelease
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Include respective header file:
+#include "snapshot.h"
+
+// POSIX thread library used to keep to one writer at a time:
+#include <pthread.h>
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            SNAPSHOT STRUCTURES
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    VersionedNetwork Structure:
+        network         - Network changed by the writers.
+        writeLock       - Held from versionedWriteBegin() to versionedWriteEnd(), one writer at a time.
+        retireLock      - Guards the retired list (readers only ever try it, never wait on it).
+        current         - Snapshot handed to new readers.
+        acquiring       - Number of readers between loading 'current' and counting their reference.
+        retired         - Replaced snapshots waiting for their readers to finish.
+*/
+struct VersionedNetwork
+{
+    struct Network* network;
+
+    pthread_mutex_t writeLock;
+    pthread_mutex_t retireLock;
+
+    _Atomic(struct Snapshot*) current;
+    atomic_int acquiring;
+    struct Snapshot* retired;
+};
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        SNAPSHOT CONSTRUCTORS/DESTRUCTORS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Snapshot Constructor:
+        - Allocate memory for a snapshot and build its graph from the network as it is now.
+        - Returns pointer to new snapshot.
+*/
+static struct Snapshot* snapshotConstructor(struct Network* cityNetwork)
+{
+    struct Snapshot* snapshot = malloc(sizeof(struct Snapshot));
+
+    snapshot->graph = networkBuildGraph(cityNetwork);
+    snapshot->version = networkVersion(cityNetwork);
+    snapshot->nextRetired = NULL;
+    atomic_init(&snapshot->references, 0);
+
+    // Return new snapshot.
+    return snapshot;
+}
+
+/*
+    Snapshot Destructor:
+        - Free memory associated with a snapshot and its graph.
+*/
+static void snapshotDestructor(struct Snapshot* snapshot)
+{
+    graphDestructor(snapshot->graph);
+    free(snapshot);
+}
+
+/*
+    Versioned Reclaim:
+        - Frees every retired snapshot no reader holds, must be called with the retire lock held.
+        - 'acquiring' is read before each reference count: a reader that loaded a retired snapshot
+            either still counts as acquiring, or has already added its reference. Readers starting
+            after the check load the newer snapshot, so a count of zero cannot rise again.
+*/
+static void versionedReclaim(struct VersionedNetwork* versioned)
+{
+    struct Snapshot** link = &versioned->retired;
+
+    while (*link != NULL)
+    {
+        struct Snapshot* snapshot = *link;
+
+        if (atomic_load(&versioned->acquiring) == 0 && atomic_load(&snapshot->references) == 0)
+        {
+            *link = snapshot->nextRetired;
+            snapshotDestructor(snapshot);
+        }
+        else link = &snapshot->nextRetired;
+    }
+}
+
+/*
+    Versioned Constructor:
+        - Allocate memory for a versioned network around a given network and publish its first snapshot.
+        - From then on the network must only be changed between versionedWriteBegin() and versionedWriteEnd().
+        - Returns pointer to new versioned network.
+*/
+struct VersionedNetwork* versionedConstructor(struct Network* cityNetwork)
+{
+    struct VersionedNetwork* versioned = malloc(sizeof(struct VersionedNetwork));
+
+    versioned->network = cityNetwork;
+    versioned->retired = NULL;
+
+    pthread_mutex_init(&versioned->writeLock, NULL);
+    pthread_mutex_init(&versioned->retireLock, NULL);
+    atomic_init(&versioned->acquiring, 0);
+    atomic_init(&versioned->current, snapshotConstructor(cityNetwork));
+
+    // Return new versioned network.
+    return versioned;
+}
+
+/*
+    Versioned Destructor:
+        - Free memory associated with a versioned network and every snapshot it published.
+        - Readers must have released their snapshots first, otherwise nothing is freed.
+        - The wrapped network is not freed (see networkDestructor()).
+*/
+void versionedDestructor(struct VersionedNetwork* versioned)
+{
+    if (versioned == NULL)
+        return;
+
+    pthread_mutex_lock(&versioned->retireLock);
+    versionedReclaim(versioned);
+    pthread_mutex_unlock(&versioned->retireLock);
+
+    struct Snapshot* current = atomic_load(&versioned->current);
+
+    // Exit function if any snapshot is still held by a reader.
+    if (versioned->retired != NULL || atomic_load(&current->references) != 0)
+    {
+        printf("Failure: Snapshots are still held by readers - (versionedDestructor - networkSnapshot.c)\n");
+        return;
+    }
+
+    snapshotDestructor(current);
+    pthread_mutex_destroy(&versioned->writeLock);
+    pthread_mutex_destroy(&versioned->retireLock);
+    free(versioned);
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            SNAPSHOT WRITER FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Versioned Write Begin:
+        - Waits for any other writer to finish, then returns the network to change with the usual
+            network functions (addCity, addPath, removeCity, removePath).
+        - Readers are unaffected, they keep searching the current snapshot.
+*/
+struct Network* versionedWriteBegin(struct VersionedNetwork* versioned)
+{
+    pthread_mutex_lock(&versioned->writeLock);
+
+    return versioned->network;
+}
+
+/*
+    Versioned Write End:
+        - Builds a snapshot of the changed network and publishes it, then retires the replaced snapshot.
+        - The new graph is built before the exchange, so readers only see complete snapshots.
+        - Returns indication if a new snapshot was published.
+            '1' -> Network changed, new snapshot published.
+            '0' -> Network unchanged, current snapshot kept.
+*/
+int versionedWriteEnd(struct VersionedNetwork* versioned)
+{
+    struct Snapshot* current = atomic_load(&versioned->current);
+
+    // Keep the current snapshot if nothing was changed.
+    if (networkVersion(versioned->network) == current->version)
+    {
+        pthread_mutex_unlock(&versioned->writeLock);
+        return 0;
+    }
+
+    struct Snapshot* replaced = atomic_exchange(&versioned->current, snapshotConstructor(versioned->network));
+
+    // Retire the replaced snapshot, freeing it straight away if no reader holds it.
+    pthread_mutex_lock(&versioned->retireLock);
+    replaced->nextRetired = versioned->retired;
+    versioned->retired = replaced;
+    versionedReclaim(versioned);
+    pthread_mutex_unlock(&versioned->retireLock);
+
+    pthread_mutex_unlock(&versioned->writeLock);
+
+    return 1;
+}
+
+/*
+    Versioned Retired Count:
+        - Returns the number of replaced snapshots not yet freed (still held by readers).
+*/
+int versionedRetiredCount(struct VersionedNetwork* versioned)
+{
+    int count = 0;
+
+    pthread_mutex_lock(&versioned->retireLock);
+
+    struct Snapshot* snapshot;
+    for (snapshot = versioned->retired; snapshot != NULL; snapshot = snapshot->nextRetired)
+        count++;
+
+    pthread_mutex_unlock(&versioned->retireLock);
+
+    return count;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            SNAPSHOT READER FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Snapshot Acquire:
+        - Pins the current snapshot so it is not freed while searched (lock free, three atomic steps).
+        - The snapshot's graph stays valid and unchanged until snapshotRelease(), even if newer
+            snapshots are published in the meantime. Search workspaces are made for the graph as usual.
+        - Returns pointer to the pinned snapshot.
+*/
+struct Snapshot* snapshotAcquire(struct VersionedNetwork* versioned)
+{
+    atomic_fetch_add(&versioned->acquiring, 1);
+
+    struct Snapshot* snapshot = atomic_load(&versioned->current);
+    atomic_fetch_add(&snapshot->references, 1);
+
+    atomic_fetch_sub(&versioned->acquiring, 1);
+
+    return snapshot;
+}
+
+/*
+    Snapshot Release:
+        - Unpins a snapshot returned by snapshotAcquire().
+        - The last reader of a retired snapshot frees it, unless a writer holds the retire lock at
+            that moment (the snapshot is then freed by a later writer or release).
+*/
+void snapshotRelease(struct VersionedNetwork* versioned, struct Snapshot* snapshot)
+{
+    if (snapshot == NULL)
+        return;
+
+    // Only the last reader of a replaced snapshot has anything to free.
+    if (atomic_fetch_sub(&snapshot->references, 1) != 1 || snapshot == atomic_load(&versioned->current))
+        return;
+
+    if (pthread_mutex_trylock(&versioned->retireLock) == 0)
+    {
+        versionedReclaim(versioned);
+        pthread_mutex_unlock(&versioned->retireLock);
+    }
+}
@@ -0,0 +1,139 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    overlay.h:
+        - Header file for the 'customizableRoutes.c' source file.
+        - Defines the public functions to partition a graph into nested cells once (topology only),
+            customize the distances across each cell's boundary for the current path distances, and
+            query across the levels of cells (customizable route planning). Changing a few distances
+            only customizes the cells holding them again.
+        - Contains the 'Overlay' structure.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+#ifndef OVERLAY_H_INCLUDED
+#define OVERLAY_H_INCLUDED
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        OVERLAY LIBRARIES/DEFINITIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// User Created Search Library:
+#include "search.h"
+
+/*
+    OVERLAY_LEVELS:
+        - Number of levels of cells, each cell of a level is a group of whole cells of the level below.
+*/
+#define OVERLAY_LEVELS 3
+
+/*
+    OVERLAY_CELL_SIZE:
+        - Largest number of cities within a cell of the lowest level.
+*/
+#define OVERLAY_CELL_SIZE 32
+
+/*
+    OVERLAY_CELL_GROWTH:
+        - Each level's cells hold up to this many times the cities of the level below.
+*/
+#define OVERLAY_CELL_GROWTH 8
+
+/*
+    OVERLAY_THREADS:
+        - Default number of threads (including the calling thread) used to customize the cells.
+*/
+#define OVERLAY_THREADS 4
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        PUBLIC OVERLAY STRUCTURES
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Overlay Structure:
+        - A boundary node of a level has a path to or from a node of another cell of that level. Each cell keeps
+            a clique: the shortest distance within the cell between every pair of its boundary nodes,
+            stored row by row (boundary index * number of boundary nodes + boundary index).
+        - Arrays indexed '[level]' hold one array per level, level '0' being the smallest cells.
+
+        numNodes        - Number of nodes.
+        numEdges        - Number of edges (one per direction of each connected pair of cities).
+        rowStart        - Index of the first edge of each node (numNodes + 1 entries).
+        targets         - Node id each edge leads to.
+        weights         - Current distance of each edge (shortest of any parallel paths).
+
+        numCells        - Number of cells, per level.
+        cell            - Cell of each node, per level.
+        parent          - Cell of the next level up holding each cell, per level ('-1' on the top level).
+        boundaryIndex   - Position of each node within its cell's boundary nodes ('-1' if not one), per level.
+        boundaryStart   - Index of the first boundary node of each cell (numCells + 1 entries), per level.
+        boundary        - Boundary node ids of every cell in cell order, per level.
+        cliqueStart     - Index of the first clique entry of each cell (numCells + 1 entries), per level.
+        clique          - Clique distances of every cell in cell order, per level ('INT_MAX' if unreachable).
+
+        names           - Graph holding only the node names and name index (no edges).
+        numCustomized   - Number of cells customized by the last call to overlayCustomize().
+        buildTime       - Partitioning time in seconds.
+        customizeTime   - Time of the last customization in seconds.
+*/
+struct Overlay
+{
+    int numNodes;
+    int numEdges;
+    int* rowStart;
+    int* targets;
+    int* weights;
+
+    int numCells[OVERLAY_LEVELS];
+    int* cell[OVERLAY_LEVELS];
+    int* parent[OVERLAY_LEVELS];
+    int* boundaryIndex[OVERLAY_LEVELS];
+    int* boundaryStart[OVERLAY_LEVELS];
+    int* boundary[OVERLAY_LEVELS];
+    long long* cliqueStart[OVERLAY_LEVELS];
+    int* clique[OVERLAY_LEVELS];
+
+    struct Graph* names;
+    int numCustomized;
+    double buildTime;
+    double customizeTime;
+};
+
+/*
+    OverlaySearch Structure:
+        - Public structure defined in 'customizableRoutes.c' source file.
+*/
+struct OverlaySearch;
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                    PUBLIC OVERLAY FUNCTION DECLARATIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Partitions a graph into nested cells (independent of the path distances, which are set by overlayCustomize()).
+struct Overlay* overlayConstructor(struct Graph* graph);
+
+// Frees memory associated with a given overlay.
+void overlayDestructor(struct Overlay* overlay);
+
+// Reads the path distances of a graph with the same cities and connected pairs, customizing the cells whose paths changed.
+int overlayCustomize(struct Overlay* overlay, struct Graph* graph, int numThreads);
+
+// Allocates a query workspace on a given overlay.
+struct OverlaySearch* overlaySearchConstructor(struct Overlay* overlay);
+
+// Frees memory associated with a given overlay query workspace.
+void overlaySearchDestructor(struct OverlaySearch* overlaySearch);
+
+// Returns the shortest distance between two overlay node ids (INT_MAX if unreachable).
+int overlayShortestPath(struct OverlaySearch* overlaySearch, int startId, int endId);
+
+// Returns the number of nodes settled by the last query.
+int overlaySettledCount(struct OverlaySearch* overlaySearch);
+
+// Prints the cells and boundary nodes of each level and the last customization.
+void overlayReport(struct Overlay* overlay);
+
+#endif // OVERLAY_H_INCLUDED
@@ -0,0 +1,76 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    paths.h:
+        - Header file for the 'kShortestPaths.c' source file.
+        - Defines the public functions to find the k shortest loopless paths (alternative routes)
+            between two cities from within 'main.c'.
+        - Contains the 'Route' and 'Routes' structures returned to the caller.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+#ifndef PATHS_H_INCLUDED
+#define PATHS_H_INCLUDED
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        PATHS LIBRARIES/DEFINITIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// User Created Network Library:
+#include "network.h"
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        PUBLIC PATHS STRUCTURES
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Route Structure:
+        numNodes        - Number of cities on the route, including the start and end cities.
+        nodes           - Node ids of the cities on the route, from start to end.
+        distances       - Distance travelled from the start when reaching each city.
+        deviation       - Index of the city where the route leaves the route it was derived from.
+*/
+struct Route
+{
+    int numNodes;
+    int* nodes;
+    int* distances;
+    int deviation;
+};
+
+/*
+    Routes Structure:
+        - Routes refer to the node ids of the graph they were found on, so they must be displayed
+            before the network they came from is changed.
+
+        graph           - Graph the routes were found on (used to print city names).
+        count           - Number of routes found, in increasing order of distance.
+        route           - Array of routes.
+*/
+struct Routes
+{
+    struct Graph* graph;
+    int count;
+    struct Route* route;
+};
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                    PUBLIC PATHS FUNCTION DECLARATIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Finds up to k shortest loopless paths between two cities present within a network.
+struct Routes* kShortestPaths(struct Network* cityNetwork, const char* cityStartName, const char* cityEndName, int k);
+
+// Finds up to k shortest loopless paths between two node ids using a given search workspace.
+struct Routes* searchKShortestPaths(struct Search* search, int startId, int endId, int k);
+
+// Frees memory associated with a given set of routes.
+void routesDestructor(struct Routes* routes);
+
+// Displays every route within a given set of routes.
+void displayRoutes(struct Routes* routes);
+
+#endif // PATHS_H_INCLUDED
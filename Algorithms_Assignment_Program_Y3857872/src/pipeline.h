@@ -0,0 +1,87 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    pipeline.h:
+        - Header file for the 'batchPipeline.c' source file.
+        - Defines the public function to run a whole Dijkstra pairs file through a staged pipeline
+            (reader -> query workers -> writer) from within 'main.c'.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+#ifndef PIPELINE_H_INCLUDED
+#define PIPELINE_H_INCLUDED
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        PIPELINE LIBRARIES/DEFINITIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// User Created Network Library:
+#include "network.h"
+
+/*
+    PIPELINE_ENABLED:
+        - Selects how 'main.c' runs the Dijkstra pairs file.
+                '1' -> Staged pipeline, file reading, searching and writing overlap.
+                '0' -> One dijkstra() call per pair on the main thread.
+*/
+#define PIPELINE_ENABLED 1
+
+/*
+    PIPELINE_WORKERS:
+        - Number of query worker threads between the reader and writer stages.
+*/
+#define PIPELINE_WORKERS 4
+
+/*
+    PIPELINE_QUEUE_CAPACITY:
+        - Capacity of each bounded queue between stages (must be a power of two).
+        - Twice this number of pairs can be in flight at once.
+*/
+#define PIPELINE_QUEUE_CAPACITY 256
+
+/*
+    PIPELINE_ECHO:
+        - Enables/Disables printing every result to the terminal as well as the results file.
+                '1' -> Enabled.
+                '0' -> Disabled (recommended for large pairs files, the terminal becomes the slowest stage).
+*/
+#define PIPELINE_ECHO 1
+
+/*
+    PIPELINE_IDS:
+        - Selects how 'main.c' passes the pairs to the pipeline.
+                '1' -> Every city name is resolved once into a node id file first (see 'handle.h'), the
+                        workers then never look a name up. The resolve pass runs before the pipeline
+                        starts (timed with the searches), so it suits node id files run many times.
+                '0' -> The workers resolve both city names of every pair, reading overlaps the searches.
+*/
+#define PIPELINE_IDS 0
+
+/*
+    PIPELINE_TIME_LIMIT:
+        - Wall-clock time allowed per query in seconds, a query past it is written out as stopped with
+            the best distance found so far ('0' -> No deadline).
+*/
+#define PIPELINE_TIME_LIMIT 0
+
+/*
+    PIPELINE_MAX_SETTLED:
+        - Number of cities a query may settle before it is written out as stopped ('0' -> No budget).
+*/
+#define PIPELINE_MAX_SETTLED 0
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                    PUBLIC PIPELINE FUNCTION DECLARATIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Runs every pair of a Dijkstra pairs file through the reader, query worker and writer stages.
+int dijkstraPipeline(FILE* dijkstrapairs_file, FILE* dijkstraresults_file, struct Network* cityNetwork,
+                     int numWorkers, double* dijkstraTotalTime);
+
+// Runs every pair of a pairs file of node ids through the reader, query worker and writer stages.
+int dijkstraPipelineIds(FILE* dijkstrapairs_file, FILE* dijkstraresults_file, struct Network* cityNetwork,
+                        int numWorkers, double* dijkstraTotalTime);
+
+#endif // PIPELINE_H_INCLUDED
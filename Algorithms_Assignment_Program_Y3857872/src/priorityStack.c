@@ -166,7 +166,7 @@ void stackResize(struct Stack* stack, int newSize)
             'index' -> City name found, index within list returned.
             '-1'    -> Node not present in list.
 */
-int stackSearch(struct Stack* stack, char cityName[127])
+int stackSearch(struct Stack* stack, const char* cityName)
 {
     int index;
 
@@ -0,0 +1,368 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    radiusSearch.c:
+        - Source file defining the functions to find every city within a given distance of a start city.
+        - Runs Dijkstra's algorithm from the start city and stops as soon as the closest unsettled city
+            is out of range, recording each city as it is settled. Search workspaces start in constant
+            time, so a small radius costs the cities within it, not the size of the network.
+        - Cities are settled closest first, so the area comes out sorted by distance for free.
+        - Many start cities are searched at once by worker threads, each with its own workspace on the
+            same frozen graph.
+
+        - Functions:
+            - areaConstructor
+            - areaCompareNames
+            - searchCitiesWithin
+            - citiesWithin
+            - areaWorkerThread
+            - citiesWithinBatch
+            - areaDestructor
+            - areasDestructor
+            - displayArea
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Include respective header file:
+#include "area.h"
+
+// Edge relaxation kernels:
+#include "relax.h"
+
+// Thread and atomic libraries:
+#include <pthread.h>
+#include <stdatomic.h>
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            AREA STRUCTURES
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    AreaEntry Structure:
+        - One city of an area while sorting by name.
+
+        name            - City name.
+        node            - Node id.
+        distance        - Distance from the start city.
+*/
+struct AreaEntry
+{
+    char* name;
+    int node;
+    int distance;
+};
+
+/*
+    AreaBatch Structure:
+        - Shared state of citiesWithinBatch().
+
+        graph           - Graph searched.
+        component       - Component labels of the graph, given to every workspace as by networkSearch().
+        startIds        - Node id of each start city ('-1' if not found).
+        numStarts       - Number of start cities.
+        maxDistance     - Radius of every area.
+        order           - Order of the cities within each area (see AREA_ORDER in 'area.h').
+        areas           - Area found from each start city.
+        nextStart       - Next unclaimed start city.
+*/
+struct AreaBatch
+{
+    struct Graph* graph;
+    int* component;
+    int* startIds;
+    int numStarts;
+    int maxDistance;
+    int order;
+
+    struct Area** areas;
+    atomic_int nextStart;
+};
+
+/*
+    AreaWorker Structure:
+        batch           - Shared state.
+        thread          - POSIX thread handle (unused for thread '0').
+*/
+struct AreaWorker
+{
+    struct AreaBatch* batch;
+    pthread_t thread;
+};
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            AREA SEARCH FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Area Constructor:
+        - Allocate memory for an empty area with room for a given number of cities.
+*/
+static struct Area* areaConstructor(struct Graph* graph, int startId, int maxDistance, int capacity)
+{
+    struct Area* area = malloc(sizeof(struct Area));
+
+    area->graph = graph;
+    area->start = startId;
+    area->maxDistance = maxDistance;
+    area->count = 0;
+    area->nodes = malloc((capacity > 0 ? capacity : 1) * sizeof(int));
+    area->distances = malloc((capacity > 0 ? capacity : 1) * sizeof(int));
+
+    return area;
+}
+
+/*
+    Area Compare Names:
+        - qsort() comparison of two area entries by city name, alphabetical.
+*/
+static int areaCompareNames(const void* entry1, const void* entry2)
+{
+    return strcmp(((const struct AreaEntry*) entry1)->name, ((const struct AreaEntry*) entry2)->name);
+}
+
+/*
+    Search Cities Within:
+        - Finds every node within a given distance of a start node id, the start node included.
+        - Blocked edges and nodes of the workspace are skipped, landmarks and arc flags are not used
+            (the search has no end node).
+        - Returns the area, or 'NULL' if the start id or distance is invalid.
+*/
+struct Area* searchCitiesWithin(struct Search* search, int startId, int maxDistance, int order)
+{
+    struct Graph* graph = search->graph;
+    int capacity = 16;
+    int currentDistance;
+
+    if (startId < 0 || startId >= graph->numNodes || maxDistance < 0)
+        return NULL;
+
+    struct Area* area = areaConstructor(graph, startId, maxDistance, capacity);
+
+    searchReset(search, startId);
+
+    // Settle closest first until the next city is out of range.
+    while (heapIsEmpty(search->heap) == 0 && heapTopKey(search->heap) <= maxDistance)
+    {
+        int currentCity = heapPop(search->heap, &currentDistance);
+
+        search->settledStamp[currentCity] = search->epoch;
+        search->settledCount++;
+
+        if (area->count == capacity)
+        {
+            capacity *= 2;
+            area->nodes = realloc(area->nodes, capacity * sizeof(int));
+            area->distances = realloc(area->distances, capacity * sizeof(int));
+        }
+
+        area->nodes[area->count] = currentCity;
+        area->distances[area->count] = currentDistance;
+        area->count++;
+
+        relaxRow(search, currentCity, currentDistance);
+    }
+
+    // Already closest first, re-sort by name if asked.
+    if (order == AREA_ORDER_NAME && area->count > 1)
+    {
+        struct AreaEntry* entries = malloc(area->count * sizeof(struct AreaEntry));
+        int index;
+
+        for (index = 0; index < area->count; index++)
+        {
+            entries[index].name = graphCityName(graph, area->nodes[index]);
+            entries[index].node = area->nodes[index];
+            entries[index].distance = area->distances[index];
+        }
+
+        qsort(entries, area->count, sizeof(struct AreaEntry), areaCompareNames);
+
+        for (index = 0; index < area->count; index++)
+        {
+            area->nodes[index] = entries[index].node;
+            area->distances[index] = entries[index].distance;
+        }
+
+        free(entries);
+    }
+
+    return area;
+}
+
+/*
+    Cities Within:
+        - Finds every city within a given distance of a given city name (service area).
+        - Uses the network's frozen graph and search workspace, the network itself is not changed.
+        - Flags an error if the city isn't present within the network or the distance is negative.
+        - Returns the area found, or NULL on failure.
+*/
+struct Area* citiesWithin(struct Network* cityNetwork, const char* cityStartName, int maxDistance, int order)
+{
+    struct Search* search = networkSearch(cityNetwork);
+
+    // Find city id.
+    int cityStartId = graphCityIndex(search->graph, cityStartName);
+
+    // Error flagging system:
+
+    if (cityStartId < 0)
+    {
+        printf("Failure: City '%s' not found in network! - (citiesWithin - radiusSearch.c)\n", cityStartName);
+        return NULL;
+    }
+    else if (maxDistance < 0)
+    {
+        printf("Failure: Distance must not be negative! - (citiesWithin - radiusSearch.c)\n");
+        return NULL;
+    }
+
+    return searchCitiesWithin(search, cityStartId, maxDistance, order);
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            AREA BATCH FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Area Worker Thread:
+        - Claims start cities and finds their areas with a workspace of its own until none are left.
+*/
+static void* areaWorkerThread(void* argument)
+{
+    struct AreaWorker* worker = argument;
+    struct AreaBatch* batch = worker->batch;
+    struct Search* search = searchConstructor(batch->graph);
+    int start;
+
+    search->component = batch->component;
+
+    while ((start = atomic_fetch_add(&batch->nextStart, 1)) < batch->numStarts)
+        batch->areas[start] = searchCitiesWithin(search, batch->startIds[start], batch->maxDistance, batch->order);
+
+    searchDestructor(search);
+
+    return NULL;
+}
+
+/*
+    Cities Within Batch:
+        - Finds the area of each given city name across a given number of threads (thread '0' being
+            the calling thread), all within the same distance.
+        - Flags an error for each city not present within the network, its area is left 'NULL'.
+        - Returns an array of 'numStarts' areas in the order of the names (see areasDestructor()),
+            or NULL if the distance is negative.
+*/
+struct Area** citiesWithinBatch(struct Network* cityNetwork, char cityStartNames[][127], int numStarts, int maxDistance,
+                                int order, int numThreads)
+{
+    int index;
+
+    if (maxDistance < 0)
+    {
+        printf("Failure: Distance must not be negative! - (citiesWithinBatch - radiusSearch.c)\n");
+        return NULL;
+    }
+
+    if (numThreads < 1)
+        numThreads = 1;
+
+    if (numThreads > numStarts)
+        numThreads = numStarts;
+
+    struct AreaBatch batch;
+    batch.graph = networkFreeze(cityNetwork);
+    batch.component = networkSearch(cityNetwork)->component;
+    batch.startIds = malloc((numStarts > 0 ? numStarts : 1) * sizeof(int));
+    batch.numStarts = numStarts;
+    batch.maxDistance = maxDistance;
+    batch.order = order;
+    batch.areas = calloc(numStarts > 0 ? numStarts : 1, sizeof(struct Area*));
+    atomic_store(&batch.nextStart, 0);
+
+    // Resolve every name up front, so failures print in order.
+    for (index = 0; index < numStarts; index++)
+    {
+        batch.startIds[index] = graphCityIndex(batch.graph, cityStartNames[index]);
+
+        if (batch.startIds[index] < 0)
+            printf("Failure: City '%s' not found in network! - (citiesWithinBatch - radiusSearch.c)\n", cityStartNames[index]);
+    }
+
+    struct AreaWorker* workers = malloc((numThreads > 0 ? numThreads : 1) * sizeof(struct AreaWorker));
+
+    for (index = 0; index < numThreads; index++)
+        workers[index].batch = &batch;
+
+    for (index = 1; index < numThreads; index++)
+        pthread_create(&workers[index].thread, NULL, areaWorkerThread, &workers[index]);
+
+    if (numThreads > 0)
+        areaWorkerThread(&workers[0]);
+
+    for (index = 1; index < numThreads; index++)
+        pthread_join(workers[index].thread, NULL);
+
+    free(workers);
+    free(batch.startIds);
+
+    return batch.areas;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        AREA DESTRUCTORS/DISPLAY FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Area Destructor:
+        - Free memory associated with an area.
+*/
+void areaDestructor(struct Area* area)
+{
+    if (area == NULL)
+        return;
+
+    free(area->nodes);
+    free(area->distances);
+    free(area);
+}
+
+/*
+    Areas Destructor:
+        - Free memory associated with the array of areas returned by citiesWithinBatch().
+*/
+void areasDestructor(struct Area** areas, int numStarts)
+{
+    int index;
+
+    if (areas == NULL)
+        return;
+
+    for (index = 0; index < numStarts; index++)
+        areaDestructor(areas[index]);
+
+    free(areas);
+}
+
+/*
+    Display Area:
+        - Prints the start city, radius and every city within a given area with its distance.
+*/
+void displayArea(struct Area* area)
+{
+    int index;
+
+    if (area == NULL)
+    {
+        printf("\tNo area found!\n");
+        return;
+    }
+
+    printf("\tCities within %dkm of '%s': %d\n", area->maxDistance, graphCityName(area->graph, area->start), area->count);
+
+    for (index = 0; index < area->count; index++)
+        printf("\t\t%s - %dkm\n", graphCityName(area->graph, area->nodes[index]), area->distances[index]);
+}
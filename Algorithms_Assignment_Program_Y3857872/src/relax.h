@@ -0,0 +1,51 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    relax.h:
+        - Header file for the 'relaxKernel.c' source file.
+        - Defines the public functions to relax every edge of a graph row (node) at once within the
+            search engines, using the widest vector instructions the processor supports.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+#ifndef RELAX_H_INCLUDED
+#define RELAX_H_INCLUDED
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        RELAX LIBRARIES/DEFINITIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// User Created Search Library:
+#include "search.h"
+
+/*
+    RELAX_SIMD:
+        - Enables/Disables the vector relaxation kernels.
+                '1' -> Enabled, AVX2 or SSE4.1 is chosen at runtime if the processor supports it.
+                '0' -> Disabled, every row is relaxed one edge at a time.
+*/
+#define RELAX_SIMD 1
+
+/*
+    RELAX_SIMD_MIN_DEGREE:
+        - Rows with fewer edges than this are relaxed one edge at a time, the vector set up
+            costs more than it saves on short rows.
+*/
+#define RELAX_SIMD_MIN_DEGREE 8
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                    PUBLIC RELAX FUNCTION DECLARATIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Chooses the relaxation kernel for this processor (safe to call from several threads).
+void relaxKernelInit(void);
+
+// Returns the name of the chosen relaxation kernel.
+const char* relaxKernelName(void);
+
+// Relaxes every edge of a settled node's row, pushing improved nodes onto the search heap.
+int relaxRow(struct Search* search, int currentCity, int currentDistance);
+
+#endif // RELAX_H_INCLUDED
@@ -0,0 +1,261 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    relaxKernel.c:
+        - Source file defining the edge relaxation step of Dijkstra's algorithm for a whole graph row.
+        - The vector kernels add the settled distance to a register of edge weights, gather the current
+            distances of the connected nodes, and compare them to find the improved edges in one step.
+            Only the improved edges are then written back (scattered) and pushed onto the heap.
+        - The kernel is chosen once at runtime: AVX2 (8 edges at a time), SSE4.1 (4 edges at a time)
+            or the scalar loop, so the same program runs on any x86 processor (or any other platform).
+
+        - Functions:
+            - relaxCommit
+            - relaxRowScalar
+            - relaxRowSse41
+            - relaxRowAvx2
+            - relaxKernelSelect
+            - relaxKernelInit
+            - relaxKernelName
+            - relaxRow
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Include respective header file:
+#include "relax.h"
+
+// POSIX thread library used to choose the kernel once:
+#include <pthread.h>
+
+// Vector intrinsics (x86 GCC/Clang only, other platforms use the scalar loop):
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define RELAX_X86 1
+#include <immintrin.h>
+#else
+#define RELAX_X86 0
+#endif
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            RELAX KERNEL STATE
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+static int relaxRowScalar(struct Search* search, int currentCity, int currentDistance);
+
+// Chosen kernel, set once by relaxKernelInit().
+static int (*relaxKernel)(struct Search* search, int currentCity, int currentDistance) = relaxRowScalar;
+static const char* relaxKernelLabel = "scalar";
+static pthread_once_t relaxKernelOnce = PTHREAD_ONCE_INIT;
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            RELAX KERNEL FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Relax Commit:
+        - Writes one relaxed edge back into the search workspace if it still improves the connected node.
+        - Re-checked one edge at a time, so parallel edges to the same node within one register are safe.
+        - Returns indication if the connected node was improved.
+            '1' -> Distance lowered and node pushed onto the heap.
+            '0' -> Edge skipped.
+*/
+static inline int relaxCommit(struct Search* search, int currentCity, int edge, int newDistance)
+{
+    int connectedCity = search->graph->targets[edge];
+
+    // Skip cities whose shortest distance is already final.
+    if (search->settledStamp[connectedCity] == search->epoch)
+        return 0;
+
+    // Skip edges and cities that are temporarily removed.
+    if (search->hasBlocks == 1 && (search->edgeBlocked[edge] == search->blockEpoch
+                                   || search->nodeBlocked[connectedCity] == search->blockEpoch))
+        return 0;
+
+    // Update the connected city's distance and route if it is shorter via the current city.
+    if (search->stamp[connectedCity] == search->epoch && newDistance >= search->distance[connectedCity])
+        return 0;
+
+    search->stamp[connectedCity] = search->epoch;
+    search->distance[connectedCity] = newDistance;
+    search->back[connectedCity] = currentCity;
+    heapPush(search->heap, connectedCity, newDistance);
+
+    return 1;
+}
+
+/*
+    Relax Row Scalar:
+        - Relaxes each edge of a row in turn.
+        - Returns the number of improved nodes.
+*/
+static int relaxRowScalar(struct Search* search, int currentCity, int currentDistance)
+{
+    struct Graph* graph = search->graph;
+    int improved = 0;
+    int edge;
+
+    for (edge = graph->rowStart[currentCity]; edge < graph->rowStart[currentCity + 1]; edge++)
+        improved += relaxCommit(search, currentCity, edge, currentDistance + graph->weights[edge]);
+
+    return improved;
+}
+
+#if RELAX_X86
+
+/*
+    Relax Row SSE4.1:
+        - Relaxes 4 edges at a time (SSE has no gather, so the current distances are loaded one by one).
+        - Returns the number of improved nodes.
+*/
+__attribute__((target("sse4.1")))
+static int relaxRowSse41(struct Search* search, int currentCity, int currentDistance)
+{
+    struct Graph* graph = search->graph;
+    int rowEnd = graph->rowStart[currentCity + 1];
+    int improved = 0;
+    int edge;
+
+    __m128i base = _mm_set1_epi32(currentDistance);
+
+    for (edge = graph->rowStart[currentCity]; edge + 4 <= rowEnd; edge += 4)
+    {
+        __m128i candidate = _mm_add_epi32(base, _mm_loadu_si128((const __m128i*) &graph->weights[edge]));
+
+        // Current distances, unreached nodes count as INT_MAX.
+        int lane, current[4];
+        for (lane = 0; lane < 4; lane++)
+        {
+            int connectedCity = graph->targets[edge + lane];
+            current[lane] = (search->stamp[connectedCity] == search->epoch) ? search->distance[connectedCity] : INT_MAX;
+        }
+
+        __m128i better = _mm_cmpgt_epi32(_mm_loadu_si128((const __m128i*) current), candidate);
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(better));
+
+        while (mask != 0)
+        {
+            lane = __builtin_ctz(mask);
+            mask &= mask - 1;
+            improved += relaxCommit(search, currentCity, edge + lane, currentDistance + graph->weights[edge + lane]);
+        }
+    }
+
+    // Remaining edges of the row.
+    for (; edge < rowEnd; edge++)
+        improved += relaxCommit(search, currentCity, edge, currentDistance + graph->weights[edge]);
+
+    return improved;
+}
+
+/*
+    Relax Row AVX2:
+        - Relaxes 8 edges at a time, gathering the connected nodes' stamps and distances.
+        - The last register of a row may run past its end, those lanes are masked off (the graph
+            arrays are padded so the loads stay within memory).
+        - Returns the number of improved nodes.
+*/
+__attribute__((target("avx2")))
+static int relaxRowAvx2(struct Search* search, int currentCity, int currentDistance)
+{
+    struct Graph* graph = search->graph;
+    int rowEnd = graph->rowStart[currentCity + 1];
+    int improved = 0;
+    int edge;
+
+    __m256i base = _mm256_set1_epi32(currentDistance);
+    __m256i epoch = _mm256_set1_epi32(search->epoch);
+    __m256i unreached = _mm256_set1_epi32(INT_MAX);
+    __m256i laneIndex = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+
+    for (edge = graph->rowStart[currentCity]; edge < rowEnd; edge += 8)
+    {
+        // Lanes past the end of the row are invalid.
+        __m256i valid = _mm256_cmpgt_epi32(_mm256_set1_epi32(rowEnd - edge), laneIndex);
+
+        __m256i targets = _mm256_loadu_si256((const __m256i*) &graph->targets[edge]);
+        __m256i candidate = _mm256_add_epi32(base, _mm256_loadu_si256((const __m256i*) &graph->weights[edge]));
+
+        // Gather the current distances, unreached nodes count as INT_MAX.
+        __m256i stamps = _mm256_mask_i32gather_epi32(_mm256_setzero_si256(), search->stamp, targets, valid, 4);
+        __m256i current = _mm256_mask_i32gather_epi32(unreached, search->distance, targets, valid, 4);
+        current = _mm256_blendv_epi8(unreached, current, _mm256_cmpeq_epi32(stamps, epoch));
+
+        // Compare, then scatter only the improved lanes.
+        __m256i better = _mm256_and_si256(_mm256_cmpgt_epi32(current, candidate), valid);
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(better));
+
+        while (mask != 0)
+        {
+            int lane = __builtin_ctz(mask);
+            mask &= mask - 1;
+            improved += relaxCommit(search, currentCity, edge + lane, currentDistance + graph->weights[edge + lane]);
+        }
+    }
+
+    return improved;
+}
+
+#endif // RELAX_X86
+
+/*
+    Relax Kernel Select:
+        - Chooses the widest kernel the processor supports (called once through pthread_once()).
+*/
+static void relaxKernelSelect(void)
+{
+    if (RELAX_SIMD == 0)
+        return;
+
+#if RELAX_X86
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2"))
+    {
+        relaxKernel = relaxRowAvx2;
+        relaxKernelLabel = "AVX2";
+    }
+    else if (__builtin_cpu_supports("sse4.1"))
+    {
+        relaxKernel = relaxRowSse41;
+        relaxKernelLabel = "SSE4.1";
+    }
+#endif
+}
+
+/*
+    Relax Kernel Init:
+        - Chooses the relaxation kernel, only the first call does any work.
+        - Called by searchConstructor(), so every search workspace uses the chosen kernel.
+*/
+void relaxKernelInit(void)
+{
+    pthread_once(&relaxKernelOnce, relaxKernelSelect);
+}
+
+/*
+    Relax Kernel Name:
+        - Returns the name of the chosen relaxation kernel.
+*/
+const char* relaxKernelName(void)
+{
+    relaxKernelInit();
+    return relaxKernelLabel;
+}
+
+/*
+    Relax Row:
+        - Relaxes every edge leaving a settled node with a given distance.
+        - Improved nodes have their distance and back node updated and are pushed onto the search heap.
+        - Returns the number of improved nodes.
+*/
+int relaxRow(struct Search* search, int currentCity, int currentDistance)
+{
+    struct Graph* graph = search->graph;
+
+    if (graph->rowStart[currentCity + 1] - graph->rowStart[currentCity] < RELAX_SIMD_MIN_DEGREE)
+        return relaxRowScalar(search, currentCity, currentDistance);
+
+    return relaxKernel(search, currentCity, currentDistance);
+}
@@ -0,0 +1,208 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    search.h:
+        - Header file for the 'dijkstraSearch.c' source file.
+        - Defines the public functions to run Dijkstra's algorithm on a frozen graph using a per-query
+            workspace, so several searches can run on the same graph from different threads.
+        - Contains the 'Search' structure needed within the pipeline and other source files.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+#ifndef SEARCH_H_INCLUDED
+#define SEARCH_H_INCLUDED
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        SEARCH LIBRARIES/DEFINITIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// User Created Libraries:
+#include "network.h"
+#include "graph.h"
+#include "heap.h"
+
+// Atomic library used by cancellation tokens:
+#include <stdatomic.h>
+
+/*
+    SEARCH_STATUS:
+        - Reason the last search of a workspace stopped (see searchSetLimits()).
+                '0' -> Complete, the result is exact.
+                '1' -> Deadline passed before the search finished.
+                '2' -> Settled node budget used up before the search finished.
+                '3' -> Cancelled through the workspace's cancellation token.
+*/
+#define SEARCH_STATUS_COMPLETE 0
+#define SEARCH_STATUS_DEADLINE 1
+#define SEARCH_STATUS_BUDGET 2
+#define SEARCH_STATUS_CANCELLED 3
+
+/*
+    SEARCH_LIMITS_CLOCK_INTERVAL:
+        - Number of settled nodes between two reads of the clock while a deadline is set.
+*/
+#define SEARCH_LIMITS_CLOCK_INTERVAL 64
+
+/*
+    Landmarks Structure:
+        - Public structure defined in 'landmarks.h' header file.
+*/
+struct Landmarks;
+
+/*
+    ArcFlags Structure:
+        - Public structure defined in 'arcFlags.h' header file.
+*/
+struct ArcFlags;
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        PUBLIC SEARCH STRUCTURES
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    SearchLimits Structure:
+        - Per-query limits applied to every search of a workspace, so one pathological query (such as
+            a long unreachable search on a huge component) cannot hold up the queries behind it.
+        - Checked once per settled node, an expired search stops with the best distances known so far.
+
+        timeLimit       - Wall-clock time allowed per search in seconds ('0' for no deadline).
+        maxSettled      - Number of nodes a search may settle ('0' for no budget).
+        cancel          - Token cancelling the running search once set to '1', not owned ('NULL' for none).
+*/
+struct SearchLimits
+{
+    double timeLimit;
+    int maxSettled;
+    atomic_int* cancel;
+};
+
+/*
+    Search Structure:
+        - Public structure holding all per-query state of Dijkstra's algorithm for one graph.
+        - Node values are only valid when their stamp matches the current epoch, so starting a new
+            search is a single epoch increment rather than a reset of every node.
+
+        graph           - Graph the workspace was created for.
+        epoch           - Identifier of the current search.
+        stamp           - Epoch in which each node's distance was last written.
+        settledStamp    - Epoch in which each node was last settled (fully explored).
+        distance        - Shortest known distance from the start node.
+        back            - Previous node id via the shortest path to back propagate ('-1' for the start).
+        heap            - Priority queue of reached but unsettled nodes.
+        start           - Node id of the current search's start node.
+        settledCount    - Number of nodes settled by the current search.
+
+        (For temporary edge and node removal)
+        hasBlocks       - Indication if any edge or node is currently blocked.
+        blockEpoch      - Identifier of the current set of blocks.
+        edgeBlocked     - Block epoch in which each edge was last blocked (allocated on first use).
+        nodeBlocked     - Block epoch in which each node was last blocked (allocated on first use).
+
+        (For searches directed by landmarks, see 'landmarks.h')
+        landmarks       - Landmark tables directing searches that have an end node ('NULL' for plain Dijkstra).
+        potential       - Lower bound on the distance from each reached node to the end node (allocated on first use).
+
+        (For searches pruned by arc flags, see 'arcFlags.h')
+        arcFlags        - Edge flags pruning searches that have an end node ('NULL' for plain Dijkstra).
+
+        (For unreachable pairs answered without searching, see networkSearch())
+        component       - Connected component label of each node id, not owned ('NULL' if unknown).
+
+        (For deadline and budget aware queries, see searchSetLimits())
+        hasLimits       - Indication if any limit is set.
+        limits          - Limits of every search of the workspace.
+        deadline        - Time (timerNow()) the current search expires at ('0' if no deadline).
+        status          - Reason the current search stopped (see SEARCH_STATUS).
+*/
+struct Search
+{
+    struct Graph* graph;
+
+    int epoch;
+    int* stamp;
+    int* settledStamp;
+    int* distance;
+    int* back;
+
+    struct Heap* heap;
+
+    int start;
+    int settledCount;
+
+    // For temporary edge and node removal.
+    int hasBlocks;
+    int blockEpoch;
+    int* edgeBlocked;
+    int* nodeBlocked;
+
+    // For searches directed by landmarks.
+    struct Landmarks* landmarks;
+    int* potential;
+
+    // For searches pruned by arc flags.
+    struct ArcFlags* arcFlags;
+
+    // For unreachable pairs answered without searching.
+    int* component;
+
+    // For deadline and budget aware queries.
+    int hasLimits;
+    struct SearchLimits limits;
+    double deadline;
+    int status;
+};
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                    PUBLIC SEARCH FUNCTION DECLARATIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Creates a search workspace for a given graph.
+struct Search* searchConstructor(struct Graph* graph);
+
+// Frees memory associated with a given search workspace.
+void searchDestructor(struct Search* search);
+
+// Starts a new search from a given node id, forgetting the previous one in constant time.
+void searchReset(struct Search* search, int startId);
+
+// Returns the shortest known distance to a node id within the current search.
+int searchDistance(struct Search* search, int id);
+
+// Indicates if a node id has been settled by the current search.
+int searchIsSettled(struct Search* search, int id);
+
+// Runs Dijkstra's algorithm between two node ids ('-1' as end id settles every reachable node).
+int searchShortestPath(struct Search* search, int startId, int endId);
+
+// Runs Dijkstra's algorithm between two node ids, giving up beyond a maximum distance.
+int searchShortestPathWithin(struct Search* search, int startId, int endId, int maxDistance);
+
+// Sets the deadline, settled node budget and cancellation token of every search of a workspace ('NULL' clears).
+void searchSetLimits(struct Search* search, struct SearchLimits* limits);
+
+// Indicates if the current search has passed one of its limits, recording why within its status.
+int searchLimitsExpired(struct Search* search);
+
+// Temporarily hides a graph edge from the searches of a workspace.
+void searchBlockEdge(struct Search* search, int edge);
+
+// Temporarily hides a node id from the searches of a workspace.
+void searchBlockNode(struct Search* search, int id);
+
+// Restores every blocked edge and node in constant time.
+void searchClearBlocks(struct Search* search);
+
+// Writes the node ids of the path from the start to a given node id, returns the number of nodes.
+int searchPath(struct Search* search, int endId, int* path);
+
+// Resolves two city names, runs Dijkstra's algorithm and formats the result text.
+int searchQuery(struct Search* search, const char* cityStartName, const char* cityEndName,
+                char** text, int* textCapacity, double* algorithmTime);
+
+// Runs Dijkstra's algorithm between two resolved node ids and formats the result text.
+int searchQueryIds(struct Search* search, int cityStartId, int cityEndId, char** text, int* textCapacity, double* algorithmTime);
+
+#endif // SEARCH_H_INCLUDED
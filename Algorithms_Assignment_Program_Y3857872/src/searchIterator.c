@@ -0,0 +1,208 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    searchIterator.c:
+        - Source file defining the functions to pull settled cities out of Dijkstra's algorithm one at a
+            time, in distance order, keeping the frontier between calls.
+        - Work is only done as cities are pulled, so a caller searching for the first city meeting its
+            own condition settles the cities closer than it and nothing more.
+        - Targets and a distance limit can be added while the iterator is running.
+
+        - Functions:
+            - searchBegin
+            - dijkstraBegin
+            - searchNext
+            - searchIteratorAddTarget
+            - searchIteratorLimit
+            - searchEnd
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Include respective header file:
+#include "iterator.h"
+
+// Edge relaxation kernels:
+#include "relax.h"
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        ITERATOR CONSTRUCTORS/DESTRUCTORS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Search Begin:
+        - Starts a new search from a given node id on a workspace and wraps it in an iterator, nothing
+            is settled until searchNext() is called.
+        - Blocked edges and nodes of the workspace are skipped, landmarks and arc flags are not used
+            (the search has no end node).
+        - Returns pointer to new iterator, or 'NULL' if the start id is invalid.
+*/
+struct SearchIterator* searchBegin(struct Search* search, int startId)
+{
+    if (startId < 0 || startId >= search->graph->numNodes)
+        return NULL;
+
+    struct SearchIterator* iterator = malloc(sizeof(struct SearchIterator));
+
+    searchReset(search, startId);
+
+    iterator->search = search;
+    iterator->epoch = search->epoch;
+    iterator->lastCity = -1;
+    iterator->lastDistance = 0;
+    iterator->isFinished = 0;
+    iterator->maxDistance = INT_MAX;
+    iterator->targetStamp = NULL;
+    iterator->numRemaining = 0;
+
+    return iterator;
+}
+
+/*
+    Dijkstra Begin:
+        - Starts an iterator over every city of a network in distance order from a given city name.
+        - Uses the network's frozen graph and search workspace, so the iterator ends once any other
+            search is run on the network or the network is changed.
+        - Flags an error if the city isn't present within the network.
+        - Returns pointer to new iterator, or NULL on failure.
+*/
+struct SearchIterator* dijkstraBegin(struct Network* cityNetwork, const char* cityStartName)
+{
+    struct Search* search = networkSearch(cityNetwork);
+
+    // Find city id.
+    int cityStartId = graphCityIndex(search->graph, cityStartName);
+
+    // Error flagging system:
+
+    if (cityStartId < 0)
+    {
+        printf("Failure: City '%s' not found in network! - (dijkstraBegin - searchIterator.c)\n", cityStartName);
+        return NULL;
+    }
+
+    return searchBegin(search, cityStartId);
+}
+
+/*
+    Search End:
+        - Free memory associated with an iterator. The workspace keeps the distances and paths of
+            every city handed out until its next search.
+*/
+void searchEnd(struct SearchIterator* iterator)
+{
+    if (iterator == NULL)
+        return;
+
+    free(iterator->targetStamp);
+    free(iterator);
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            ITERATOR FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Search Next:
+        - Relaxes the edges of the last node id handed out, then settles and returns the next closest.
+        - Writes the node id's distance from the start when 'distance' is not 'NULL'.
+        - Returns '-1' once every reachable node id, every target or the distance limit is reached,
+            or if the workspace has since been used by another search.
+*/
+int searchNext(struct SearchIterator* iterator, int* distance)
+{
+    struct Search* search;
+    int currentCity, currentDistance;
+
+    if (iterator == NULL || iterator->isFinished == 1)
+        return -1;
+
+    search = iterator->search;
+
+    if (search->epoch != iterator->epoch)
+    {
+        printf("Failure: Search workspace was reused by another search! - (searchNext - searchIterator.c)\n");
+        iterator->isFinished = 1;
+        return -1;
+    }
+
+    // Explore past the last city only now it has been asked for.
+    if (iterator->lastCity >= 0)
+        relaxRow(search, iterator->lastCity, iterator->lastDistance);
+
+    if (heapIsEmpty(search->heap) == 1 || heapTopKey(search->heap) > iterator->maxDistance)
+    {
+        iterator->lastCity = -1;
+        iterator->isFinished = 1;
+        return -1;
+    }
+
+    currentCity = heapPop(search->heap, &currentDistance);
+
+    search->settledStamp[currentCity] = search->epoch;
+    search->settledCount++;
+
+    iterator->lastCity = currentCity;
+    iterator->lastDistance = currentDistance;
+
+    // Finish once the last target is handed out.
+    if (iterator->targetStamp != NULL && iterator->targetStamp[currentCity] == iterator->epoch)
+    {
+        iterator->numRemaining--;
+
+        if (iterator->numRemaining == 0)
+            iterator->isFinished = 1;
+    }
+
+    if (distance != NULL)
+        *distance = currentDistance;
+
+    return currentCity;
+}
+
+/*
+    Search Iterator Add Target:
+        - Adds a node id the iterator has to reach, it finishes straight after handing out the last
+            target added. Can be called at any point of the iteration.
+        - Returns indication if the target was added.
+            '1' -> Target added.
+            '0' -> Target invalid, already added or already handed out (nothing to wait for).
+*/
+int searchIteratorAddTarget(struct SearchIterator* iterator, int id)
+{
+    struct Search* search;
+
+    if (iterator == NULL || iterator->isFinished == 1)
+        return 0;
+
+    search = iterator->search;
+
+    if (id < 0 || id >= search->graph->numNodes || searchIsSettled(search, id) == 1)
+        return 0;
+
+    if (iterator->targetStamp == NULL)
+        iterator->targetStamp = calloc(search->graph->numNodes, sizeof(int));
+
+    if (iterator->targetStamp[id] == iterator->epoch)
+        return 0;
+
+    iterator->targetStamp[id] = iterator->epoch;
+    iterator->numRemaining++;
+
+    return 1;
+}
+
+/*
+    Search Iterator Limit:
+        - Stops the iterator from handing out node ids beyond a given distance. Can be called at any
+            point of the iteration, a limit is only ever lowered.
+*/
+void searchIteratorLimit(struct SearchIterator* iterator, int maxDistance)
+{
+    if (iterator == NULL)
+        return;
+
+    if (maxDistance < iterator->maxDistance)
+        iterator->maxDistance = maxDistance;
+}
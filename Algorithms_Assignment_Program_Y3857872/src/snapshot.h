@@ -0,0 +1,82 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    snapshot.h:
+        - Header file for the 'networkSnapshot.c' source file.
+        - Defines the public functions to query a network while it is being changed: writers publish
+            new read-only versions (snapshots) of the network, readers pin whichever version is current
+            and keep searching it until they release it.
+        - Contains the 'Snapshot' structure.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+#ifndef SNAPSHOT_H_INCLUDED
+#define SNAPSHOT_H_INCLUDED
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        SNAPSHOT LIBRARIES/DEFINITIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// User Created Network Library:
+#include "network.h"
+
+// C11 atomics used for the reference counts:
+#include <stdatomic.h>
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        PUBLIC SNAPSHOT STRUCTURES
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Snapshot Structure:
+        - One published version of a network. The graph is never changed once published, so any
+            number of readers may search it while the writer builds the next version.
+
+        graph           - Frozen graph of the network at this version (belongs to the snapshot).
+        version         - Network version (see networkVersion()) the graph was built from.
+        references      - Number of readers currently holding the snapshot.
+        nextRetired     - Next snapshot waiting to be freed (only used once replaced).
+*/
+struct Snapshot
+{
+    struct Graph* graph;
+    int version;
+    atomic_int references;
+    struct Snapshot* nextRetired;
+};
+
+/*
+    VersionedNetwork Structure:
+        - Public structure defined in 'networkSnapshot.c' source file.
+*/
+struct VersionedNetwork;
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                    PUBLIC SNAPSHOT FUNCTION DECLARATIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Wraps a network for concurrent queries and publishes its first snapshot.
+struct VersionedNetwork* versionedConstructor(struct Network* cityNetwork);
+
+// Frees every snapshot of a versioned network (the network itself is left to the caller).
+void versionedDestructor(struct VersionedNetwork* versioned);
+
+// Starts a change to the network, returns the network to change (one writer at a time).
+struct Network* versionedWriteBegin(struct VersionedNetwork* versioned);
+
+// Publishes the changed network as a new snapshot and ends the change.
+int versionedWriteEnd(struct VersionedNetwork* versioned);
+
+// Returns the number of replaced snapshots still held by readers.
+int versionedRetiredCount(struct VersionedNetwork* versioned);
+
+// Pins and returns the current snapshot, never waits for a writer.
+struct Snapshot* snapshotAcquire(struct VersionedNetwork* versioned);
+
+// Releases a snapshot returned by snapshotAcquire().
+void snapshotRelease(struct VersionedNetwork* versioned, struct Snapshot* snapshot);
+
+#endif // SNAPSHOT_H_INCLUDED
@@ -0,0 +1,369 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    sourceCache.c:
+        - Source file defining the functions of a memory bounded cache of shortest path trees.
+        - Queries are heavily skewed towards a few hub cities. Keeping the complete distance and back
+            arrays from each of the most queried cities answers every query starting or ending at one
+            of them with a single array read instead of a search.
+        - Trees are admitted and evicted by query count (least frequently used), counts are halved
+            every CACHE_AGING_QUERIES queries so the cache follows a changing distribution.
+
+        - Functions:
+            - sourceCacheConstructor
+            - sourceCacheDestructor
+            - sourceCacheAge
+            - sourceCacheAdmit
+            - sourceCacheDistance
+            - sourceCachePath
+            - cacheCompareFrequencies
+            - sourceCacheReport
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Include respective header file:
+#include "cache.h"
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                                CACHE STRUCTURES
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    CacheEntry Structure:
+        - One cached tree while sorting the report by query count.
+
+        source          - City (node id) of the tree.
+        frequency       - Aged query count of the city.
+*/
+struct CacheEntry
+{
+    int source;
+    int frequency;
+};
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        CACHE CONSTRUCTORS/DESTRUCTORS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Source Cache Constructor:
+        - Allocate memory for an empty cache on a given graph, with room for as many trees as fit within
+            'maxBytes' (each tree takes two ints per node). A limit below one tree disables caching,
+            every query is then searched.
+        - Returns pointer to new cache.
+*/
+struct SourceCache* sourceCacheConstructor(struct Graph* graph, size_t maxBytes)
+{
+    struct SourceCache* cache = malloc(sizeof(struct SourceCache));
+    int numNodes = graph->numNodes > 0 ? graph->numNodes : 1;
+    size_t treeBytes = 2 * (size_t) numNodes * sizeof(int);
+    int index;
+
+    cache->graph = graph;
+    cache->search = searchConstructor(graph);
+
+    cache->capacity = (int) (maxBytes / treeBytes < (size_t) numNodes ? maxBytes / treeBytes : (size_t) numNodes);
+    cache->numTrees = 0;
+    cache->treeSource = malloc((cache->capacity > 0 ? cache->capacity : 1) * sizeof(int));
+    cache->treeDistance = calloc(cache->capacity > 0 ? cache->capacity : 1, sizeof(int*));
+    cache->treeBack = calloc(cache->capacity > 0 ? cache->capacity : 1, sizeof(int*));
+
+    cache->slot = malloc(numNodes * sizeof(int));
+    cache->frequency = calloc(numNodes, sizeof(int));
+
+    for (index = 0; index < numNodes; index++)
+        cache->slot[index] = -1;
+
+    cache->maxBytes = maxBytes;
+    cache->numQueries = 0;
+    cache->sourceHits = 0;
+    cache->targetHits = 0;
+    cache->numAdmitted = 0;
+    cache->numEvicted = 0;
+    cache->searchTime = 0;
+
+    // Return new cache.
+    return cache;
+}
+
+/*
+    Source Cache Destructor:
+        - Free memory associated with a cache and every tree within it.
+*/
+void sourceCacheDestructor(struct SourceCache* cache)
+{
+    int index;
+
+    if (cache == NULL)
+        return;
+
+    for (index = 0; index < cache->numTrees; index++)
+    {
+        free(cache->treeDistance[index]);
+        free(cache->treeBack[index]);
+    }
+
+    free(cache->treeSource);
+    free(cache->treeDistance);
+    free(cache->treeBack);
+    free(cache->slot);
+    free(cache->frequency);
+    searchDestructor(cache->search);
+    free(cache);
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            CACHE ADMISSION FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Source Cache Age:
+        - Halves the query count of every node id.
+*/
+static void sourceCacheAge(struct SourceCache* cache)
+{
+    int index;
+
+    for (index = 0; index < cache->graph->numNodes; index++)
+        cache->frequency[index] /= 2;
+}
+
+/*
+    Source Cache Admit:
+        - Builds the tree of a given node id if it is queried often enough, into a free slot or in place
+            of the least queried cached tree (only if that tree is queried CACHE_EVICT_MARGIN percent less).
+        - Returns the slot of the new tree, or '-1' if the node id was not admitted.
+*/
+static int sourceCacheAdmit(struct SourceCache* cache, int id)
+{
+    struct Search* search = cache->search;
+    int numNodes = cache->graph->numNodes;
+    int target, index;
+
+    if (cache->capacity == 0 || cache->frequency[id] < CACHE_ADMIT_FREQUENCY)
+        return -1;
+
+    if (cache->numTrees < cache->capacity)
+    {
+        target = cache->numTrees++;
+        cache->treeDistance[target] = malloc(numNodes * sizeof(int));
+        cache->treeBack[target] = malloc(numNodes * sizeof(int));
+    }
+
+    else
+    {
+        // Find the least frequently used tree.
+        target = 0;
+
+        for (index = 1; index < cache->numTrees; index++)
+            if (cache->frequency[cache->treeSource[index]] < cache->frequency[cache->treeSource[target]])
+                target = index;
+
+        int victimFrequency = cache->frequency[cache->treeSource[target]];
+
+        if ((long long) cache->frequency[id] * 100 <= (long long) victimFrequency * (100 + CACHE_EVICT_MARGIN))
+            return -1;
+
+        cache->slot[cache->treeSource[target]] = -1;
+        cache->numEvicted++;
+    }
+
+    // Search every reachable node from the new city and keep the whole tree.
+    double timeStart = timerNow();
+    searchShortestPath(search, id, -1);
+    cache->searchTime += timerNow() - timeStart;
+
+    for (index = 0; index < numNodes; index++)
+    {
+        int isReached = searchIsSettled(search, index);
+
+        cache->treeDistance[target][index] = isReached ? search->distance[index] : INT_MAX;
+        cache->treeBack[target][index] = isReached ? search->back[index] : -1;
+    }
+
+    cache->treeSource[target] = id;
+    cache->slot[id] = target;
+    cache->numAdmitted++;
+
+    return target;
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            CACHE QUERY FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Source Cache Distance:
+        - Counts the query towards both node ids, then reads the distance from the start's tree, or the
+            end's tree (paths are undirected). On a miss the more queried of the two may be admitted
+            (see sourceCacheAdmit()), otherwise the pair is searched with the cache's own workspace.
+        - Returns the shortest distance ('INT_MAX' if unreachable), or '-1' if either id is invalid.
+*/
+int sourceCacheDistance(struct SourceCache* cache, int startId, int endId)
+{
+    int numNodes = cache->graph->numNodes;
+    int tree;
+
+    if (startId < 0 || startId >= numNodes || endId < 0 || endId >= numNodes)
+        return -1;
+
+    cache->numQueries++;
+    cache->frequency[startId]++;
+    cache->frequency[endId]++;
+
+    if (cache->numQueries % CACHE_AGING_QUERIES == 0)
+        sourceCacheAge(cache);
+
+    // Hits.
+    if (cache->slot[startId] >= 0)
+    {
+        cache->sourceHits++;
+        return cache->treeDistance[cache->slot[startId]][endId];
+    }
+
+    if (cache->slot[endId] >= 0)
+    {
+        cache->targetHits++;
+        return cache->treeDistance[cache->slot[endId]][startId];
+    }
+
+    // Miss, build the hotter city's tree if it has earned a place.
+    tree = sourceCacheAdmit(cache, cache->frequency[endId] > cache->frequency[startId] ? endId : startId);
+
+    if (tree >= 0)
+        return cache->treeDistance[tree][cache->treeSource[tree] == startId ? endId : startId];
+
+    double timeStart = timerNow();
+    int isReachable = searchShortestPath(cache->search, startId, endId);
+    cache->searchTime += timerNow() - timeStart;
+
+    return isReachable == 1 ? searchDistance(cache->search, endId) : INT_MAX;
+}
+
+/*
+    Source Cache Path:
+        - Writes the node ids of the shortest path from a start to an end node id (if 'path' is not NULL),
+            back propagating through the tree of either city, or searching if neither is cached.
+        - Does not count as a query.
+        - Returns the number of nodes on the path, or '0' if unreachable or either id is invalid.
+*/
+int sourceCachePath(struct SourceCache* cache, int startId, int endId, int* path)
+{
+    int numNodes = cache->graph->numNodes;
+    int length = 0, city, index;
+
+    if (startId < 0 || startId >= numNodes || endId < 0 || endId >= numNodes)
+        return 0;
+
+    if (cache->slot[startId] >= 0)
+    {
+        int* back = cache->treeBack[cache->slot[startId]];
+
+        if (cache->treeDistance[cache->slot[startId]][endId] == INT_MAX)
+            return 0;
+
+        // Walk back from the end, then reverse into start to end order.
+        for (city = endId; city != -1; city = back[city])
+        {
+            if (path != NULL)
+                path[length] = city;
+
+            length++;
+        }
+
+        for (index = 0; path != NULL && index < length / 2; index++)
+        {
+            city = path[index];
+            path[index] = path[length - 1 - index];
+            path[length - 1 - index] = city;
+        }
+
+        return length;
+    }
+
+    if (cache->slot[endId] >= 0)
+    {
+        int* back = cache->treeBack[cache->slot[endId]];
+
+        if (cache->treeDistance[cache->slot[endId]][startId] == INT_MAX)
+            return 0;
+
+        // The end's tree leads from the start back to the end, already in path order.
+        for (city = startId; city != -1; city = back[city])
+        {
+            if (path != NULL)
+                path[length] = city;
+
+            length++;
+        }
+
+        return length;
+    }
+
+    if (searchShortestPath(cache->search, startId, endId) == 0)
+        return 0;
+
+    return searchPath(cache->search, endId, path);
+}
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            CACHE DISPLAY FUNCTIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Cache Compare Frequencies:
+        - qsort() comparison of two cache entries by query count, most queried first.
+*/
+static int cacheCompareFrequencies(const void* entry1, const void* entry2)
+{
+    int frequency1 = ((const struct CacheEntry*) entry1)->frequency;
+    int frequency2 = ((const struct CacheEntry*) entry2)->frequency;
+
+    return (frequency1 < frequency2) - (frequency1 > frequency2);
+}
+
+/*
+    Source Cache Report:
+        - Prints the hit rates, tree turnover, search time and memory use of a cache, then its cached
+            cities from most to least queried.
+*/
+void sourceCacheReport(struct SourceCache* cache)
+{
+    long long numHits = cache->sourceHits + cache->targetHits;
+    size_t treeBytes = 2 * (size_t) cache->graph->numNodes * sizeof(int);
+    int index;
+
+    printf("\nSOURCE CACHE - (%d of %d trees, %.1f of %.1f KB)\n", cache->numTrees, cache->capacity,
+           cache->numTrees * treeBytes / 1024.0, cache->maxBytes / 1024.0);
+    printf("\tQueries  : %lld\n", cache->numQueries);
+    printf("\tHits     : %lld (%.1f%%) - %lld by start city, %lld by end city\n", numHits,
+           cache->numQueries > 0 ? 100.0 * numHits / cache->numQueries : 0.0, cache->sourceHits, cache->targetHits);
+    printf("\tTrees    : %lld built, %lld evicted\n", cache->numAdmitted, cache->numEvicted);
+    printf("\tSearching: %10.3fms\n", cache->searchTime * 1000);
+
+    if (cache->numTrees == 0)
+        return;
+
+    struct CacheEntry* entries = malloc(cache->numTrees * sizeof(struct CacheEntry));
+
+    for (index = 0; index < cache->numTrees; index++)
+    {
+        entries[index].source = cache->treeSource[index];
+        entries[index].frequency = cache->frequency[cache->treeSource[index]];
+    }
+
+    qsort(entries, cache->numTrees, sizeof(struct CacheEntry), cacheCompareFrequencies);
+
+    printf("\tCached   : [ ");
+
+    for (index = 0; index < cache->numTrees; index++)
+        printf("%s%s (%d)", index > 0 ? ", " : "", graphCityName(cache->graph, entries[index].source), entries[index].frequency);
+
+    printf(" ]\n");
+    free(entries);
+}
@@ -74,7 +74,7 @@ int stackPush(struct Stack* stack, struct Node* city, int shortestDistance, int
 struct Node* stackPop(struct Stack* stack, int* edgeDistance);
 
 // Searches a stack for a given city name and returns its index if found.
-int stackSearch(struct Stack* stack, char cityName[127]);
+int stackSearch(struct Stack* stack, const char* cityName);
 
 // Bubble sorts the priority stack into descending order.
 void stackBubbleSort(struct Stack* stack);
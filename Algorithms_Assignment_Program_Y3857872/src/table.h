@@ -0,0 +1,85 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    table.h:
+        - Header file for the 'manyToMany.c' source file.
+        - Defines the public functions to fill a distance table between a set of source cities and a set
+            of target cities (depots x customers) on a contraction hierarchy, with one small upward
+            search per source and per target instead of a search per pair.
+        - Contains the 'DistanceTable' structure.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+#ifndef TABLE_H_INCLUDED
+#define TABLE_H_INCLUDED
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            TABLE LIBRARIES/DEFINITIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// User Created Hierarchy Library:
+#include "hierarchy.h"
+
+/*
+    TABLE_THREADS:
+        - Default number of threads (including the calling thread) used to fill a table.
+*/
+#define TABLE_THREADS 4
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                            PUBLIC TABLE STRUCTURES
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    DistanceTable Structure:
+        - Every shortest path of a hierarchy climbs from the source to its highest node and then comes
+            down to the target. An upward search from each target leaves a bucket entry (target, distance)
+            at every node it settles, an upward search from each source then reads the buckets of the
+            nodes it settles: the shortest distance to a target is the smallest sum over shared nodes.
+        - Target searches stop where they reach the hierarchy's core, source searches cross the core, so
+            the number of bucket entries does not grow with the size of the core.
+        - Distances are stored row by row (source index * numTargets + target index).
+
+        numSources      - Number of source node ids.
+        numTargets      - Number of target node ids.
+        sources         - Source node ids (as the hierarchy's node ids).
+        targets         - Target node ids.
+        distances       - Shortest distance from each source to each target ('INT_MAX' if unreachable).
+        numEntries      - Number of bucket entries left by the target searches.
+        bucketTime      - Time of the target (backward) searches in seconds.
+        buildTime       - Time to fill the whole table in seconds.
+*/
+struct DistanceTable
+{
+    int numSources;
+    int numTargets;
+    int* sources;
+    int* targets;
+    int* distances;
+
+    long long numEntries;
+    double bucketTime;
+    double buildTime;
+};
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        PUBLIC TABLE FUNCTION DECLARATIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Fills the distance table between given source and target node ids of a hierarchy across a given number of threads.
+struct DistanceTable* tableConstructor(struct Hierarchy* hierarchy, int* sourceIds, int numSources, int* targetIds,
+                                      int numTargets, int numThreads);
+
+// Frees memory associated with a given distance table.
+void tableDestructor(struct DistanceTable* table);
+
+// Returns the distance from a source index to a target index of a table (INT_MAX if unreachable).
+int tableDistance(struct DistanceTable* table, int sourceIndex, int targetIndex);
+
+// Prints the table's time against one Dijkstra one-to-all search per source on a graph, returns the distances that differ.
+int tableReport(struct DistanceTable* table, struct Search* search);
+
+#endif // TABLE_H_INCLUDED
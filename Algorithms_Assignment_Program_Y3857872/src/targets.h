@@ -0,0 +1,84 @@
+// Exam Number: Y3857872
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+    targets.h:
+        - Header file for the 'multiTargetSearch.c' source file.
+        - Defines the public functions to find the shortest paths from one start city to a set of end
+            cities with a single search, stopping once every end city is settled.
+        - Contains the 'Targets' structure.
+
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+#ifndef TARGETS_H_INCLUDED
+#define TARGETS_H_INCLUDED
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        TARGETS LIBRARIES/DEFINITIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// User Created Network Library:
+#include "network.h"
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                        PUBLIC TARGETS STRUCTURES
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+/*
+    Targets Structure:
+        - Targets refer to the node ids of the graph they were found on, so they must be displayed
+            before the network they came from is changed.
+        - The path to target 'i' is entries pathStart[i] to pathStart[i + 1] - 1 of 'pathNodes'
+            (none if unreachable).
+        - 'settledCount' and 'radius' tell how far the single search had to go. Separate searches
+            towards each target settle roughly the cities closer than that target, so one search pays
+            off once its settled count is below the sum a separate search per target would need.
+
+        graph           - Graph the targets were searched on (used to print city names).
+        start           - Node id of the start city.
+        count           - Number of targets.
+        nodes           - Node id of each target ('-1' if the city was not found).
+        distances       - Shortest distance to each target ('INT_MAX' if unreachable).
+        pathStart       - Index of the first path node of each target (count + 1 entries).
+        pathNodes       - Node ids of every target's path from the start, target after target.
+        pathDistances   - Distance travelled from the start when reaching each path node.
+        numReached      - Number of targets reached.
+        settledCount    - Number of nodes settled by the search.
+        radius          - Distance of the last node settled (the furthest reached target).
+*/
+struct Targets
+{
+    struct Graph* graph;
+    int start;
+
+    int count;
+    int* nodes;
+    int* distances;
+    int* pathStart;
+    int* pathNodes;
+    int* pathDistances;
+
+    int numReached;
+    int settledCount;
+    int radius;
+};
+
+
+/** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+                                    PUBLIC TARGETS FUNCTION DECLARATIONS
+* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+
+// Finds the shortest paths from a city to many cities present within a network with one search.
+struct Targets* oneToMany(struct Network* cityNetwork, const char* cityStartName, char cityEndNames[][127], int numTargets);
+
+// Finds the shortest paths from a node id to many node ids using a given search workspace.
+struct Targets* searchOneToMany(struct Search* search, int startId, int* endIds, int numTargets);
+
+// Frees memory associated with a given set of targets.
+void targetsDestructor(struct Targets* targets);
+
+// Displays the path to every target and how far the search had to go.
+void displayTargets(struct Targets* targets);
+
+#endif // TARGETS_H_INCLUDED